@@ -0,0 +1,98 @@
+#include <Core/Geometry/bvh.h>
+#include <benchmark/benchmark.h>
+#include <limits>
+#include <util/random.h>
+#include <vector>
+
+using namespace MathLib;
+
+namespace
+{
+std::vector<Triangle<float>> randomTriangles(std::size_t count)
+{
+    std::vector<float> coordinates(count * 3);
+    std::vector<float> offsets(count * 9);
+    Util::fillRandom(coordinates.data(), coordinates.size(), -50.0f, 50.0f);
+    Util::fillRandom(offsets.data(), offsets.size(), -1.0f, 1.0f);
+
+    std::vector<Triangle<float>> triangles(count);
+    for (std::size_t i{0}; i < count; ++i)
+    {
+        Point<float, 3> vertices[3];
+        for (int v{0}; v < 3; ++v)
+        {
+            for (int c{0}; c < 3; ++c)
+            {
+                vertices[v](c) = coordinates[3 * i + c] + offsets[9 * i + 3 * v + c];
+            }
+        }
+        triangles[i] = Triangle<float>{vertices[0], vertices[1], vertices[2]};
+    }
+
+    return triangles;
+}
+
+std::vector<Ray<float>> randomRays(std::size_t count)
+{
+    std::vector<float> values(count * 4);
+    Util::fillRandom(values.data(), values.size(), -1.0f, 1.0f);
+
+    std::vector<Ray<float>> rays(count);
+    for (std::size_t i{0}; i < count; ++i)
+    {
+        rays[i] = Ray<float>{Point<float, 3>{50 * values[4 * i], 50 * values[4 * i + 1], -60},
+                             Vector<float, 3>{0.3f * values[4 * i + 2], 0.3f * values[4 * i + 3], 1}};
+    }
+
+    return rays;
+}
+} // namespace
+
+void BM_BVHBuild(benchmark::State &state)
+{
+    const std::vector<Triangle<float>> triangles{randomTriangles(static_cast<std::size_t>(state.range(0)))};
+
+    for (auto _ : state)
+    {
+        BVH<float> bvh{triangles.data(), triangles.size()};
+        benchmark::DoNotOptimize(bvh.nodes().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BVHBuild)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// what an animated mesh pays per frame instead of a build
+void BM_BVHRefit(benchmark::State &state)
+{
+    const std::vector<Triangle<float>> triangles{randomTriangles(static_cast<std::size_t>(state.range(0)))};
+    BVH<float> bvh{triangles.data(), triangles.size()};
+
+    for (auto _ : state)
+    {
+        bvh.refit(triangles.data());
+        benchmark::DoNotOptimize(bvh.nodes().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BVHRefit)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+template <int width>
+void BM_BVHClosestHit(benchmark::State &state)
+{
+    const std::vector<Triangle<float>> triangles{randomTriangles(static_cast<std::size_t>(state.range(0)))};
+    const std::vector<Ray<float>> rays{randomRays(4096)};
+    const BVH<float, width> bvh{triangles.data(), triangles.size()};
+
+    for (auto _ : state)
+    {
+        for (const Ray<float> &ray : rays)
+        {
+            TriangleHit<float> hit;
+            benchmark::DoNotOptimize(intersectClosest(
+                bvh, triangles.data(), ray, 0.0f, std::numeric_limits<float>::infinity(), hit));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(rays.size()));
+}
+BENCHMARK_TEMPLATE(BM_BVHClosestHit, 4)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_BVHClosestHit, 8)->Arg(100000);
@@ -0,0 +1,106 @@
+#include <Core/Geometry/hashGrid.h>
+#include <Core/Geometry/kdTree.h>
+#include <benchmark/benchmark.h>
+#include <util/random.h>
+#include <vector>
+
+using namespace MathLib;
+
+namespace
+{
+std::vector<Point<float, 3>> randomPoints(std::size_t count)
+{
+    std::vector<float> coordinates(count * 3);
+    Util::fillRandom(coordinates.data(), coordinates.size(), -50.0f, 50.0f);
+
+    std::vector<Point<float, 3>> points(count);
+    for (std::size_t i{0}; i < count; ++i)
+    {
+        points[i] = Point<float, 3>{coordinates[3 * i], coordinates[3 * i + 1], coordinates[3 * i + 2]};
+    }
+
+    return points;
+}
+
+constexpr std::size_t neighbor_count{8};
+} // namespace
+
+void BM_KdTreeBuild(benchmark::State &state)
+{
+    const std::vector<Point<float, 3>> points{randomPoints(static_cast<std::size_t>(state.range(0)))};
+
+    for (auto _ : state)
+    {
+        KdTree<float, 3> tree{points.data(), points.size()};
+        benchmark::DoNotOptimize(tree.count());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_KdTreeBuild)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+void BM_HashGridBuild(benchmark::State &state)
+{
+    const std::vector<Point<float, 3>> points{randomPoints(static_cast<std::size_t>(state.range(0)))};
+
+    for (auto _ : state)
+    {
+        HashGrid<float, 3> grid{points.data(), points.size(), 1.0f};
+        benchmark::DoNotOptimize(grid.count());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HashGridBuild)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// k nearest neighbours of 4096 queries in a batch
+template <typename Structure>
+void runNearest(benchmark::State &state, const Structure &structure, const std::vector<Point<float, 3>> &queries)
+{
+    std::vector<Neighbor<float>> neighbors(queries.size() * neighbor_count);
+    std::vector<std::size_t> found(queries.size());
+
+    for (auto _ : state)
+    {
+        structure.nearest(queries.data(), queries.size(), neighbor_count, neighbors.data(), found.data());
+        benchmark::DoNotOptimize(neighbors.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(queries.size()));
+}
+
+void BM_KdTreeNearest(benchmark::State &state)
+{
+    const std::vector<Point<float, 3>> points{randomPoints(static_cast<std::size_t>(state.range(0)))};
+    const KdTree<float, 3> tree{points.data(), points.size()};
+    runNearest(state, tree, randomPoints(4096));
+}
+BENCHMARK(BM_KdTreeNearest)->Arg(1000000);
+
+void BM_HashGridNearest(benchmark::State &state)
+{
+    const std::vector<Point<float, 3>> points{randomPoints(static_cast<std::size_t>(state.range(0)))};
+    const HashGrid<float, 3> grid{points.data(), points.size(), 1.0f};
+    runNearest(state, grid, randomPoints(4096));
+}
+BENCHMARK(BM_HashGridNearest)->Arg(1000000);
+
+// the linear scan the structures replace
+void BM_BruteForceNearest(benchmark::State &state)
+{
+    const std::vector<Point<float, 3>> points{randomPoints(static_cast<std::size_t>(state.range(0)))};
+    const std::vector<Point<float, 3>> queries{randomPoints(64)};
+    std::vector<Neighbor<float>> neighbors(neighbor_count);
+
+    for (auto _ : state)
+    {
+        for (const Point<float, 3> &query : queries)
+        {
+            detail::NearestNeighbors<float> heap{neighbors.data(), neighbor_count};
+            for (std::size_t i{0}; i < points.size(); ++i)
+            {
+                heap.push(static_cast<std::uint32_t>(i), detail::distanceSquared(query, points[i]));
+            }
+            benchmark::DoNotOptimize(heap.finish());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(queries.size()));
+}
+BENCHMARK(BM_BruteForceNearest)->Arg(1000000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,96 @@
+#include <Core/Matrix/denseMatrix.h>
+#include <Core/Matrix/gemm.h>
+#include <benchmark/benchmark.h>
+
+using namespace MathLib;
+
+namespace
+{
+template <typename T>
+DenseMatrix<T> randomDenseMatrix(std::size_t rows, std::size_t cols)
+{
+    DenseMatrix<T> mat(rows, cols);
+    Util::fillRandom(mat.raw(), rows * cols, T{-1}, T{1});
+
+    return mat;
+}
+
+// the textbook loop nest (dot product of a row of A with a column of B for every element of C)
+template <typename T>
+void referenceGemm(const DenseMatrix<T> &a, const DenseMatrix<T> &b, DenseMatrix<T> &c)
+{
+    for (std::size_t i{0}; i < a.rows(); ++i)
+    {
+        for (std::size_t j{0}; j < b.cols(); ++j)
+        {
+            T sum{0};
+            for (std::size_t p{0}; p < a.cols(); ++p)
+            {
+                sum += a(i, p) * b(p, j);
+            }
+            c(i, j) = sum;
+        }
+    }
+}
+
+void setFlops(benchmark::State &state, std::size_t size)
+{
+    state.counters["FLOP/s"] = benchmark::Counter(
+        2.0 * size * size * size, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::kIs1000);
+}
+} // namespace
+
+template <typename T>
+void BM_GemmReference(benchmark::State &state)
+{
+    const std::size_t size{static_cast<std::size_t>(state.range(0))};
+    const DenseMatrix<T> a{randomDenseMatrix<T>(size, size)};
+    const DenseMatrix<T> b{randomDenseMatrix<T>(size, size)};
+    DenseMatrix<T> c(size, size);
+
+    for (auto _ : state)
+    {
+        referenceGemm(a, b, c);
+        benchmark::DoNotOptimize(c.raw());
+        benchmark::ClobberMemory();
+    }
+    setFlops(state, size);
+}
+BENCHMARK_TEMPLATE(BM_GemmReference, float)->Arg(64)->Arg(256)->Arg(512);
+BENCHMARK_TEMPLATE(BM_GemmReference, double)->Arg(64)->Arg(256)->Arg(512);
+
+template <typename T>
+void BM_Gemm(benchmark::State &state)
+{
+    const std::size_t size{static_cast<std::size_t>(state.range(0))};
+    const DenseMatrix<T> a{randomDenseMatrix<T>(size, size)};
+    const DenseMatrix<T> b{randomDenseMatrix<T>(size, size)};
+    DenseMatrix<T> c(size, size);
+
+    for (auto _ : state)
+    {
+        gemm(T{1}, a, b, T{0}, c);
+        benchmark::DoNotOptimize(c.raw());
+        benchmark::ClobberMemory();
+    }
+    setFlops(state, size);
+}
+BENCHMARK_TEMPLATE(BM_Gemm, float)->Arg(64)->Arg(256)->Arg(512)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_Gemm, double)->Arg(64)->Arg(256)->Arg(512)->Arg(1024);
+
+// the product operator, which picks the column loops or gemm depending on the size
+template <typename T>
+void BM_DenseMatrixProduct(benchmark::State &state)
+{
+    const std::size_t size{static_cast<std::size_t>(state.range(0))};
+    const DenseMatrix<T> a{randomDenseMatrix<T>(size, size)};
+    const DenseMatrix<T> b{randomDenseMatrix<T>(size, size)};
+
+    for (auto _ : state)
+    {
+        DenseMatrix<T> c{a * b};
+        benchmark::DoNotOptimize(c.raw());
+    }
+    setFlops(state, size);
+}
+BENCHMARK_TEMPLATE(BM_DenseMatrixProduct, double)->Arg(16)->Arg(32)->Arg(48)->Arg(256);
@@ -0,0 +1,242 @@
+#include "allocationCounter.h"
+#include <Core/Matrix/decomposition.h>
+#include <Core/Matrix/matrix.h>
+#include <Core/Matrix/transform.h>
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace MathLib;
+
+template <typename T, int rows, int cols>
+Matrix<T, rows, cols> randomMatrix()
+{
+    Matrix<T, rows, cols> mat;
+    Util::fillRandom(mat.raw(), rows * cols, T{-1}, T{1});
+
+    return mat;
+}
+
+template <typename T, int size>
+void BM_MatrixMultiply(benchmark::State &state)
+{
+    Matrix<T, size, size> a{randomMatrix<T, size, size>()};
+    const Matrix<T, size, size> b{randomMatrix<T, size, size>()};
+
+    AllocationCounter allocations{state};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        Matrix<T, size, size> res{a * b};
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK_TEMPLATE(BM_MatrixMultiply, float, 2);
+BENCHMARK_TEMPLATE(BM_MatrixMultiply, float, 3);
+BENCHMARK_TEMPLATE(BM_MatrixMultiply, float, 4);
+BENCHMARK_TEMPLATE(BM_MatrixMultiply, double, 2);
+BENCHMARK_TEMPLATE(BM_MatrixMultiply, double, 3);
+BENCHMARK_TEMPLATE(BM_MatrixMultiply, double, 4);
+
+template <typename T, int size>
+void BM_MatrixVectorMultiply(benchmark::State &state)
+{
+    Matrix<T, size, size> mat{randomMatrix<T, size, size>()};
+    const Vector<T, size> vec{Vector<T, size>::random()};
+
+    AllocationCounter allocations{state};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mat);
+        Vector<T, size> res{mat * vec};
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK_TEMPLATE(BM_MatrixVectorMultiply, float, 2);
+BENCHMARK_TEMPLATE(BM_MatrixVectorMultiply, float, 3);
+BENCHMARK_TEMPLATE(BM_MatrixVectorMultiply, float, 4);
+BENCHMARK_TEMPLATE(BM_MatrixVectorMultiply, double, 2);
+BENCHMARK_TEMPLATE(BM_MatrixVectorMultiply, double, 3);
+BENCHMARK_TEMPLATE(BM_MatrixVectorMultiply, double, 4);
+
+template <typename T, int size>
+void BM_MatrixCopy(benchmark::State &state)
+{
+    Matrix<T, size, size> source{};
+    source.setIdentity();
+
+    AllocationCounter allocations{state};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(source);
+        Matrix<T, size, size> copy{source};
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK_TEMPLATE(BM_MatrixCopy, float, 4);
+BENCHMARK_TEMPLATE(BM_MatrixCopy, double, 4);
+
+template <typename T, int size>
+void BM_MatrixMove(benchmark::State &state)
+{
+    Matrix<T, size, size> source{};
+    source.setIdentity();
+
+    AllocationCounter allocations{state};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(source);
+        Matrix<T, size, size> moved{std::move(source)};
+        benchmark::DoNotOptimize(moved);
+    }
+}
+BENCHMARK_TEMPLATE(BM_MatrixMove, float, 4);
+BENCHMARK_TEMPLATE(BM_MatrixMove, double, 4);
+
+// a fused element-wise expression with a transpose
+template <typename T, int size>
+void BM_MatrixExpression(benchmark::State &state)
+{
+    Matrix<T, size, size> a{randomMatrix<T, size, size>()};
+    const Matrix<T, size, size> b{randomMatrix<T, size, size>()};
+
+    AllocationCounter allocations{state};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        Matrix<T, size, size> res{a * T{2} + transpose(b) - a};
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK_TEMPLATE(BM_MatrixExpression, float, 2);
+BENCHMARK_TEMPLATE(BM_MatrixExpression, float, 3);
+BENCHMARK_TEMPLATE(BM_MatrixExpression, float, 4);
+BENCHMARK_TEMPLATE(BM_MatrixExpression, double, 4);
+
+// transforming a homogeneous point one at a time through Matrix * Point
+template <typename T>
+void BM_MatrixTransformPoint(benchmark::State &state)
+{
+    const Matrix<T, 4, 4> mat{getTranslation(Vector<T, 3>{1, 2, 3}) * Matrix<T, 4, 4>{getRotateX(T{0.5})}};
+    std::vector<Point<T, 3>> points(state.range(0));
+    for (Point<T, 3> &point : points)
+    {
+        point = Point<T, 3>::random();
+    }
+    std::vector<Point<T, 3>> out(points.size());
+
+    for (auto _ : state)
+    {
+        for (std::size_t i{0}; i < points.size(); ++i)
+        {
+            out[i] = Point<T, 3>{mat * Point<T, 4>{points[i], 1}};
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_MatrixTransformPoint, float)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_MatrixTransformPoint, double)->Arg(1024);
+
+// the batch entry point from transform.h
+template <typename T>
+void BM_TransformPoints(benchmark::State &state)
+{
+    const Matrix<T, 4, 4> mat{getTranslation(Vector<T, 3>{1, 2, 3}) * Matrix<T, 4, 4>{getRotateX(T{0.5})}};
+    std::vector<Point<T, 3>> points(state.range(0));
+    for (Point<T, 3> &point : points)
+    {
+        point = Point<T, 3>::random();
+    }
+    std::vector<Point<T, 3>> out(points.size());
+
+    for (auto _ : state)
+    {
+        transformPoints(mat, points.data(), out.data(), points.size());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_TransformPoints, float)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_TransformPoints, double)->Arg(1024);
+
+template <typename T, int size>
+void BM_MatrixInverse(benchmark::State &state)
+{
+    Matrix<T, size, size> a{randomMatrix<T, size, size>()};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        Matrix<T, size, size> res{inverse(a)};
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK_TEMPLATE(BM_MatrixInverse, float, 3);
+BENCHMARK_TEMPLATE(BM_MatrixInverse, float, 4);
+BENCHMARK_TEMPLATE(BM_MatrixInverse, float, 8);
+BENCHMARK_TEMPLATE(BM_MatrixInverse, double, 3);
+BENCHMARK_TEMPLATE(BM_MatrixInverse, double, 4);
+BENCHMARK_TEMPLATE(BM_MatrixInverse, double, 8);
+
+template <typename T, int size>
+void BM_MatrixDeterminant(benchmark::State &state)
+{
+    Matrix<T, size, size> a{randomMatrix<T, size, size>()};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        T det{a.determinant()};
+        benchmark::DoNotOptimize(det);
+    }
+}
+BENCHMARK_TEMPLATE(BM_MatrixDeterminant, float, 4);
+BENCHMARK_TEMPLATE(BM_MatrixDeterminant, double, 4);
+BENCHMARK_TEMPLATE(BM_MatrixDeterminant, double, 8);
+
+// inverse of a model matrix, compare with BM_MatrixInverse for size 4
+template <typename T>
+void BM_MatrixAffineInverse(benchmark::State &state)
+{
+    Matrix<T, 4, 4> a{getTranslation(Vector<T, 3>::random()) *
+                      Matrix<T, 4, 4>{getRotation(Vector<T, 3>::random()) * getScaling(Vector<T, 3>{2, 1, 3})}};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        Matrix<T, 4, 4> res{affineInverse(a)};
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK_TEMPLATE(BM_MatrixAffineInverse, float);
+BENCHMARK_TEMPLATE(BM_MatrixAffineInverse, double);
+
+// solving with a factorization that is computed once, compare with BM_MatrixInverse
+template <typename Decomposition, typename T, int size>
+void BM_DecompositionSolve(benchmark::State &state)
+{
+    Matrix<T, size, size> a{randomMatrix<T, size, size>()};
+    a = Matrix<T, size, size>{transpose(a) * a};
+    for (int i{0}; i < size; ++i)
+    {
+        a(i, i) += T{1};
+    }
+
+    const Decomposition decomposition{a};
+    Vector<T, size> b{Vector<T, size>::random()};
+
+    AllocationCounter allocations{state};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(b);
+        Vector<T, size> x{decomposition.solve(b)};
+        benchmark::DoNotOptimize(x);
+    }
+}
+BENCHMARK_TEMPLATE(BM_DecompositionSolve, LUDecomposition<double, 4>, double, 4);
+BENCHMARK_TEMPLATE(BM_DecompositionSolve, LUDecomposition<double, 8>, double, 8);
+BENCHMARK_TEMPLATE(BM_DecompositionSolve, CholeskyDecomposition<double, 4>, double, 4);
+BENCHMARK_TEMPLATE(BM_DecompositionSolve, CholeskyDecomposition<double, 8>, double, 8);
+BENCHMARK_TEMPLATE(BM_DecompositionSolve, QRDecomposition<double, 8, 8>, double, 8);
@@ -0,0 +1,211 @@
+#include <Core/Matrix/matrix.h>
+#include <Core/Quaternion/quaternion.h>
+#include <Core/Quaternion/quaternionPacket.h>
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace MathLib;
+
+template <typename T>
+Quaternion<T> randomRotation()
+{
+    Quaternion<T> q{};
+    q.setRotation(normalize(Vector<T, 3>::random(T{-1}, T{1})), Util::random_number<T>(T{0}, T{3}));
+
+    return q;
+}
+
+template <typename T>
+void BM_QuaternionMultiply(benchmark::State &state)
+{
+    Quaternion<T> a{randomRotation<T>()};
+    const Quaternion<T> b{randomRotation<T>()};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        Quaternion<T> res{a * b};
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK_TEMPLATE(BM_QuaternionMultiply, float);
+BENCHMARK_TEMPLATE(BM_QuaternionMultiply, double);
+
+// composing rotations given as angles, compare with BM_RotationMatrixFromAngles
+template <typename T>
+void BM_QuaternionFromAngles(benchmark::State &state)
+{
+    Vector<T, 3> angles{Vector<T, 3>::random(T{-3}, T{3})};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(angles);
+        Quaternion<T> q{};
+        q.setRotation(angles);
+        benchmark::DoNotOptimize(q);
+    }
+}
+BENCHMARK_TEMPLATE(BM_QuaternionFromAngles, float);
+BENCHMARK_TEMPLATE(BM_QuaternionFromAngles, double);
+
+template <typename T>
+void BM_RotationMatrixFromAngles(benchmark::State &state)
+{
+    Vector<T, 3> angles{Vector<T, 3>::random(T{-3}, T{3})};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(angles);
+        Matrix<T, 3, 3> rotation{getRotation(angles)};
+        benchmark::DoNotOptimize(rotation);
+    }
+}
+BENCHMARK_TEMPLATE(BM_RotationMatrixFromAngles, float);
+BENCHMARK_TEMPLATE(BM_RotationMatrixFromAngles, double);
+
+template <typename T>
+void BM_QuaternionRotateVector(benchmark::State &state)
+{
+    const Quaternion<T> q{randomRotation<T>()};
+    Vector<T, 3> v{Vector<T, 3>::random()};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(v);
+        Vector<T, 3> res{q.rotate(v)};
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK_TEMPLATE(BM_QuaternionRotateVector, float);
+BENCHMARK_TEMPLATE(BM_QuaternionRotateVector, double);
+
+template <typename T>
+void BM_QuaternionSlerp(benchmark::State &state)
+{
+    Quaternion<T> a{randomRotation<T>()};
+    const Quaternion<T> b{randomRotation<T>()};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        Quaternion<T> res{slerp(a, b, T{0.3})};
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK_TEMPLATE(BM_QuaternionSlerp, float);
+BENCHMARK_TEMPLATE(BM_QuaternionSlerp, double);
+
+template <typename T>
+void BM_QuaternionNlerp(benchmark::State &state)
+{
+    Quaternion<T> a{randomRotation<T>()};
+    const Quaternion<T> b{randomRotation<T>()};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        Quaternion<T> res{nlerp(a, b, T{0.3})};
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK_TEMPLATE(BM_QuaternionNlerp, float);
+BENCHMARK_TEMPLATE(BM_QuaternionNlerp, double);
+
+// structure of arrays storage for the batch benchmarks
+template <typename T>
+struct QuaternionBuffer
+{
+    std::vector<T> x, y, z, w;
+
+    explicit QuaternionBuffer(std::size_t count) : x(count), y(count), z(count), w(count)
+    {
+        for (std::size_t i{0}; i < count; ++i)
+        {
+            const Quaternion<T> q{randomRotation<T>()};
+            x[i] = q(0);
+            y[i] = q(1);
+            z[i] = q(2);
+            w[i] = q(3);
+        }
+    }
+
+    QuaternionSoA<T> view() { return QuaternionSoA<T>{x.data(), y.data(), z.data(), w.data()}; }
+};
+
+// per quaternion loop over the single quaternion slerp, compare with BM_QuaternionBatchSlerp
+template <typename T>
+void BM_QuaternionSlerpLoop(benchmark::State &state)
+{
+    const std::size_t count{static_cast<std::size_t>(state.range(0))};
+    std::vector<Quaternion<T>> q(count), r(count), out(count);
+    for (std::size_t i{0}; i < count; ++i)
+    {
+        q[i] = randomRotation<T>();
+        r[i] = randomRotation<T>();
+    }
+
+    for (auto _ : state)
+    {
+        for (std::size_t i{0}; i < count; ++i)
+        {
+            out[i] = slerp(q[i], r[i], T{0.3});
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_QuaternionSlerpLoop, float)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_QuaternionSlerpLoop, double)->Arg(1024);
+
+template <typename T>
+void BM_QuaternionBatchSlerp(benchmark::State &state)
+{
+    const std::size_t count{static_cast<std::size_t>(state.range(0))};
+    QuaternionBuffer<T> q{count}, r{count}, out{count};
+
+    for (auto _ : state)
+    {
+        slerp(q.view(), r.view(), T{0.3}, out.view(), count);
+        benchmark::DoNotOptimize(out.x.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_QuaternionBatchSlerp, float)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_QuaternionBatchSlerp, double)->Arg(1024);
+
+template <typename T>
+void BM_QuaternionBatchNlerp(benchmark::State &state)
+{
+    const std::size_t count{static_cast<std::size_t>(state.range(0))};
+    QuaternionBuffer<T> q{count}, r{count}, out{count};
+
+    for (auto _ : state)
+    {
+        nlerp(q.view(), r.view(), T{0.3}, out.view(), count);
+        benchmark::DoNotOptimize(out.x.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_QuaternionBatchNlerp, float)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_QuaternionBatchNlerp, double)->Arg(1024);
+
+template <typename T>
+void BM_QuaternionToRotationMatrices(benchmark::State &state)
+{
+    const std::size_t count{static_cast<std::size_t>(state.range(0))};
+    QuaternionBuffer<T> q{count};
+    std::vector<Matrix<T, 4, 4>> matrices(count);
+
+    for (auto _ : state)
+    {
+        toRotationMatrices(q.view(), matrices.data(), count);
+        benchmark::DoNotOptimize(matrices.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_QuaternionToRotationMatrices, float)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_QuaternionToRotationMatrices, double)->Arg(1024);
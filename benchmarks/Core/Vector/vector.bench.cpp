@@ -0,0 +1,154 @@
+#include "allocationCounter.h"
+#include <Core/Vector/point.h>
+#include <Core/Vector/vector.h>
+#include <benchmark/benchmark.h>
+
+using namespace MathLib;
+
+template <typename T, int size>
+void BM_VectorDot(benchmark::State &state)
+{
+    Vector<T, size> a{Vector<T, size>::random()};
+    const Vector<T, size> b{Vector<T, size>::random()};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(dot(a, b));
+    }
+}
+BENCHMARK_TEMPLATE(BM_VectorDot, float, 2);
+BENCHMARK_TEMPLATE(BM_VectorDot, float, 3);
+BENCHMARK_TEMPLATE(BM_VectorDot, float, 4);
+BENCHMARK_TEMPLATE(BM_VectorDot, double, 3);
+BENCHMARK_TEMPLATE(BM_VectorDot, double, 4);
+
+template <typename T>
+void BM_VectorCross(benchmark::State &state)
+{
+    Vector<T, 3> a{Vector<T, 3>::random()};
+    const Vector<T, 3> b{Vector<T, 3>::random()};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        Vector<T, 3> res{cross(a, b)};
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK_TEMPLATE(BM_VectorCross, float);
+BENCHMARK_TEMPLATE(BM_VectorCross, double);
+
+template <typename T, int size>
+void BM_VectorNormalize(benchmark::State &state)
+{
+    Vector<T, size> a{Vector<T, size>::random(T{0.5}, T{1})};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        Vector<T, size> res{normalize(a)};
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK_TEMPLATE(BM_VectorNormalize, float, 3);
+BENCHMARK_TEMPLATE(BM_VectorNormalize, float, 4);
+BENCHMARK_TEMPLATE(BM_VectorNormalize, double, 3);
+
+template <typename T>
+void BM_VectorReflect(benchmark::State &state)
+{
+    Vector<T, 3> v{Vector<T, 3>::random(T{-1}, T{1})};
+    const Vector<T, 3> n{normalize(Vector<T, 3>{0, 1, 0.25})};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(v);
+        Vector<T, 3> res{reflect(v, n)};
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK_TEMPLATE(BM_VectorReflect, float);
+BENCHMARK_TEMPLATE(BM_VectorReflect, double);
+
+template <typename T>
+void BM_VectorRefract(benchmark::State &state)
+{
+    Vector<T, 3> v{normalize(Vector<T, 3>{0.3, -1, 0.1})};
+    const Vector<T, 3> n{0, 1, 0};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(v);
+        Vector<T, 3> res{refract(v, n, 1.0 / 1.5)};
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK_TEMPLATE(BM_VectorRefract, float);
+BENCHMARK_TEMPLATE(BM_VectorRefract, double);
+
+template <typename T>
+void BM_AffineCombination(benchmark::State &state)
+{
+    Point<T, 3> a{Point<T, 3>::random()};
+    const Point<T, 3> b{Point<T, 3>::random()};
+    const Point<T, 3> c{Point<T, 3>::random()};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        Point<T, 3> res{affineCombination(0.2f, a, 0.3f, b, 0.5f, c)};
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK_TEMPLATE(BM_AffineCombination, float);
+BENCHMARK_TEMPLATE(BM_AffineCombination, double);
+
+// construction, copies and moves should compile down to a few register moves and never touch the heap
+template <typename T>
+void BM_VectorConstruct(benchmark::State &state)
+{
+    T value{1};
+
+    AllocationCounter allocations{state};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(value);
+        Vector<T, 3> vec{value, value, value};
+        benchmark::DoNotOptimize(vec);
+    }
+}
+BENCHMARK_TEMPLATE(BM_VectorConstruct, float);
+BENCHMARK_TEMPLATE(BM_VectorConstruct, double);
+
+template <typename T, int size>
+void BM_VectorCopy(benchmark::State &state)
+{
+    Vector<T, size> source{Vector<T, size>::random()};
+
+    AllocationCounter allocations{state};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(source);
+        Vector<T, size> copy{source};
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK_TEMPLATE(BM_VectorCopy, float, 3);
+BENCHMARK_TEMPLATE(BM_VectorCopy, double, 4);
+
+template <typename T, int size>
+void BM_VectorMove(benchmark::State &state)
+{
+    Vector<T, size> source{Vector<T, size>::random()};
+
+    AllocationCounter allocations{state};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(source);
+        Vector<T, size> moved{std::move(source)};
+        benchmark::DoNotOptimize(moved);
+    }
+}
+BENCHMARK_TEMPLATE(BM_VectorMove, float, 3);
+BENCHMARK_TEMPLATE(BM_VectorMove, double, 4);
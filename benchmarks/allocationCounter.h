@@ -0,0 +1,27 @@
+#ifndef MATHLIB_BENCHMARKS_ALLOCATION_COUNTER_H
+#define MATHLIB_BENCHMARKS_ALLOCATION_COUNTER_H
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+
+// number of calls to the global operator new since the start of the program
+std::size_t allocationCount();
+
+// counts the heap allocations made while the benchmark loop runs, reported per iteration as "allocations"
+class AllocationCounter
+{
+private:
+    benchmark::State &m_state;
+    std::size_t m_start;
+
+public:
+    explicit AllocationCounter(benchmark::State &state) : m_state(state), m_start(allocationCount()) {}
+
+    ~AllocationCounter()
+    {
+        m_state.counters["allocations"] = benchmark::Counter(static_cast<double>(allocationCount() - m_start),
+                                                             benchmark::Counter::kAvgIterations);
+    }
+};
+
+#endif
@@ -0,0 +1,152 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <random>
+#include <util/fastMath.h>
+#include <util/random.h>
+#include <vector>
+
+using namespace MathLib;
+
+template <typename T>
+void BM_RandomNumber(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Util::random_number<T>());
+    }
+}
+BENCHMARK_TEMPLATE(BM_RandomNumber, float);
+BENCHMARK_TEMPLATE(BM_RandomNumber, double);
+
+template <typename T>
+void BM_RandomNumberRange(benchmark::State &state)
+{
+    Util::Pcg32 engine{1};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Util::random_number<T>(T{-1}, T{1}, engine));
+    }
+}
+BENCHMARK_TEMPLATE(BM_RandomNumberRange, float);
+BENCHMARK_TEMPLATE(BM_RandomNumberRange, double);
+
+// the previous implementation, kept as a reference point
+template <typename T>
+void BM_RandomNumberMt19937(benchmark::State &state)
+{
+    std::mt19937 engine{};
+    std::uniform_real_distribution<T> distribution{0, 1};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(distribution(engine));
+    }
+}
+BENCHMARK_TEMPLATE(BM_RandomNumberMt19937, float);
+BENCHMARK_TEMPLATE(BM_RandomNumberMt19937, double);
+
+template <typename T>
+void BM_FillRandom(benchmark::State &state)
+{
+    std::vector<T> values(state.range(0));
+    Util::Pcg32 engine{1};
+
+    for (auto _ : state)
+    {
+        Util::fillRandom(values.data(), values.size(), engine);
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_FillRandom, float)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_FillRandom, double)->Arg(4096);
+
+// Fast approximations against <cmath> over float arrays, the loops vectorize only for the approximations
+template <bool fast>
+void BM_Rsqrt(benchmark::State &state)
+{
+    std::vector<float> values(state.range(0));
+    Util::fillRandom(values.data(), values.size(), 0.1f, 100.0f);
+    std::vector<float> results(values.size());
+
+    for (auto _ : state)
+    {
+        for (std::size_t i{0}; i < values.size(); ++i)
+        {
+            if constexpr (fast)
+            {
+                results[i] = Fast::rsqrt(values[i]);
+            }
+            else
+            {
+                results[i] = 1 / std::sqrt(values[i]);
+            }
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Rsqrt, false)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_Rsqrt, true)->Arg(4096);
+
+template <bool fast>
+void BM_SinCos(benchmark::State &state)
+{
+    std::vector<float> values(state.range(0));
+    Util::fillRandom(values.data(), values.size(), -10.0f, 10.0f);
+    std::vector<float> sines(values.size());
+    std::vector<float> cosines(values.size());
+
+    for (auto _ : state)
+    {
+        for (std::size_t i{0}; i < values.size(); ++i)
+        {
+            if constexpr (fast)
+            {
+                Fast::sincos(values[i], sines[i], cosines[i]);
+            }
+            else
+            {
+                sines[i] = std::sin(values[i]);
+                cosines[i] = std::cos(values[i]);
+            }
+        }
+        benchmark::DoNotOptimize(sines.data());
+        benchmark::DoNotOptimize(cosines.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_SinCos, false)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_SinCos, true)->Arg(4096);
+
+template <bool fast>
+void BM_Exp(benchmark::State &state)
+{
+    std::vector<float> values(state.range(0));
+    Util::fillRandom(values.data(), values.size(), -10.0f, 10.0f);
+    std::vector<float> results(values.size());
+
+    for (auto _ : state)
+    {
+        for (std::size_t i{0}; i < values.size(); ++i)
+        {
+            if constexpr (fast)
+            {
+                results[i] = Fast::exp(values[i]);
+            }
+            else
+            {
+                results[i] = std::exp(values[i]);
+            }
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Exp, false)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_Exp, true)->Arg(4096);
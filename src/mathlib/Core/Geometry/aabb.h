@@ -0,0 +1,192 @@
+#ifndef MATHLIB_CORE_GEOMETRY_AABB_TEMPLATE
+#define MATHLIB_CORE_GEOMETRY_AABB_TEMPLATE
+
+#include "../Vector/point.h"
+#include "../Vector/vector.h"
+#include "./ray.h"
+#include <cassert>
+#include <limits>
+#include <type_traits>
+
+namespace MathLib
+{
+/**
+ * Axis aligned box between the corners min and max (inclusive). A default constructed box is empty (min is the largest
+ * finite value of T, max the lowest one), extending it by points or other boxes yields their bounds.
+ **/
+template <typename T, int size>
+class AABB
+{
+private:
+    // min and max, indexable to pick the near or far corner of a ray without branching
+    Point<T, size> m_bounds[2];
+
+public:
+    AABB()
+    {
+        for (int i{0}; i < size; ++i)
+        {
+            m_bounds[0](i) = std::numeric_limits<T>::max();
+            m_bounds[1](i) = std::numeric_limits<T>::lowest();
+        }
+    }
+
+    AABB(const Point<T, size> &min, const Point<T, size> &max) : m_bounds{min, max} {}
+
+    // box that only contains point
+    explicit AABB(const Point<T, size> &point) : m_bounds{point, point} {}
+
+    const Point<T, size> &min() const { return m_bounds[0]; }
+
+    const Point<T, size> &max() const { return m_bounds[1]; }
+
+    // min (0) or max (1)
+    const Point<T, size> &operator[](int index) const { return m_bounds[index]; }
+
+    bool isEmpty() const
+    {
+        for (int i{0}; i < size; ++i)
+        {
+            if (m_bounds[0](i) > m_bounds[1](i))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    AABB &extend(const Point<T, size> &point)
+    {
+        for (int i{0}; i < size; ++i)
+        {
+            m_bounds[0](i) = point(i) < m_bounds[0](i) ? point(i) : m_bounds[0](i);
+            m_bounds[1](i) = point(i) > m_bounds[1](i) ? point(i) : m_bounds[1](i);
+        }
+
+        return *this;
+    }
+
+    AABB &extend(const AABB &other)
+    {
+        for (int i{0}; i < size; ++i)
+        {
+            m_bounds[0](i) = other.m_bounds[0](i) < m_bounds[0](i) ? other.m_bounds[0](i) : m_bounds[0](i);
+            m_bounds[1](i) = other.m_bounds[1](i) > m_bounds[1](i) ? other.m_bounds[1](i) : m_bounds[1](i);
+        }
+
+        return *this;
+    }
+
+    Vector<T, size> diagonal() const { return Vector<T, size>{m_bounds[1] - m_bounds[0]}; }
+
+    Point<T, size> center() const
+    {
+        Point<T, size> center;
+        for (int i{0}; i < size; ++i)
+        {
+            center(i) = (m_bounds[0](i) + m_bounds[1](i)) / 2;
+        }
+
+        return center;
+    }
+
+    // axis along which the box is the longest
+    int largestAxis() const
+    {
+        int axis{0};
+        for (int i{1}; i < size; ++i)
+        {
+            axis = m_bounds[1](i) - m_bounds[0](i) > m_bounds[1](axis) - m_bounds[0](axis) ? i : axis;
+        }
+
+        return axis;
+    }
+
+    // area of the surface of a three dimensional box, 0 for an empty one
+    T surfaceArea() const
+    {
+        static_assert(size == 3, "The surface area is only defined for three dimensional boxes");
+
+        if (isEmpty())
+        {
+            return T{0};
+        }
+
+        const Vector<T, 3> d{diagonal()};
+        return 2 * (d(0) * d(1) + d(1) * d(2) + d(2) * d(0));
+    }
+
+    bool contains(const Point<T, size> &point) const
+    {
+        for (int i{0}; i < size; ++i)
+        {
+            if (point(i) < m_bounds[0](i) || point(i) > m_bounds[1](i))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool overlaps(const AABB &other) const
+    {
+        for (int i{0}; i < size; ++i)
+        {
+            if (other.m_bounds[0](i) > m_bounds[1](i) || other.m_bounds[1](i) < m_bounds[0](i))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    friend bool operator==(const AABB &box1, const AABB &box2)
+    {
+        return box1.m_bounds[0] == box2.m_bounds[0] && box1.m_bounds[1] == box2.m_bounds[1];
+    }
+
+    friend bool operator!=(const AABB &box1, const AABB &box2) { return !(box1 == box2); }
+};
+
+template <typename T, int size>
+AABB<T, size> merge(const AABB<T, size> &box1, const AABB<T, size> &box2)
+{
+    AABB<T, size> box{box1};
+
+    return box.extend(box2);
+}
+
+/**
+ * Slab test: true if the ray hits the box at a distance in [tMin, tMax], tEnter is then the distance at which it
+ * enters the box (tMin if the origin lies inside). The near and far planes of each axis are picked with the cached
+ * direction signs and NaNs (a ray inside the plane of a face) are ignored by the comparisons, so there are no
+ * branches and rays along a face count as hits.
+ **/
+template <typename T>
+bool intersect(const Ray<T> &ray, const AABB<T, 3> &box, T tMin, T tMax, T &tEnter)
+{
+    for (int i{0}; i < 3; ++i)
+    {
+        const T tNear{(box[ray.isNegative(i)](i) - ray.origin()(i)) * ray.inverseDirection()(i)};
+        const T tFar{(box[1 - ray.isNegative(i)](i) - ray.origin()(i)) * ray.inverseDirection()(i)};
+        tMin = tNear > tMin ? tNear : tMin;
+        tMax = tFar < tMax ? tFar : tMax;
+    }
+
+    tEnter = tMin;
+    return tMin <= tMax;
+}
+
+template <typename T>
+bool intersect(const Ray<T> &ray, const AABB<T, 3> &box, T tMin, T tMax)
+{
+    T tEnter;
+
+    return intersect(ray, box, tMin, tMax, tEnter);
+}
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,692 @@
+#ifndef MATHLIB_CORE_GEOMETRY_BVH_TEMPLATE
+#define MATHLIB_CORE_GEOMETRY_BVH_TEMPLATE
+
+#include "../../util/threadPool.h"
+#include "./aabb.h"
+#include "./geometryPacket.h"
+#include "./ray.h"
+#include "./triangle.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace MathLib
+{
+struct BVHBuildOptions
+{
+    // number of bins along the split axis the surface area heuristic evaluates (at most 64)
+    int binCount{16};
+    // ranges with more primitives are always split
+    std::size_t maxLeafSize{4};
+    // cost of visiting a node relative to intersecting a primitive
+    float traversalCost{1.0f};
+    // BVH::update rebuilds the tree instead of refitting it once its SAH cost exceeds the cost right after the last
+    // build by this factor
+    float rebuildThreshold{1.5f};
+};
+
+namespace detail
+{
+// subtrees with more primitives are built in parallel
+constexpr std::size_t bvh_parallel_threshold{4096};
+// primitives per block when preparing the build in parallel
+constexpr std::size_t bvh_parallel_grain{16384};
+// upper limit of BVHBuildOptions::binCount
+constexpr int bvh_max_bins{64};
+// wide nodes per block when refitting a level of the tree in parallel
+constexpr std::size_t bvh_refit_grain{256};
+// the binary tree never gets deeper than this, which bounds the traversal stack
+constexpr int bvh_max_depth{64};
+} // namespace detail
+
+/**
+ * Bounding volume hierarchy over primitives given by their bounds (triangles or anything else the caller can
+ * intersect). The tree is built top down with the binned surface area heuristic, big subtrees are built in parallel
+ * on the thread pool (see util/threadPool.h). The binary tree is then collapsed into nodes with up to width children
+ * (BVH4 or BVH8), whose bounds are tested against a ray at once (see AABBPacket) during the stack based traversal.
+ *
+ * The nodes lie in one array in depth first order, child references are indices into it or, for leaves, ranges of
+ * the primitive index array.
+ *
+ * For animated geometry refit() recomputes the bounds of all nodes bottom up (level by level in parallel) while
+ * keeping the tree, which is much cheaper than a build but lets the tree degrade as primitives move apart. The tree
+ * tracks its SAH cost (expected cost of a random ray relative to intersecting one primitive) and update() rebuilds it
+ * once the cost grew past BVHBuildOptions::rebuildThreshold times the cost after the last build.
+ **/
+template <typename T, int width = 4>
+class BVH
+{
+    static_assert(width >= 2 && width <= 8, "BVH nodes have between 2 and 8 children");
+
+public:
+    static constexpr std::uint32_t no_hit{~std::uint32_t{0}};
+
+    // child i is an inner node (count[i] == 0, child[i] is its index) or a leaf with the primitives
+    // primitives()[child[i]] to primitives()[child[i] + count[i] - 1], unused slots have empty bounds and child[i] ==
+    // count[i] == 0 (the root is no child)
+    struct Node
+    {
+        AABBPacket<T, width> bounds;
+        std::uint32_t child[width];
+        std::uint32_t count[width];
+    };
+
+private:
+    // node of the binary tree which is built first, leaves have a count
+    struct BuildNode
+    {
+        AABB<T, 3> bounds;
+        std::uint32_t left;
+        std::uint32_t right;
+        std::uint32_t first;
+        std::uint32_t count;
+    };
+
+    struct Bin
+    {
+        AABB<T, 3> bounds;
+        std::size_t count{0};
+    };
+
+    struct BuildState
+    {
+        const AABB<T, 3> *bounds;
+        std::vector<Point<T, 3>> centroids;
+        std::vector<BuildNode> nodes;
+        std::atomic<std::uint32_t> nodeCount{0};
+        BVHBuildOptions options;
+    };
+
+    // referenced by the stack during traversal: the root, an inner node or a leaf
+    struct StackEntry
+    {
+        std::uint32_t child;
+        std::uint32_t count;
+        T tEnter;
+    };
+
+    static constexpr int stack_size{detail::bvh_max_depth * (width - 1) + 1};
+
+    std::vector<Node> m_nodes;
+    std::vector<std::uint32_t> m_primitives;
+    // indices of the nodes at each depth, refitted from the deepest level up
+    std::vector<std::vector<std::uint32_t>> m_levels;
+    AABB<T, 3> m_bounds;
+    BVHBuildOptions m_options;
+    T m_cost{0};
+    T m_buildCost{0};
+
+public:
+    BVH() = default;
+
+    BVH(const AABB<T, 3> *bounds, std::size_t count, const BVHBuildOptions &options = BVHBuildOptions{})
+    {
+        build(bounds, count, options);
+    }
+
+    BVH(const Triangle<T> *triangles, std::size_t count, const BVHBuildOptions &options = BVHBuildOptions{})
+    {
+        build(triangles, count, options);
+    }
+
+    // rebuilds the tree over count primitives with the given bounds
+    void build(const AABB<T, 3> *bounds, std::size_t count, const BVHBuildOptions &options = BVHBuildOptions{})
+    {
+        m_nodes.clear();
+        m_levels.clear();
+        m_primitives.resize(count);
+        m_bounds = AABB<T, 3>{};
+        m_options = options;
+        m_cost = 0;
+        m_buildCost = 0;
+        if (count == 0)
+        {
+            return;
+        }
+
+        BuildState state;
+        state.bounds = bounds;
+        state.centroids.resize(count);
+        state.nodes.resize(2 * count - 1);
+        state.options = options;
+        Util::parallelFor(0, count, detail::bvh_parallel_grain, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i{begin}; i < end; ++i)
+            {
+                m_primitives[i] = static_cast<std::uint32_t>(i);
+                state.centroids[i] = bounds[i].center();
+            }
+        });
+
+        state.nodeCount.store(1, std::memory_order_relaxed);
+        buildNode(state, 0, 0, count, 0);
+        m_bounds = state.nodes[0].bounds;
+
+        m_nodes.reserve(state.nodeCount.load(std::memory_order_relaxed) / 2 + 1);
+        collapse(state.nodes, 0, 0);
+
+        m_cost = computeCost();
+        m_buildCost = m_cost;
+    }
+
+    void build(const Triangle<T> *triangles, std::size_t count, const BVHBuildOptions &options = BVHBuildOptions{})
+    {
+        std::vector<AABB<T, 3>> bounds(count);
+        Util::parallelFor(0, count, detail::bvh_parallel_grain, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i{begin}; i < end; ++i)
+            {
+                bounds[i] = triangles[i].bounds();
+            }
+        });
+
+        build(bounds.data(), count, options);
+    }
+
+    /**
+     * Recomputes the bounds of all nodes from the new bounds of the primitives the tree was built over (same count and
+     * order, e.g. the triangles of a skinned mesh after transforming their vertices with transformPoints) without
+     * changing the tree.
+     **/
+    void refit(const AABB<T, 3> *bounds)
+    {
+        refitWith([bounds](std::uint32_t primitive) { return bounds[primitive]; });
+    }
+
+    void refit(const Triangle<T> *triangles)
+    {
+        refitWith([triangles](std::uint32_t primitive) { return triangles[primitive].bounds(); });
+    }
+
+    // refits the tree or rebuilds it if the refitted tree got too slow or the number of primitives changed, returns
+    // true if it was rebuilt
+    bool update(const AABB<T, 3> *bounds, std::size_t count)
+    {
+        if (count == m_primitives.size())
+        {
+            refit(bounds);
+            if (!needsRebuild())
+            {
+                return false;
+            }
+        }
+
+        build(bounds, count, m_options);
+        return true;
+    }
+
+    bool update(const Triangle<T> *triangles, std::size_t count)
+    {
+        if (count == m_primitives.size())
+        {
+            refit(triangles);
+            if (!needsRebuild())
+            {
+                return false;
+            }
+        }
+
+        build(triangles, count, m_options);
+        return true;
+    }
+
+    // the SAH cost of the tree in its current state and right after the last build
+    T sahCost() const { return m_cost; }
+
+    T buildSahCost() const { return m_buildCost; }
+
+    // true if refits made the tree more expensive to traverse than the rebuild threshold allows
+    bool needsRebuild() const { return m_cost > m_options.rebuildThreshold * m_buildCost; }
+
+    const BVHBuildOptions &options() const { return m_options; }
+
+    bool empty() const { return m_primitives.empty(); }
+
+    const AABB<T, 3> &bounds() const { return m_bounds; }
+
+    const std::vector<Node> &nodes() const { return m_nodes; }
+
+    // the primitive indices in the order the leaves reference them
+    const std::vector<std::uint32_t> &primitives() const { return m_primitives; }
+
+    /**
+     * Finds the primitive closest to the origin of the ray in [tMin, tMax]. intersect(primitive, tMin, tMax) is called
+     * for the primitives in the leaves the ray reaches, it has to return true and set tMax to the distance of the
+     * intersection if the ray hits the primitive in [tMin, tMax]. Returns the index of the closest primitive (tMax is
+     * its distance then) or no_hit.
+     **/
+    template <typename Intersect>
+    std::uint32_t closestHit(const Ray<T> &ray, T tMin, T &tMax, const Intersect &intersect) const
+    {
+        std::uint32_t closest{no_hit};
+        traverse<false>(ray, tMin, tMax, [&](std::uint32_t primitive, T &tFar) {
+            if (intersect(primitive, tMin, tFar))
+            {
+                closest = primitive;
+            }
+
+            return false;
+        });
+
+        return closest;
+    }
+
+    // true if the ray hits any primitive in [tMin, tMax] (e.g. for shadow rays), stops at the first one it finds
+    template <typename Intersect>
+    bool anyHit(const Ray<T> &ray, T tMin, T tMax, const Intersect &intersect) const
+    {
+        bool hit{false};
+        traverse<true>(ray, tMin, tMax, [&](std::uint32_t primitive, T &tFar) {
+            hit = intersect(primitive, tMin, tFar);
+            return hit;
+        });
+
+        return hit;
+    }
+
+private:
+    template <bool stopAtHit, typename Visit>
+    void traverse(const Ray<T> &ray, T tMin, T &tMax, const Visit &visit) const
+    {
+        if (m_nodes.empty())
+        {
+            return;
+        }
+
+        StackEntry stack[stack_size];
+        int size{0};
+        stack[size++] = StackEntry{0, 0, tMin};
+
+        while (size > 0)
+        {
+            const StackEntry entry{stack[--size]};
+            // the subtree lies beyond the closest intersection found in the mean time
+            if (entry.tEnter > tMax)
+            {
+                continue;
+            }
+
+            if (entry.count)
+            {
+                for (std::uint32_t i{entry.child}; i < entry.child + entry.count; ++i)
+                {
+                    if (visit(m_primitives[i], tMax) && stopAtHit)
+                    {
+                        return;
+                    }
+                }
+                continue;
+            }
+
+            const Node &node{m_nodes[entry.child]};
+            Packet<T, width> tEnter;
+            int hits{intersect(ray, node.bounds, Packet<T, width>{tMin}, Packet<T, width>{tMax}, tEnter).bits()};
+
+            // pushed farthest first so that the nearest child is visited next
+            const int first{size};
+            while (hits)
+            {
+                const int lane{std::countr_zero(static_cast<unsigned int>(hits))};
+                hits &= hits - 1;
+
+                const StackEntry child{node.child[lane], node.count[lane], tEnter[lane]};
+                int position{size++};
+                for (; position > first && stack[position - 1].tEnter < child.tEnter; --position)
+                {
+                    stack[position] = stack[position - 1];
+                }
+                stack[position] = child;
+            }
+        }
+    }
+
+    // bounds of count primitives and of their centroids
+    static void rangeBounds(const BuildState &state,
+                            const std::uint32_t *primitives,
+                            std::size_t count,
+                            AABB<T, 3> &bounds,
+                            AABB<T, 3> &centroidBounds)
+    {
+        for (std::size_t i{0}; i < count; ++i)
+        {
+            bounds.extend(state.bounds[primitives[i]]);
+            centroidBounds.extend(state.centroids[primitives[i]]);
+        }
+    }
+
+    void buildNode(BuildState &state, std::uint32_t index, std::size_t begin, std::size_t end, int depth)
+    {
+        BuildNode &node{state.nodes[index]};
+        const std::size_t count{end - begin};
+        std::uint32_t *primitives{m_primitives.data() + begin};
+
+        AABB<T, 3> centroidBounds;
+        node.bounds = AABB<T, 3>{};
+        rangeBounds(state, primitives, count, node.bounds, centroidBounds);
+
+        const auto makeLeaf = [&]() {
+            node.first = static_cast<std::uint32_t>(begin);
+            node.count = static_cast<std::uint32_t>(count);
+        };
+
+        if (count == 1)
+        {
+            makeLeaf();
+            return;
+        }
+
+        const int axis{centroidBounds.largestAxis()};
+        const T extent{centroidBounds.max()(axis) - centroidBounds.min()(axis)};
+        // close to the depth limit the ranges are halved, which keeps the depth below it
+        int levelsLeft{0};
+        while ((std::size_t{1} << levelsLeft) < count)
+        {
+            ++levelsLeft;
+        }
+        const bool forceMedian{depth + levelsLeft >= detail::bvh_max_depth - 1};
+
+        std::size_t middle{begin + count / 2};
+        if (extent > 0 && !forceMedian && node.bounds.surfaceArea() > 0)
+        {
+            const int binCount{std::clamp(state.options.binCount, 2, detail::bvh_max_bins)};
+            const T origin{centroidBounds.min()(axis)};
+            const T scale{binCount / extent};
+            // clamped before the conversion: for a denormal extent scale is infinite and the bin inf or NaN
+            const auto binOf = [&](std::uint32_t primitive) {
+                const T bin{(state.centroids[primitive](axis) - origin) * scale};
+                return bin > 0 ? static_cast<int>(std::min(bin, static_cast<T>(binCount - 1))) : 0;
+            };
+
+            Bin bins[detail::bvh_max_bins];
+            for (std::size_t i{0}; i < count; ++i)
+            {
+                Bin &bin{bins[binOf(primitives[i])]};
+                bin.bounds.extend(state.bounds[primitives[i]]);
+                ++bin.count;
+            }
+
+            // surface areas and counts right of each split, then the cost of each split from left to right
+            T rightArea[detail::bvh_max_bins];
+            std::size_t rightCount[detail::bvh_max_bins];
+            AABB<T, 3> right;
+            std::size_t rightPrimitives{0};
+            for (int i{binCount - 1}; i > 0; --i)
+            {
+                right.extend(bins[i].bounds);
+                rightPrimitives += bins[i].count;
+                rightArea[i] = right.surfaceArea();
+                rightCount[i] = rightPrimitives;
+            }
+
+            AABB<T, 3> left;
+            std::size_t leftPrimitives{0};
+            T bestCost{0};
+            int bestSplit{-1};
+            for (int i{0}; i < binCount - 1; ++i)
+            {
+                left.extend(bins[i].bounds);
+                leftPrimitives += bins[i].count;
+                if (leftPrimitives == 0 || rightCount[i + 1] == 0)
+                {
+                    continue;
+                }
+
+                const T cost{left.surfaceArea() * leftPrimitives + rightArea[i + 1] * rightCount[i + 1]};
+                if (bestSplit < 0 || cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestSplit = i;
+                }
+            }
+
+            // the primitives with the smallest and the largest centroid always end up in different bins
+            assert("No split found for distinct centroids" && bestSplit >= 0);
+
+            const T splitCost{state.options.traversalCost + bestCost / node.bounds.surfaceArea()};
+            if (count <= state.options.maxLeafSize && static_cast<T>(count) <= splitCost)
+            {
+                makeLeaf();
+                return;
+            }
+
+            middle = static_cast<std::size_t>(
+                std::partition(primitives, primitives + count, [&](std::uint32_t p) { return binOf(p) <= bestSplit; }) -
+                m_primitives.data());
+        }
+        else if (count <= state.options.maxLeafSize)
+        {
+            makeLeaf();
+            return;
+        }
+        else
+        {
+            // all centroids coincide (or the depth limit is close): split the range in halves
+            std::nth_element(primitives,
+                             m_primitives.data() + middle,
+                             primitives + count,
+                             [&](std::uint32_t p1, std::uint32_t p2) {
+                                 return state.centroids[p1](axis) < state.centroids[p2](axis);
+                             });
+        }
+
+        node.count = 0;
+        node.left = state.nodeCount.fetch_add(2, std::memory_order_relaxed);
+        node.right = node.left + 1;
+
+        const std::uint32_t left{node.left};
+        const std::uint32_t right{node.right};
+        if (count > detail::bvh_parallel_threshold)
+        {
+            Util::parallelFor(0, 2, 1, [&](std::size_t first, std::size_t last) {
+                for (std::size_t i{first}; i < last; ++i)
+                {
+                    if (i == 0)
+                    {
+                        buildNode(state, left, begin, middle, depth + 1);
+                    }
+                    else
+                    {
+                        buildNode(state, right, middle, end, depth + 1);
+                    }
+                }
+            });
+        }
+        else
+        {
+            buildNode(state, left, begin, middle, depth + 1);
+            buildNode(state, right, middle, end, depth + 1);
+        }
+    }
+
+    // union of the bounds of the used children of a node
+    static AABB<T, 3> nodeBounds(const Node &node)
+    {
+        AABB<T, 3> bounds;
+        for (int i{0}; i < width; ++i)
+        {
+            if (node.child[i] || node.count[i])
+            {
+                bounds.extend(node.bounds.get(i));
+            }
+        }
+
+        return bounds;
+    }
+
+    template <typename BoundsOf>
+    void refitWith(const BoundsOf &boundsOf)
+    {
+        // the children of a node are one level deeper, so the nodes of a level can be refitted independently
+        for (std::size_t level{m_levels.size()}; level-- > 0;)
+        {
+            const std::vector<std::uint32_t> &nodes{m_levels[level]};
+            Util::parallelFor(0, nodes.size(), detail::bvh_refit_grain, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i{begin}; i < end; ++i)
+                {
+                    Node &node{m_nodes[nodes[i]]};
+                    for (int slot{0}; slot < width; ++slot)
+                    {
+                        if (node.count[slot])
+                        {
+                            AABB<T, 3> bounds;
+                            for (std::uint32_t j{node.child[slot]}; j < node.child[slot] + node.count[slot]; ++j)
+                            {
+                                bounds.extend(boundsOf(m_primitives[j]));
+                            }
+                            node.bounds.set(slot, bounds);
+                        }
+                        else if (node.child[slot])
+                        {
+                            node.bounds.set(slot, nodeBounds(m_nodes[node.child[slot]]));
+                        }
+                    }
+                }
+            });
+        }
+
+        if (!m_nodes.empty())
+        {
+            m_bounds = nodeBounds(m_nodes[0]);
+        }
+        m_cost = computeCost();
+    }
+
+    // sum of the surface areas of the nodes times the traversal cost and of the leaves times their primitive count,
+    // relative to the surface area of the root
+    T computeCost() const
+    {
+        const T rootArea{m_bounds.surfaceArea()};
+        if (m_nodes.empty() || rootArea <= 0)
+        {
+            return T{0};
+        }
+
+        std::mutex mutex;
+        T cost{0};
+        Util::parallelFor(0, m_nodes.size(), detail::bvh_refit_grain, [&](std::size_t begin, std::size_t end) {
+            T blockCost{0};
+            for (std::size_t i{begin}; i < end; ++i)
+            {
+                const Node &node{m_nodes[i]};
+                blockCost += m_options.traversalCost * nodeBounds(node).surfaceArea();
+                for (int slot{0}; slot < width; ++slot)
+                {
+                    blockCost += node.count[slot] * node.bounds.get(slot).surfaceArea();
+                }
+            }
+
+            std::lock_guard<std::mutex> lock{mutex};
+            cost += blockCost;
+        });
+
+        return cost / rootArea;
+    }
+
+    // appends the wide node for the binary node index (and its subtree) at the given depth and returns its index
+    std::uint32_t collapse(const std::vector<BuildNode> &nodes, std::uint32_t index, std::size_t depth)
+    {
+        // pulls the children of the inner child with the largest surface area up until the node is full
+        std::uint32_t children[width];
+        int childCount{0};
+        if (nodes[index].count)
+        {
+            children[childCount++] = index;
+        }
+        else
+        {
+            children[childCount++] = nodes[index].left;
+            children[childCount++] = nodes[index].right;
+        }
+
+        while (childCount < width)
+        {
+            int largest{-1};
+            for (int i{0}; i < childCount; ++i)
+            {
+                if (nodes[children[i]].count == 0 &&
+                    (largest < 0 ||
+                     nodes[children[i]].bounds.surfaceArea() > nodes[children[largest]].bounds.surfaceArea()))
+                {
+                    largest = i;
+                }
+            }
+            if (largest < 0)
+            {
+                break;
+            }
+
+            const BuildNode &expanded{nodes[children[largest]]};
+            children[largest] = expanded.left;
+            children[childCount++] = expanded.right;
+        }
+
+        const std::uint32_t nodeIndex{static_cast<std::uint32_t>(m_nodes.size())};
+        m_nodes.emplace_back();
+        if (m_levels.size() <= depth)
+        {
+            m_levels.resize(depth + 1);
+        }
+        m_levels[depth].push_back(nodeIndex);
+        for (int i{0}; i < width; ++i)
+        {
+            m_nodes[nodeIndex].child[i] = 0;
+            m_nodes[nodeIndex].count[i] = 0;
+        }
+
+        for (int i{0}; i < childCount; ++i)
+        {
+            const BuildNode &child{nodes[children[i]]};
+            m_nodes[nodeIndex].bounds.set(i, child.bounds);
+            // the vector may grow while collapsing the child, so the node is only accessed by index
+            const std::uint32_t childIndex{child.count ? child.first : collapse(nodes, children[i], depth + 1)};
+            m_nodes[nodeIndex].child[i] = childIndex;
+            m_nodes[nodeIndex].count[i] = child.count;
+        }
+
+        return nodeIndex;
+    }
+};
+
+template <typename T>
+using BVH4 = BVH<T, 4>;
+
+template <typename T>
+using BVH8 = BVH<T, 8>;
+
+// closest triangle the ray hits in [tMin, tMax] with the BVH built over the triangles, BVH<T, width>::no_hit if none
+template <typename T, int width>
+std::uint32_t intersectClosest(const BVH<T, width> &bvh,
+                               const Triangle<T> *triangles,
+                               const Ray<T> &ray,
+                               T tMin,
+                               T tMax,
+                               TriangleHit<T> &hit)
+{
+    return bvh.closestHit(ray, tMin, tMax, [&](std::uint32_t triangle, T from, T &to) {
+        TriangleHit<T> candidate;
+        if (intersect(ray, triangles[triangle], from, to, candidate))
+        {
+            hit = candidate;
+            to = candidate.t;
+            return true;
+        }
+
+        return false;
+    });
+}
+
+// true if the ray hits any of the triangles in [tMin, tMax]
+template <typename T, int width>
+bool intersectAny(const BVH<T, width> &bvh, const Triangle<T> *triangles, const Ray<T> &ray, T tMin, T tMax)
+{
+    return bvh.anyHit(ray, tMin, tMax, [&](std::uint32_t triangle, T from, T &to) {
+        TriangleHit<T> candidate;
+        return intersect(ray, triangles[triangle], from, to, candidate);
+    });
+}
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,296 @@
+#ifndef MATHLIB_CORE_GEOMETRY_GEOMETRY_PACKET_TEMPLATE
+#define MATHLIB_CORE_GEOMETRY_GEOMETRY_PACKET_TEMPLATE
+
+#include "../../util/packet.h"
+#include "../Vector/vectorPacket.h"
+#include "./aabb.h"
+#include "./ray.h"
+#include "./triangle.h"
+#include <cassert>
+#include <limits>
+
+namespace MathLib
+{
+// The intersection tests of aabb.h and triangle.h for width rays (coherent rays, e.g. the primary rays of a pixel
+// block) against one primitive, and for one ray against width primitives (the children of a wide BVH node). Lanes
+// are stored as structure of arrays (see Vector3Packet), the tests return a mask of the lanes that hit.
+
+// width rays, lane i of origin, direction and inverseDirection form the i-th ray
+template <typename T, int width>
+class RayPacket
+{
+public:
+    using packet_type = Packet<T, width>;
+    using mask_type = typename packet_type::mask_type;
+
+    Vector3Packet<T, width> origin;
+    Vector3Packet<T, width> direction;
+    Vector3Packet<T, width> inverseDirection;
+
+    RayPacket() = default;
+
+    RayPacket(const Vector3Packet<T, width> &origin, const Vector3Packet<T, width> &direction)
+        : origin{origin}, direction{direction}, inverseDirection{packet_type{1} / direction.x,
+                                                                 packet_type{1} / direction.y,
+                                                                 packet_type{1} / direction.z}
+    {
+    }
+
+    // gathers width consecutive rays
+    static RayPacket load(const Ray<T> *rays)
+    {
+        RayPacket packet;
+        for (int lane{0}; lane < width; ++lane)
+        {
+            packet.set(lane, rays[lane]);
+        }
+
+        return packet;
+    }
+
+    static constexpr int size() { return width; }
+
+    Ray<T> get(int lane) const
+    {
+        const Vector<T, 3> o{origin.get(lane)};
+
+        return Ray<T>{Point<T, 3>{o(0), o(1), o(2)}, direction.get(lane)};
+    }
+
+    void set(int lane, const Ray<T> &ray)
+    {
+        origin.set(lane, Vector<T, 3>{ray.origin()(0), ray.origin()(1), ray.origin()(2)});
+        direction.set(lane, ray.direction());
+        inverseDirection.set(lane, ray.inverseDirection());
+    }
+};
+
+// width boxes, e.g. the children of a BVH node
+template <typename T, int width>
+class AABBPacket
+{
+public:
+    using packet_type = Packet<T, width>;
+    using mask_type = typename packet_type::mask_type;
+
+    // min (0) and max (1) corners, indexable like the corners of an AABB
+    Vector3Packet<T, width> bounds[2];
+
+    // width empty boxes (like a default constructed AABB), which no ray hits
+    AABBPacket()
+        : bounds{Vector3Packet<T, width>{Vector<T, 3>{std::numeric_limits<T>::max(),
+                                                     std::numeric_limits<T>::max(),
+                                                     std::numeric_limits<T>::max()}},
+                 Vector3Packet<T, width>{Vector<T, 3>{std::numeric_limits<T>::lowest(),
+                                                     std::numeric_limits<T>::lowest(),
+                                                     std::numeric_limits<T>::lowest()}}}
+    {
+    }
+
+    static constexpr int size() { return width; }
+
+    AABB<T, 3> get(int lane) const
+    {
+        const Vector<T, 3> min{bounds[0].get(lane)};
+        const Vector<T, 3> max{bounds[1].get(lane)};
+
+        return AABB<T, 3>{Point<T, 3>{min(0), min(1), min(2)}, Point<T, 3>{max(0), max(1), max(2)}};
+    }
+
+    void set(int lane, const AABB<T, 3> &box)
+    {
+        bounds[0].set(lane, Vector<T, 3>{box.min()(0), box.min()(1), box.min()(2)});
+        bounds[1].set(lane, Vector<T, 3>{box.max()(0), box.max()(1), box.max()(2)});
+    }
+};
+
+// width triangles stored as the first vertex and the two edges, which is what the Möller–Trumbore test uses
+template <typename T, int width>
+class TrianglePacket
+{
+public:
+    using packet_type = Packet<T, width>;
+    using mask_type = typename packet_type::mask_type;
+
+    Vector3Packet<T, width> v0;
+    Vector3Packet<T, width> edge1;
+    Vector3Packet<T, width> edge2;
+
+    // width degenerate triangles, which no ray hits
+    TrianglePacket() : v0{Vector<T, 3>{}}, edge1{Vector<T, 3>{}}, edge2{Vector<T, 3>{}} {}
+
+    static TrianglePacket load(const Triangle<T> *triangles)
+    {
+        TrianglePacket packet;
+        for (int lane{0}; lane < width; ++lane)
+        {
+            packet.set(lane, triangles[lane]);
+        }
+
+        return packet;
+    }
+
+    static constexpr int size() { return width; }
+
+    void set(int lane, const Triangle<T> &triangle)
+    {
+        v0.set(lane, Vector<T, 3>{triangle[0](0), triangle[0](1), triangle[0](2)});
+        edge1.set(lane, triangle.edge1());
+        edge2.set(lane, triangle.edge2());
+    }
+};
+
+template <typename T, int width>
+struct TriangleHitPacket
+{
+    Packet<T, width> t;
+    Packet<T, width> u;
+    Packet<T, width> v;
+};
+
+namespace detail
+{
+template <typename T, int width>
+const Packet<T, width> &component(const Vector3Packet<T, width> &vector, int axis)
+{
+    return axis == 0 ? vector.x : axis == 1 ? vector.y : vector.z;
+}
+
+// shrinks [tMin, tMax] to the part inside the slab between the planes at tNear and tFar, NaNs leave it unchanged
+template <typename T, int width>
+void clipSlab(const Packet<T, width> &tNear,
+              const Packet<T, width> &tFar,
+              Packet<T, width> &tMin,
+              Packet<T, width> &tMax)
+{
+    tMin = select(tNear > tMin, tNear, tMin);
+    tMax = select(tFar < tMax, tFar, tMax);
+}
+
+// lane-wise Möller–Trumbore test of rays (o, d) against triangles (v0, edge1, edge2)
+template <typename T, int width>
+typename Packet<T, width>::mask_type intersectTriangles(const Vector3Packet<T, width> &o,
+                                                        const Vector3Packet<T, width> &d,
+                                                        const Vector3Packet<T, width> &v0,
+                                                        const Vector3Packet<T, width> &edge1,
+                                                        const Vector3Packet<T, width> &edge2,
+                                                        const Packet<T, width> &tMin,
+                                                        const Packet<T, width> &tMax,
+                                                        TriangleHitPacket<T, width> &hit)
+{
+    using packet_type = Packet<T, width>;
+
+    const Vector3Packet<T, width> p{cross(d, edge2)};
+    const packet_type determinant{dot(edge1, p)};
+    const packet_type inverseDeterminant{packet_type{1} / determinant};
+
+    const Vector3Packet<T, width> s{o - v0};
+    const Vector3Packet<T, width> q{cross(s, edge1)};
+    hit.u = dot(s, p) * inverseDeterminant;
+    hit.v = dot(d, q) * inverseDeterminant;
+    hit.t = dot(edge2, q) * inverseDeterminant;
+
+    const packet_type zero{0};
+    return ((determinant < zero) | (determinant > zero)) & (hit.u >= zero) & (hit.v >= zero) &
+           (hit.u + hit.v <= packet_type{1}) & (hit.t > tMin) & (hit.t < tMax);
+}
+} // namespace detail
+
+// lane-wise slab test of the rays against one box, tEnter holds the entry distances of the lanes that hit
+template <typename T, int width>
+typename Packet<T, width>::mask_type intersect(const RayPacket<T, width> &rays,
+                                               const AABB<T, 3> &box,
+                                               Packet<T, width> tMin,
+                                               Packet<T, width> tMax,
+                                               Packet<T, width> &tEnter)
+{
+    using packet_type = Packet<T, width>;
+
+    const packet_type zero{0};
+    for (int i{0}; i < 3; ++i)
+    {
+        const packet_type &origin{detail::component(rays.origin, i)};
+        const packet_type &inverse{detail::component(rays.inverseDirection, i)};
+        const packet_type t0{(packet_type{box.min()(i)} - origin) * inverse};
+        const packet_type t1{(packet_type{box.max()(i)} - origin) * inverse};
+
+        // the lanes differ in direction, so near and far are picked per lane
+        const typename packet_type::mask_type negative{inverse < zero};
+        detail::clipSlab(select(negative, t1, t0), select(negative, t0, t1), tMin, tMax);
+    }
+
+    tEnter = tMin;
+    return tMin <= tMax;
+}
+
+// slab test of one ray against width boxes
+template <typename T, int width>
+typename Packet<T, width>::mask_type intersect(const Ray<T> &ray,
+                                               const AABBPacket<T, width> &boxes,
+                                               Packet<T, width> tMin,
+                                               Packet<T, width> tMax,
+                                               Packet<T, width> &tEnter)
+{
+    using packet_type = Packet<T, width>;
+
+    for (int i{0}; i < 3; ++i)
+    {
+        const packet_type origin{ray.origin()(i)};
+        const packet_type inverse{ray.inverseDirection()(i)};
+        const packet_type tNear{(detail::component(boxes.bounds[ray.isNegative(i)], i) - origin) * inverse};
+        const packet_type tFar{(detail::component(boxes.bounds[1 - ray.isNegative(i)], i) - origin) * inverse};
+        detail::clipSlab(tNear, tFar, tMin, tMax);
+    }
+
+    tEnter = tMin;
+    return tMin <= tMax;
+}
+
+// lane-wise Möller–Trumbore test of the rays against one triangle
+template <typename T, int width>
+typename Packet<T, width>::mask_type intersect(const RayPacket<T, width> &rays,
+                                               const Triangle<T> &triangle,
+                                               const Packet<T, width> &tMin,
+                                               const Packet<T, width> &tMax,
+                                               TriangleHitPacket<T, width> &hit)
+{
+    const Vector<T, 3> v0{triangle[0](0), triangle[0](1), triangle[0](2)};
+
+    return detail::intersectTriangles(rays.origin,
+                                      rays.direction,
+                                      Vector3Packet<T, width>{v0},
+                                      Vector3Packet<T, width>{triangle.edge1()},
+                                      Vector3Packet<T, width>{triangle.edge2()},
+                                      tMin,
+                                      tMax,
+                                      hit);
+}
+
+// Möller–Trumbore test of one ray against width triangles
+template <typename T, int width>
+typename Packet<T, width>::mask_type intersect(const Ray<T> &ray,
+                                               const TrianglePacket<T, width> &triangles,
+                                               const Packet<T, width> &tMin,
+                                               const Packet<T, width> &tMax,
+                                               TriangleHitPacket<T, width> &hit)
+{
+    const Vector<T, 3> origin{ray.origin()(0), ray.origin()(1), ray.origin()(2)};
+
+    return detail::intersectTriangles(Vector3Packet<T, width>{origin},
+                                      Vector3Packet<T, width>{ray.direction()},
+                                      triangles.v0,
+                                      triangles.edge1,
+                                      triangles.edge2,
+                                      tMin,
+                                      tMax,
+                                      hit);
+}
+
+template <typename T>
+using RayPacket4 = RayPacket<T, 4>;
+
+template <typename T>
+using RayPacket8 = RayPacket<T, 8>;
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,339 @@
+#ifndef MATHLIB_CORE_GEOMETRY_HASH_GRID_TEMPLATE
+#define MATHLIB_CORE_GEOMETRY_HASH_GRID_TEMPLATE
+
+#include "../../util/threadPool.h"
+#include "../Vector/point.h"
+#include "./neighbors.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace MathLib
+{
+namespace detail
+{
+// points per block when computing the cells of the points in parallel
+constexpr std::size_t hash_grid_parallel_grain{16384};
+} // namespace detail
+
+/**
+ * Uniform grid of cubic cells over an array of points of any dimension, stored sparsely in a hash table: the points
+ * are sorted by the bucket of their cell (a counting sort), so every bucket is one range of points. Cells that share a
+ * bucket are told apart by recomputing the cell of each candidate point.
+ *
+ * Radius queries visit the cells the sphere touches, nearest neighbour queries visit rings of cells around the query
+ * until no unvisited cell can hold a closer point. Both are fastest when the cell size is in the order of the query
+ * radius (or the distance of the k-th neighbour). The batched queries run on the thread pool.
+ **/
+template <typename T, int size>
+class HashGrid
+{
+private:
+    using Cell = std::int64_t[size];
+
+    T m_cellSize{1};
+    T m_inverseCellSize{1};
+    std::size_t m_bucketMask{0};
+    // the points of bucket b are m_points[m_bucketStart[b]] to m_points[m_bucketStart[b + 1] - 1]
+    std::vector<std::uint32_t> m_bucketStart;
+    std::vector<Point<T, size>> m_points;
+    std::vector<std::uint32_t> m_indices;
+    // range of the occupied cells
+    std::int64_t m_minCell[size];
+    std::int64_t m_maxCell[size];
+
+public:
+    HashGrid() = default;
+
+    HashGrid(const Point<T, size> *points, std::size_t count, T cellSize) { build(points, count, cellSize); }
+
+    void build(const Point<T, size> *points, std::size_t count, T cellSize)
+    {
+        assert("The cells of a grid need a positive size" && cellSize > 0);
+
+        m_cellSize = cellSize;
+        m_inverseCellSize = T{1} / cellSize;
+
+        std::size_t buckets{1};
+        while (buckets < count)
+        {
+            buckets *= 2;
+        }
+        m_bucketMask = buckets - 1;
+
+        std::vector<std::uint32_t> bucketOfPoint(count);
+        Util::parallelFor(0, count, detail::hash_grid_parallel_grain, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i{begin}; i < end; ++i)
+            {
+                Cell cell;
+                cellOf(points[i], cell);
+                bucketOfPoint[i] = static_cast<std::uint32_t>(bucketOf(cell));
+            }
+        });
+
+        for (int i{0}; i < size; ++i)
+        {
+            m_minCell[i] = std::numeric_limits<std::int64_t>::max();
+            m_maxCell[i] = std::numeric_limits<std::int64_t>::min();
+        }
+        for (std::size_t i{0}; i < count; ++i)
+        {
+            Cell cell;
+            cellOf(points[i], cell);
+            for (int j{0}; j < size; ++j)
+            {
+                m_minCell[j] = std::min(m_minCell[j], cell[j]);
+                m_maxCell[j] = std::max(m_maxCell[j], cell[j]);
+            }
+        }
+
+        // counting sort of the points by bucket
+        m_bucketStart.assign(buckets + 1, 0);
+        for (std::size_t i{0}; i < count; ++i)
+        {
+            ++m_bucketStart[bucketOfPoint[i] + 1];
+        }
+        for (std::size_t b{0}; b < buckets; ++b)
+        {
+            m_bucketStart[b + 1] += m_bucketStart[b];
+        }
+
+        std::vector<std::uint32_t> next(m_bucketStart.begin(), m_bucketStart.end() - 1);
+        m_points.resize(count);
+        m_indices.resize(count);
+        for (std::size_t i{0}; i < count; ++i)
+        {
+            const std::uint32_t position{next[bucketOfPoint[i]]++};
+            m_points[position] = points[i];
+            m_indices[position] = static_cast<std::uint32_t>(i);
+        }
+    }
+
+    std::size_t count() const { return m_points.size(); }
+
+    bool empty() const { return m_points.empty(); }
+
+    T cellSize() const { return m_cellSize; }
+
+    // the points whose distance to query is at most radius (in no particular order)
+    void withinRadius(const Point<T, size> &query, T radius, std::vector<Neighbor<T>> &neighbors) const
+    {
+        neighbors.clear();
+        if (m_points.empty())
+        {
+            return;
+        }
+
+        Cell low;
+        Cell high;
+        for (int i{0}; i < size; ++i)
+        {
+            low[i] = std::max(cellCoordinate(query(i) - radius), m_minCell[i]);
+            high[i] = std::min(cellCoordinate(query(i) + radius), m_maxCell[i]);
+        }
+
+        const T radiusSquared{radius * radius};
+        forEachCell(low, high, [&](const Cell &cell) {
+            visitCell(query, cell, [&](std::uint32_t index, T distanceSquared) {
+                if (distanceSquared <= radiusSquared)
+                {
+                    neighbors.push_back(Neighbor<T>{index, distanceSquared});
+                }
+            });
+        });
+    }
+
+    /**
+     * Writes the (at most) k points closest to query into neighbors sorted by distance and returns their number. Points
+     * at the same distance are ordered by index.
+     **/
+    std::size_t nearest(const Point<T, size> &query, std::size_t k, Neighbor<T> *neighbors) const
+    {
+        detail::NearestNeighbors<T> heap{neighbors, k};
+        if (m_points.empty() || k == 0)
+        {
+            return heap.finish();
+        }
+
+        // rings of cells with the Chebyshev distance ring to the cell of the query, starting with the first one that
+        // reaches an occupied cell
+        Cell center;
+        cellOf(query, center);
+        std::int64_t ring{0};
+        for (int i{0}; i < size; ++i)
+        {
+            ring = std::max(ring, std::max(m_minCell[i] - center[i], center[i] - m_maxCell[i]));
+        }
+
+        for (;; ++ring)
+        {
+            Cell low;
+            Cell high;
+            bool coversGrid{true};
+            for (int i{0}; i < size; ++i)
+            {
+                low[i] = std::max(center[i] - ring, m_minCell[i]);
+                high[i] = std::min(center[i] + ring, m_maxCell[i]);
+                coversGrid = coversGrid && center[i] - ring <= m_minCell[i] && center[i] + ring >= m_maxCell[i];
+            }
+
+            const auto push = [&heap](std::uint32_t index, T distanceSquared) { heap.push(index, distanceSquared); };
+            // the other axes are enumerated, along axis 0 either the whole row lies on the ring or only its two ends
+            const std::int64_t rowLow{low[0]};
+            const std::int64_t rowHigh{high[0]};
+            high[0] = low[0];
+            forEachCell(low, high, [&](const Cell &rowStart) {
+                Cell cell;
+                std::copy(rowStart, rowStart + size, cell);
+
+                bool rowOnRing{false};
+                for (int i{1}; i < size; ++i)
+                {
+                    rowOnRing = rowOnRing || cell[i] == center[i] - ring || cell[i] == center[i] + ring;
+                }
+
+                if (rowOnRing)
+                {
+                    for (cell[0] = rowLow; cell[0] <= rowHigh; ++cell[0])
+                    {
+                        visitCell(query, cell, push);
+                    }
+                    return;
+                }
+
+                for (const std::int64_t end : {center[0] - ring, center[0] + ring})
+                {
+                    cell[0] = end;
+                    if (end >= rowLow && end <= rowHigh)
+                    {
+                        visitCell(query, cell, push);
+                    }
+                    if (ring == 0)
+                    {
+                        break;
+                    }
+                }
+            });
+
+            // the cells outside of the ring are at least ring cells away from the query
+            const T reach{static_cast<T>(ring) * m_cellSize};
+            if (coversGrid || (heap.full() && heap.worst() <= reach * reach))
+            {
+                break;
+            }
+        }
+
+        return heap.finish();
+    }
+
+    // nearest for count queries in parallel, neighbors holds k entries per query and found the number of each
+    void nearest(const Point<T, size> *queries,
+                 std::size_t count,
+                 std::size_t k,
+                 Neighbor<T> *neighbors,
+                 std::size_t *found) const
+    {
+        Util::parallelFor(0, count, detail::neighbor_query_grain, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i{begin}; i < end; ++i)
+            {
+                found[i] = nearest(queries[i], k, neighbors + i * k);
+            }
+        });
+    }
+
+    // withinRadius for count queries in parallel
+    void withinRadius(const Point<T, size> *queries,
+                      std::size_t count,
+                      T radius,
+                      std::vector<std::vector<Neighbor<T>>> &neighbors) const
+    {
+        neighbors.resize(count);
+        Util::parallelFor(0, count, detail::neighbor_query_grain, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i{begin}; i < end; ++i)
+            {
+                withinRadius(queries[i], radius, neighbors[i]);
+            }
+        });
+    }
+
+private:
+    std::int64_t cellCoordinate(T value) const
+    {
+        return static_cast<std::int64_t>(std::floor(value * m_inverseCellSize));
+    }
+
+    void cellOf(const Point<T, size> &point, Cell &cell) const
+    {
+        for (int i{0}; i < size; ++i)
+        {
+            cell[i] = cellCoordinate(point(i));
+        }
+    }
+
+    std::size_t bucketOf(const Cell &cell) const
+    {
+        std::uint64_t hash{0};
+        for (int i{0}; i < size; ++i)
+        {
+            hash = (hash ^ static_cast<std::uint64_t>(cell[i])) * 0x9E3779B97F4A7C15ULL;
+        }
+
+        return static_cast<std::size_t>(hash ^ (hash >> 32)) & m_bucketMask;
+    }
+
+    // calls visit(cell) for all cells between low and high (inclusive)
+    template <typename Visit>
+    static void forEachCell(const Cell &low, const Cell &high, const Visit &visit)
+    {
+        for (int i{0}; i < size; ++i)
+        {
+            if (low[i] > high[i])
+            {
+                return;
+            }
+        }
+
+        Cell cell;
+        std::copy(low, low + size, cell);
+        for (;;)
+        {
+            visit(cell);
+
+            int axis{0};
+            while (axis < size && cell[axis] == high[axis])
+            {
+                cell[axis] = low[axis];
+                ++axis;
+            }
+            if (axis == size)
+            {
+                return;
+            }
+            ++cell[axis];
+        }
+    }
+
+    // calls visit(index, distanceSquared) for the points in cell
+    template <typename Visit>
+    void visitCell(const Point<T, size> &query, const Cell &cell, const Visit &visit) const
+    {
+        const std::size_t bucket{bucketOf(cell)};
+        for (std::uint32_t i{m_bucketStart[bucket]}; i < m_bucketStart[bucket + 1]; ++i)
+        {
+            // other cells may share the bucket
+            Cell pointCell;
+            cellOf(m_points[i], pointCell);
+            if (std::equal(pointCell, pointCell + size, cell))
+            {
+                visit(m_indices[i], detail::distanceSquared(query, m_points[i]));
+            }
+        }
+    }
+};
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,247 @@
+#ifndef MATHLIB_CORE_GEOMETRY_KD_TREE_TEMPLATE
+#define MATHLIB_CORE_GEOMETRY_KD_TREE_TEMPLATE
+
+#include "../../util/threadPool.h"
+#include "../Vector/point.h"
+#include "./aabb.h"
+#include "./neighbors.h"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace MathLib
+{
+namespace detail
+{
+// ranges with at most this many points are searched linearly
+constexpr std::size_t kd_tree_leaf_size{8};
+// ranges with more points are split in parallel
+constexpr std::size_t kd_tree_parallel_threshold{16384};
+} // namespace detail
+
+/**
+ * k-d tree over an array of points of any dimension for nearest neighbour and radius queries. The tree is implicit:
+ * the points are reordered so that the median of every range [begin, end) splits it along the axis of its largest
+ * extent, the children are the ranges left and right of the median. Only the split axis of each median is stored, the
+ * points themselves are kept in tree order for cache friendly queries.
+ *
+ * Bulk construction splits big ranges in parallel, the batched queries run on the thread pool.
+ **/
+template <typename T, int size>
+class KdTree
+{
+private:
+    std::vector<Point<T, size>> m_points;
+    std::vector<std::uint32_t> m_indices;
+    std::vector<std::uint8_t> m_axes;
+
+public:
+    KdTree() = default;
+
+    KdTree(const Point<T, size> *points, std::size_t count) { build(points, count); }
+
+    void build(const Point<T, size> *points, std::size_t count)
+    {
+        m_indices.resize(count);
+        m_axes.assign(count, 0);
+        for (std::size_t i{0}; i < count; ++i)
+        {
+            m_indices[i] = static_cast<std::uint32_t>(i);
+        }
+
+        buildRange(points, 0, count);
+
+        m_points.resize(count);
+        Util::parallelFor(0, count, detail::kd_tree_parallel_threshold, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i{begin}; i < end; ++i)
+            {
+                m_points[i] = points[m_indices[i]];
+            }
+        });
+    }
+
+    std::size_t count() const { return m_points.size(); }
+
+    bool empty() const { return m_points.empty(); }
+
+    /**
+     * Writes the (at most) k points closest to query into neighbors sorted by distance and returns their number. Points
+     * at the same distance are ordered by index.
+     **/
+    std::size_t nearest(const Point<T, size> &query, std::size_t k, Neighbor<T> *neighbors) const
+    {
+        detail::NearestNeighbors<T> heap{neighbors, k};
+        if (k > 0)
+        {
+            searchNearest(query, 0, m_points.size(), heap);
+        }
+
+        return heap.finish();
+    }
+
+    // the points whose distance to query is at most radius (in no particular order)
+    void withinRadius(const Point<T, size> &query, T radius, std::vector<Neighbor<T>> &neighbors) const
+    {
+        neighbors.clear();
+        searchRadius(query, radius * radius, 0, m_points.size(), neighbors);
+    }
+
+    // nearest for count queries in parallel, neighbors holds k entries per query and found the number of each
+    void nearest(const Point<T, size> *queries,
+                 std::size_t count,
+                 std::size_t k,
+                 Neighbor<T> *neighbors,
+                 std::size_t *found) const
+    {
+        Util::parallelFor(0, count, detail::neighbor_query_grain, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i{begin}; i < end; ++i)
+            {
+                found[i] = nearest(queries[i], k, neighbors + i * k);
+            }
+        });
+    }
+
+    // withinRadius for count queries in parallel
+    void withinRadius(const Point<T, size> *queries,
+                      std::size_t count,
+                      T radius,
+                      std::vector<std::vector<Neighbor<T>>> &neighbors) const
+    {
+        neighbors.resize(count);
+        Util::parallelFor(0, count, detail::neighbor_query_grain, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i{begin}; i < end; ++i)
+            {
+                withinRadius(queries[i], radius, neighbors[i]);
+            }
+        });
+    }
+
+private:
+    void buildRange(const Point<T, size> *points, std::size_t begin, std::size_t end)
+    {
+        if (end - begin <= detail::kd_tree_leaf_size)
+        {
+            return;
+        }
+
+        AABB<T, size> bounds;
+        for (std::size_t i{begin}; i < end; ++i)
+        {
+            bounds.extend(points[m_indices[i]]);
+        }
+        const int axis{bounds.largestAxis()};
+
+        const std::size_t median{begin + (end - begin) / 2};
+        std::nth_element(m_indices.data() + begin,
+                         m_indices.data() + median,
+                         m_indices.data() + end,
+                         [points, axis](std::uint32_t i1, std::uint32_t i2) {
+                             return points[i1](axis) < points[i2](axis);
+                         });
+        m_axes[median] = static_cast<std::uint8_t>(axis);
+
+        if (end - begin > detail::kd_tree_parallel_threshold)
+        {
+            Util::parallelFor(0, 2, 1, [&](std::size_t first, std::size_t last) {
+                for (std::size_t i{first}; i < last; ++i)
+                {
+                    if (i == 0)
+                    {
+                        buildRange(points, begin, median);
+                    }
+                    else
+                    {
+                        buildRange(points, median + 1, end);
+                    }
+                }
+            });
+        }
+        else
+        {
+            buildRange(points, begin, median);
+            buildRange(points, median + 1, end);
+        }
+    }
+
+    void searchNearest(const Point<T, size> &query,
+                       std::size_t begin,
+                       std::size_t end,
+                       detail::NearestNeighbors<T> &heap) const
+    {
+        if (end - begin <= detail::kd_tree_leaf_size)
+        {
+            for (std::size_t i{begin}; i < end; ++i)
+            {
+                heap.push(m_indices[i], detail::distanceSquared(query, m_points[i]));
+            }
+            return;
+        }
+
+        const std::size_t median{begin + (end - begin) / 2};
+        const int axis{m_axes[median]};
+        const T difference{query(axis) - m_points[median](axis)};
+        heap.push(m_indices[median], detail::distanceSquared(query, m_points[median]));
+
+        // the side of the query first, the other one only if it can still hold closer points
+        if (difference < 0)
+        {
+            searchNearest(query, begin, median, heap);
+            if (difference * difference <= heap.worst())
+            {
+                searchNearest(query, median + 1, end, heap);
+            }
+        }
+        else
+        {
+            searchNearest(query, median + 1, end, heap);
+            if (difference * difference <= heap.worst())
+            {
+                searchNearest(query, begin, median, heap);
+            }
+        }
+    }
+
+    void searchRadius(const Point<T, size> &query,
+                      T radiusSquared,
+                      std::size_t begin,
+                      std::size_t end,
+                      std::vector<Neighbor<T>> &neighbors) const
+    {
+        if (end - begin <= detail::kd_tree_leaf_size)
+        {
+            for (std::size_t i{begin}; i < end; ++i)
+            {
+                const T distanceSquared{detail::distanceSquared(query, m_points[i])};
+                if (distanceSquared <= radiusSquared)
+                {
+                    neighbors.push_back(Neighbor<T>{m_indices[i], distanceSquared});
+                }
+            }
+            return;
+        }
+
+        const std::size_t median{begin + (end - begin) / 2};
+        const int axis{m_axes[median]};
+        const T difference{query(axis) - m_points[median](axis)};
+        const T distanceSquared{detail::distanceSquared(query, m_points[median])};
+        if (distanceSquared <= radiusSquared)
+        {
+            neighbors.push_back(Neighbor<T>{m_indices[median], distanceSquared});
+        }
+
+        const bool planeInRange{difference * difference <= radiusSquared};
+        if (difference < 0 || planeInRange)
+        {
+            searchRadius(query, radiusSquared, begin, median, neighbors);
+        }
+        if (difference >= 0 || planeInRange)
+        {
+            searchRadius(query, radiusSquared, median + 1, end, neighbors);
+        }
+    }
+};
+} // namespace MathLib
+
+#endif
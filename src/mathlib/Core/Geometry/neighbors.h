@@ -0,0 +1,89 @@
+#ifndef MATHLIB_CORE_GEOMETRY_NEIGHBORS_TEMPLATE
+#define MATHLIB_CORE_GEOMETRY_NEIGHBORS_TEMPLATE
+
+#include "../Vector/point.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace MathLib
+{
+// result of a nearest neighbour or radius query: the index of the point in the array the structure was built from
+template <typename T>
+struct Neighbor
+{
+    std::uint32_t index;
+    T distanceSquared;
+};
+
+namespace detail
+{
+// queries per block when a batch of queries runs on the thread pool
+constexpr std::size_t neighbor_query_grain{64};
+
+template <typename T, int size>
+T distanceSquared(const Point<T, size> &p1, const Point<T, size> &p2)
+{
+    T sum{0};
+    for (int i{0}; i < size; ++i)
+    {
+        const T d{p1(i) - p2(i)};
+        sum += d * d;
+    }
+
+    return sum;
+}
+
+template <typename T>
+bool closer(const Neighbor<T> &n1, const Neighbor<T> &n2)
+{
+    return n1.distanceSquared < n2.distanceSquared ||
+           (n1.distanceSquared == n2.distanceSquared && n1.index < n2.index);
+}
+
+// the k closest candidates seen so far, kept as a max heap in caller provided memory (no allocations per query)
+template <typename T>
+class NearestNeighbors
+{
+private:
+    Neighbor<T> *m_heap;
+    std::size_t m_k;
+    std::size_t m_size{0};
+
+public:
+    NearestNeighbors(Neighbor<T> *heap, std::size_t k) : m_heap{heap}, m_k{k} {}
+
+    // squared distance a candidate has to beat
+    T worst() const { return m_size < m_k ? std::numeric_limits<T>::max() : m_heap[0].distanceSquared; }
+
+    void push(std::uint32_t index, T distanceSquared)
+    {
+        const Neighbor<T> candidate{index, distanceSquared};
+        if (m_size < m_k)
+        {
+            m_heap[m_size++] = candidate;
+            std::push_heap(m_heap, m_heap + m_size, closer<T>);
+        }
+        else if (m_k > 0 && closer(candidate, m_heap[0]))
+        {
+            std::pop_heap(m_heap, m_heap + m_size, closer<T>);
+            m_heap[m_size - 1] = candidate;
+            std::push_heap(m_heap, m_heap + m_size, closer<T>);
+        }
+    }
+
+    bool full() const { return m_size == m_k; }
+
+    // sorts the neighbors by distance and returns their number
+    std::size_t finish()
+    {
+        std::sort_heap(m_heap, m_heap + m_size, closer<T>);
+
+        return m_size;
+    }
+};
+} // namespace detail
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef MATHLIB_CORE_GEOMETRY_RAY_TEMPLATE
+#define MATHLIB_CORE_GEOMETRY_RAY_TEMPLATE
+
+#include "../Vector/point.h"
+#include "../Vector/vector.h"
+#include <type_traits>
+
+namespace MathLib
+{
+/**
+ * Half line origin + t * direction (t >= 0), the direction does not have to be normalized. The ray caches the inverse
+ * of its direction and on which side of each axis it points, which turns the slab test against boxes into
+ * multiplications and table lookups (see intersect in aabb.h).
+ **/
+template <typename T, typename = typename std::enable_if<std::is_floating_point<T>::value, T>::type>
+class Ray
+{
+private:
+    Point<T, 3> m_origin;
+    Vector<T, 3> m_direction;
+    // components of zero directions become +-infinity, which the intersection tests rely on
+    Vector<T, 3> m_inverseDirection;
+    // 1 where the direction points towards -infinity (also -0), 0 otherwise
+    int m_isNegative[3];
+
+public:
+    Ray() : Ray{Point<T, 3>{}, Vector<T, 3>{0, 0, 1}} {}
+
+    Ray(const Point<T, 3> &origin, const Vector<T, 3> &direction) : m_origin{origin} { setDirection(direction); }
+
+    const Point<T, 3> &origin() const { return m_origin; }
+
+    const Vector<T, 3> &direction() const { return m_direction; }
+
+    const Vector<T, 3> &inverseDirection() const { return m_inverseDirection; }
+
+    int isNegative(int axis) const { return m_isNegative[axis]; }
+
+    void setOrigin(const Point<T, 3> &origin) { m_origin = origin; }
+
+    void setDirection(const Vector<T, 3> &direction)
+    {
+        m_direction = direction;
+        for (int i{0}; i < 3; ++i)
+        {
+            m_inverseDirection(i) = T{1} / direction(i);
+            m_isNegative[i] = m_inverseDirection(i) < 0;
+        }
+    }
+
+    // the point at distance t (in multiples of the direction) from the origin
+    Point<T, 3> operator()(T t) const
+    {
+        return Point<T, 3>{m_origin(0) + t * m_direction(0),
+                           m_origin(1) + t * m_direction(1),
+                           m_origin(2) + t * m_direction(2)};
+    }
+};
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef MATHLIB_CORE_GEOMETRY_TRIANGLE_TEMPLATE
+#define MATHLIB_CORE_GEOMETRY_TRIANGLE_TEMPLATE
+
+#include "../Vector/point.h"
+#include "../Vector/vector.h"
+#include "./aabb.h"
+#include "./ray.h"
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+
+namespace MathLib
+{
+// the triangle with the corners v0, v1 and v2, front facing if they are in counter clockwise order
+template <typename T, typename = typename std::enable_if<std::is_floating_point<T>::value, T>::type>
+class Triangle
+{
+private:
+    Point<T, 3> m_vertices[3];
+
+public:
+    Triangle() = default;
+
+    Triangle(const Point<T, 3> &v0, const Point<T, 3> &v1, const Point<T, 3> &v2) : m_vertices{v0, v1, v2} {}
+
+    const Point<T, 3> &operator[](int index) const { return m_vertices[index]; }
+
+    const Point<T, 3> &at(int index) const
+    {
+        assert("Accessing triangle with index out of its bounds" && index >= 0 && index < 3);
+
+        return m_vertices[index];
+    }
+
+    Point<T, 3> &at(int index)
+    {
+        assert("Accessing triangle with index out of its bounds" && index >= 0 && index < 3);
+
+        return m_vertices[index];
+    }
+
+    // v1 - v0 and v2 - v0
+    Vector<T, 3> edge1() const { return Vector<T, 3>{m_vertices[1] - m_vertices[0]}; }
+
+    Vector<T, 3> edge2() const { return Vector<T, 3>{m_vertices[2] - m_vertices[0]}; }
+
+    // not normalized, its length is twice the area
+    Vector<T, 3> normal() const { return cross(edge1(), edge2()); }
+
+    T area() const { return normal().norm() / 2; }
+
+    Point<T, 3> centroid() const
+    {
+        Point<T, 3> centroid;
+        for (int i{0}; i < 3; ++i)
+        {
+            centroid(i) = (m_vertices[0](i) + m_vertices[1](i) + m_vertices[2](i)) / 3;
+        }
+
+        return centroid;
+    }
+
+    AABB<T, 3> bounds() const { return AABB<T, 3>{m_vertices[0]}.extend(m_vertices[1]).extend(m_vertices[2]); }
+
+    // the point with the barycentric coordinates (1 - u - v, u, v)
+    Point<T, 3> operator()(T u, T v) const
+    {
+        Point<T, 3> point;
+        for (int i{0}; i < 3; ++i)
+        {
+            point(i) = (1 - u - v) * m_vertices[0](i) + u * m_vertices[1](i) + v * m_vertices[2](i);
+        }
+
+        return point;
+    }
+};
+
+// distance t along the ray and barycentric coordinates (u, v) of an intersection
+template <typename T>
+struct TriangleHit
+{
+    T t;
+    T u;
+    T v;
+};
+
+/**
+ * Möller–Trumbore test: true if the ray hits the triangle (from either side) at a distance in (tMin, tMax), hit then
+ * holds the distance and the barycentric coordinates of the intersection. All conditions are evaluated without
+ * branching, rays parallel to the triangle miss.
+ **/
+template <typename T>
+bool intersect(const Ray<T> &ray, const Triangle<T> &triangle, T tMin, T tMax, TriangleHit<T> &hit)
+{
+    const Vector<T, 3> edge1{triangle.edge1()};
+    const Vector<T, 3> edge2{triangle.edge2()};
+    const Vector<T, 3> p{cross(ray.direction(), edge2)};
+    const T determinant{dot(edge1, p)};
+    const T inverseDeterminant{T{1} / determinant};
+
+    const Vector<T, 3> s{ray.origin() - triangle[0]};
+    const Vector<T, 3> q{cross(s, edge1)};
+    hit.u = dot(s, p) * inverseDeterminant;
+    hit.v = dot(ray.direction(), q) * inverseDeterminant;
+    hit.t = dot(edge2, q) * inverseDeterminant;
+
+    return (determinant != 0) & (hit.u >= 0) & (hit.v >= 0) & (hit.u + hit.v <= 1) & (hit.t > tMin) & (hit.t < tMax);
+}
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,439 @@
+#ifndef MATHLIB_CORE_MATRIX_DECOMPOSITION_TEMPLATE
+#define MATHLIB_CORE_MATRIX_DECOMPOSITION_TEMPLATE
+
+#include "../Vector/vector.h"
+#include "./matrix.h"
+#include "./matrixInverseKernels.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace MathLib
+{
+// Factorizations of fixed size matrices which are computed once and then reused to solve for any number of right
+// hand sides. All storage is inline and the loop bounds are compile time constants, so the kernels do not allocate
+// and are unrolled by the compiler for the small sizes.
+
+/**
+ * LU decomposition with partial pivoting P A = L U of a square matrix
+ * Works for every invertible matrix, solving costs O(n^2) per right hand side after the O(n^3) decomposition.
+ **/
+template <typename T, int n, typename = typename std::enable_if<std::is_floating_point<T>::value, T>::type>
+class LUDecomposition
+{
+private:
+    // L (unit diagonal, not stored) below the diagonal and U on and above it
+    Matrix<T, n, n> m_lu;
+    int m_permutation[n];
+    // sign of the permutation, 0 if the matrix is singular
+    int m_sign;
+
+public:
+    constexpr explicit LUDecomposition(const Matrix<T, n, n> &mat)
+        : m_lu{mat}, m_permutation{}, m_sign{detail::luDecompose<T, n>(m_lu.raw(), m_permutation)}
+    {
+    }
+
+    constexpr bool isInvertible() const { return m_sign != 0; }
+
+    constexpr T determinant() const
+    {
+        T det = m_sign;
+        for (int i{0}; i < n; ++i)
+        {
+            det *= m_lu(i, i);
+        }
+
+        return det;
+    }
+
+    // solves A x = b
+    constexpr Vector<T, n> solve(const Vector<T, n> &b) const
+    {
+        assert("Solving a linear system with a singular matrix" && isInvertible());
+
+        Vector<T, n> x{};
+        detail::luSolve<T, n>(m_lu.raw(), m_permutation, b.data(), x.data());
+
+        return x;
+    }
+
+    // solves A X = B for all columns of B at once
+    template <int rhs>
+    constexpr Matrix<T, n, rhs> solve(const Matrix<T, n, rhs> &b) const
+    {
+        assert("Solving a linear system with a singular matrix" && isInvertible());
+
+        Matrix<T, n, rhs> x{};
+        for (int col{0}; col < rhs; ++col)
+        {
+            detail::luSolve<T, n>(m_lu.raw(), m_permutation, b.raw() + col * n, x.raw() + col * n);
+        }
+
+        return x;
+    }
+
+    constexpr Matrix<T, n, n> inverse() const
+    {
+        Matrix<T, n, n> identity{};
+        return solve(identity.setIdentity());
+    }
+
+    constexpr Matrix<T, n, n> getL() const
+    {
+        Matrix<T, n, n> l{};
+        for (int col{0}; col < n; ++col)
+        {
+            l(col, col) = 1;
+            for (int row{col + 1}; row < n; ++row)
+            {
+                l(row, col) = m_lu(row, col);
+            }
+        }
+
+        return l;
+    }
+
+    constexpr Matrix<T, n, n> getU() const
+    {
+        Matrix<T, n, n> u{};
+        for (int col{0}; col < n; ++col)
+        {
+            for (int row{0}; row <= col; ++row)
+            {
+                u(row, col) = m_lu(row, col);
+            }
+        }
+
+        return u;
+    }
+
+    // P as a matrix, P A = L U
+    constexpr Matrix<T, n, n> getP() const
+    {
+        Matrix<T, n, n> p{};
+        for (int row{0}; row < n; ++row)
+        {
+            p(row, m_permutation[row]) = 1;
+        }
+
+        return p;
+    }
+};
+
+/**
+ * Cholesky decomposition A = L L^T of a symmetric positive definite matrix (only its lower triangle is read)
+ * About half the work of the LU decomposition and stable without pivoting, e.g. for normal equations or the mass
+ * matrices of constraint solvers.
+ **/
+template <typename T, int n, typename = typename std::enable_if<std::is_floating_point<T>::value, T>::type>
+class CholeskyDecomposition
+{
+private:
+    // lower triangular, the upper triangle is 0
+    Matrix<T, n, n> m_l;
+    bool m_positiveDefinite;
+
+public:
+    explicit CholeskyDecomposition(const Matrix<T, n, n> &mat) : m_l{}, m_positiveDefinite{decompose(mat)} {}
+
+    bool isPositiveDefinite() const { return m_positiveDefinite; }
+
+    T determinant() const
+    {
+        T det{1};
+        for (int i{0}; i < n; ++i)
+        {
+            det *= m_l(i, i);
+        }
+
+        return det * det;
+    }
+
+    // solves A x = b
+    Vector<T, n> solve(const Vector<T, n> &b) const
+    {
+        Vector<T, n> x{b};
+        solveInPlace(x.data());
+
+        return x;
+    }
+
+    // solves A X = B for all columns of B at once
+    template <int rhs>
+    Matrix<T, n, rhs> solve(const Matrix<T, n, rhs> &b) const
+    {
+        Matrix<T, n, rhs> x{b};
+        for (int col{0}; col < rhs; ++col)
+        {
+            solveInPlace(x.raw() + col * n);
+        }
+
+        return x;
+    }
+
+    const Matrix<T, n, n> &getL() const { return m_l; }
+
+private:
+    // right looking variant, the updates of the trailing lower triangle run down the columns
+    bool decompose(const Matrix<T, n, n> &mat)
+    {
+        T *l = m_l.raw();
+        for (int col{0}; col < n; ++col)
+        {
+            for (int row{col}; row < n; ++row)
+            {
+                l[col * n + row] = mat(row, col);
+            }
+        }
+
+        for (int k{0}; k < n; ++k)
+        {
+            const T pivot{l[k * n + k]};
+            if (!(pivot > T{0}))
+            {
+                return false;
+            }
+
+            const T diagonal{std::sqrt(pivot)};
+            const T inverseDiagonal{T{1} / diagonal};
+            l[k * n + k] = diagonal;
+            for (int row{k + 1}; row < n; ++row)
+            {
+                l[k * n + row] *= inverseDiagonal;
+            }
+
+            for (int col{k + 1}; col < n; ++col)
+            {
+                const T factor{l[k * n + col]};
+                for (int row{col}; row < n; ++row)
+                {
+                    l[col * n + row] -= l[k * n + row] * factor;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    void solveInPlace(T *x) const
+    {
+        assert("Solving a linear system with a matrix that is not positive definite" && m_positiveDefinite);
+
+        const T *l = m_l.raw();
+
+        // L y = b
+        for (int col{0}; col < n; ++col)
+        {
+            x[col] /= l[col * n + col];
+            for (int row{col + 1}; row < n; ++row)
+            {
+                x[row] -= l[col * n + row] * x[col];
+            }
+        }
+
+        // L^T x = y, the rows of L^T are the columns of L
+        for (int row{n - 1}; row >= 0; --row)
+        {
+            T sum{x[row]};
+            for (int k{row + 1}; k < n; ++k)
+            {
+                sum -= l[row * n + k] * x[k];
+            }
+            x[row] = sum / l[row * n + row];
+        }
+    }
+};
+
+/**
+ * QR decomposition A = Q R with Householder reflections of a matrix with at least as many rows as columns
+ * For overdetermined systems solve returns the least squares solution, which makes it the decomposition to use for
+ * fitting. Q has orthonormal columns (rows x cols) and R is upper triangular (cols x cols).
+ **/
+template <typename T,
+          int rows,
+          int cols,
+          typename = typename std::enable_if<std::is_floating_point<T>::value && rows >= cols, T>::type>
+class QRDecomposition
+{
+private:
+    // the Householder vectors on and below the diagonal, R above it
+    Matrix<T, rows, cols> m_qr;
+    T m_rDiagonal[cols];
+
+public:
+    explicit QRDecomposition(const Matrix<T, rows, cols> &mat) : m_qr{mat}, m_rDiagonal{}
+    {
+        T *qr = m_qr.raw();
+
+        for (int k{0}; k < cols; ++k)
+        {
+            T *column = qr + k * rows;
+
+            T norm{0};
+            for (int row{k}; row < rows; ++row)
+            {
+                norm += column[row] * column[row];
+            }
+            norm = std::sqrt(norm);
+
+            if (norm != T{0})
+            {
+                // the sign avoids cancellation in column[k] + 1
+                if (column[k] < T{0})
+                {
+                    norm = -norm;
+                }
+
+                for (int row{k}; row < rows; ++row)
+                {
+                    column[row] /= norm;
+                }
+                column[k] += T{1};
+
+                for (int col{k + 1}; col < cols; ++col)
+                {
+                    reflect(k, qr + col * rows);
+                }
+            }
+
+            m_rDiagonal[k] = -norm;
+        }
+    }
+
+    // diagonal elements of R that are tiny compared to the biggest one are treated as 0 (dependent columns rarely
+    // cancel out exactly in floating point)
+    bool isFullRank() const
+    {
+        T maxDiagonal{0};
+        for (int i{0}; i < cols; ++i)
+        {
+            maxDiagonal = std::max(maxDiagonal, std::abs(m_rDiagonal[i]));
+        }
+
+        const T tolerance{maxDiagonal * rows * std::numeric_limits<T>::epsilon()};
+        for (int i{0}; i < cols; ++i)
+        {
+            if (!(std::abs(m_rDiagonal[i]) > tolerance))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // returns the x minimizing |A x - b| (the solution of A x = b for square matrices)
+    Vector<T, cols> solve(const Vector<T, rows> &b) const
+    {
+        Vector<T, rows> y{b};
+        solveInPlace(y.data());
+
+        Vector<T, cols> x{};
+        for (int i{0}; i < cols; ++i)
+        {
+            x(i) = y(i);
+        }
+
+        return x;
+    }
+
+    // least squares solutions for all columns of B at once
+    template <int rhs>
+    Matrix<T, cols, rhs> solve(const Matrix<T, rows, rhs> &b) const
+    {
+        Matrix<T, rows, rhs> y{b};
+        Matrix<T, cols, rhs> x{};
+        for (int col{0}; col < rhs; ++col)
+        {
+            solveInPlace(y.raw() + col * rows);
+            for (int row{0}; row < cols; ++row)
+            {
+                x(row, col) = y(row, col);
+            }
+        }
+
+        return x;
+    }
+
+    Matrix<T, rows, cols> getQ() const
+    {
+        // applies the reflections to the first columns of the identity in reverse order
+        Matrix<T, rows, cols> q{};
+        for (int k{cols - 1}; k >= 0; --k)
+        {
+            q(k, k) = 1;
+            for (int col{k}; col < cols; ++col)
+            {
+                reflect(k, q.raw() + col * rows);
+            }
+        }
+
+        return q;
+    }
+
+    Matrix<T, cols, cols> getR() const
+    {
+        Matrix<T, cols, cols> r{};
+        for (int col{0}; col < cols; ++col)
+        {
+            for (int row{0}; row < col; ++row)
+            {
+                r(row, col) = m_qr(row, col);
+            }
+            r(col, col) = m_rDiagonal[col];
+        }
+
+        return r;
+    }
+
+private:
+    // applies the k-th Householder reflection to a column of length rows
+    void reflect(int k, T *column) const
+    {
+        const T *v = m_qr.raw() + k * rows;
+        if (v[k] == T{0})
+        {
+            return;
+        }
+
+        T dot{0};
+        for (int row{k}; row < rows; ++row)
+        {
+            dot += v[row] * column[row];
+        }
+
+        const T factor{-dot / v[k]};
+        for (int row{k}; row < rows; ++row)
+        {
+            column[row] += factor * v[row];
+        }
+    }
+
+    // overwrites the first cols elements of b (length rows) with the least squares solution
+    void solveInPlace(T *b) const
+    {
+        assert("Solving a linear system with a rank deficient matrix" && isFullRank());
+
+        // Q^T b
+        for (int k{0}; k < cols; ++k)
+        {
+            reflect(k, b);
+        }
+
+        // R x = Q^T b
+        for (int col{cols - 1}; col >= 0; --col)
+        {
+            b[col] /= m_rDiagonal[col];
+            for (int row{0}; row < col; ++row)
+            {
+                b[row] -= b[col] * m_qr(row, col);
+            }
+        }
+    }
+};
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,428 @@
+#ifndef MATHLIB_CORE_MATRIX_DENSE_MATRIX_TEMPLATE
+#define MATHLIB_CORE_MATRIX_DENSE_MATRIX_TEMPLATE
+
+#include "../../util/alignedBuffer.h"
+#include "../../util/util.h"
+#include "../Vector/denseVector.h"
+#include "./gemm.h"
+#include "./matrix.h"
+#include "./matrixView.h"
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace MathLib
+{
+/**
+ * A matrix whose dimensions are only known at runtime (the counterpart of Matrix for e.g. batch solvers). The
+ * elements are stored contiguously in column major order like the ones of Matrix, in a cache line aligned heap buffer
+ * which is owned exclusively: DenseMatrices can be moved but copies have to be made explicitly with clone().
+ **/
+template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
+class DenseMatrix
+{
+private:
+    Util::AlignedBuffer<T> m_data;
+    std::size_t m_rows{0};
+    std::size_t m_cols{0};
+
+public:
+    DenseMatrix() = default;
+
+    DenseMatrix(std::size_t rows, std::size_t cols, T value = T{0}) : m_data{rows * cols}, m_rows{rows}, m_cols{cols}
+    {
+        fill(value);
+    }
+
+    template <int rows, int cols>
+    explicit DenseMatrix(const Matrix<T, rows, cols> &other) : DenseMatrix(rows, cols)
+    {
+        setBlock(0, 0, other);
+    }
+
+    DenseMatrix(DenseMatrix &&other) noexcept
+        : m_data{std::move(other.m_data)}, m_rows{std::exchange(other.m_rows, 0)},
+          m_cols{std::exchange(other.m_cols, 0)}
+    {
+    }
+
+    DenseMatrix &operator=(DenseMatrix &&other) noexcept
+    {
+        m_data = std::move(other.m_data);
+        m_rows = std::exchange(other.m_rows, 0);
+        m_cols = std::exchange(other.m_cols, 0);
+
+        return *this;
+    }
+
+    static DenseMatrix identity(std::size_t size)
+    {
+        DenseMatrix res{size, size};
+        res.setIdentity();
+
+        return res;
+    }
+
+    DenseMatrix clone() const
+    {
+        DenseMatrix copy{};
+        copy.m_data = m_data.clone();
+        copy.m_rows = m_rows;
+        copy.m_cols = m_cols;
+
+        return copy;
+    }
+
+    std::size_t rows() const { return m_rows; }
+
+    std::size_t cols() const { return m_cols; }
+
+    T operator()(std::size_t row, std::size_t col) const { return m_data[col * m_rows + row]; }
+
+    T &operator()(std::size_t row, std::size_t col) { return m_data[col * m_rows + row]; }
+
+    T at(std::size_t row, std::size_t col) const
+    {
+        assert("Accessing matrix with index out of its bounds" && row < m_rows && col < m_cols);
+
+        return m_data[col * m_rows + row];
+    }
+
+    T &at(std::size_t row, std::size_t col)
+    {
+        assert("Accessing matrix with index out of its bounds" && row < m_rows && col < m_cols);
+
+        return m_data[col * m_rows + row];
+    }
+
+    // returns the internal array (BEWARE!: the internal storage is in column major order)
+    const T *raw() const { return m_data.data(); }
+
+    T *raw() { return m_data.data(); }
+
+    // start of a column, its rows() elements are contiguous
+    const T *column(std::size_t col) const { return m_data.data() + col * m_rows; }
+
+    T *column(std::size_t col) { return m_data.data() + col * m_rows; }
+
+    DenseMatrix &fill(T value)
+    {
+        for (std::size_t i{0}; i < m_rows * m_cols; ++i)
+        {
+            m_data[i] = value;
+        }
+
+        return *this;
+    }
+
+    DenseMatrix &setIdentity()
+    {
+        assert("Using setIdentity on a matrix that is not square" && m_rows == m_cols);
+
+        fill(T{0});
+        for (std::size_t i{0}; i < m_rows; ++i)
+        {
+            (*this)(i, i) = 1;
+        }
+
+        return *this;
+    }
+
+    // view of the block of size rows x cols starting at (row, col), it converts to a fixed size matrix
+    template <int rows, int cols>
+    MatrixView<T, rows, cols> block(std::size_t row, std::size_t col)
+    {
+        assert("Accessing matrix with index out of its bounds" && row + rows <= m_rows && col + cols <= m_cols);
+
+        return MatrixView<T, rows, cols>{column(col) + row, 1, static_cast<std::ptrdiff_t>(m_rows)};
+    }
+
+    template <int rows, int cols>
+    MatrixView<const T, rows, cols> block(std::size_t row, std::size_t col) const
+    {
+        assert("Accessing matrix with index out of its bounds" && row + rows <= m_rows && col + cols <= m_cols);
+
+        return MatrixView<const T, rows, cols>{column(col) + row, 1, static_cast<std::ptrdiff_t>(m_rows)};
+    }
+
+    // overwrites the block starting at (row, col) with a fixed size matrix
+    template <int rows, int cols>
+    DenseMatrix &setBlock(std::size_t row, std::size_t col, const Matrix<T, rows, cols> &block)
+    {
+        assert("Accessing matrix with index out of its bounds" && row + rows <= m_rows && col + cols <= m_cols);
+
+        for (int j{0}; j < cols; ++j)
+        {
+            T *target = column(col + j) + row;
+            for (int i{0}; i < rows; ++i)
+            {
+                target[i] = block(i, j);
+            }
+        }
+
+        return *this;
+    }
+
+    DenseMatrix &operator+=(const DenseMatrix &other)
+    {
+        assert("Adding matrices of different sizes" && m_rows == other.m_rows && m_cols == other.m_cols);
+
+        for (std::size_t i{0}; i < m_rows * m_cols; ++i)
+        {
+            m_data[i] += other.m_data[i];
+        }
+
+        return *this;
+    }
+
+    DenseMatrix &operator-=(const DenseMatrix &other)
+    {
+        assert("Subtracting matrices of different sizes" && m_rows == other.m_rows && m_cols == other.m_cols);
+
+        for (std::size_t i{0}; i < m_rows * m_cols; ++i)
+        {
+            m_data[i] -= other.m_data[i];
+        }
+
+        return *this;
+    }
+
+    DenseMatrix &operator*=(T scalar)
+    {
+        for (std::size_t i{0}; i < m_rows * m_cols; ++i)
+        {
+            m_data[i] *= scalar;
+        }
+
+        return *this;
+    }
+
+    DenseMatrix &operator/=(T scalar)
+    {
+        assert("Division by zero" && scalar != 0);
+
+        for (std::size_t i{0}; i < m_rows * m_cols; ++i)
+        {
+            m_data[i] /= scalar;
+        }
+
+        return *this;
+    }
+
+    T trace() const
+    {
+        assert(m_rows == m_cols);
+
+        T sum{0};
+        for (std::size_t i{0}; i < m_rows; ++i)
+        {
+            sum += (*this)(i, i);
+        }
+
+        return sum;
+    }
+};
+
+template <typename T>
+DenseMatrix<T> transpose(const DenseMatrix<T> &mat)
+{
+    DenseMatrix<T> res{mat.cols(), mat.rows()};
+    for (std::size_t col{0}; col < mat.cols(); ++col)
+    {
+        for (std::size_t row{0}; row < mat.rows(); ++row)
+        {
+            res(col, row) = mat(row, col);
+        }
+    }
+
+    return res;
+}
+
+template <typename T>
+DenseMatrix<T> operator+(const DenseMatrix<T> &m1, const DenseMatrix<T> &m2)
+{
+    DenseMatrix<T> res{m1.clone()};
+    res += m2;
+
+    return res;
+}
+
+template <typename T>
+DenseMatrix<T> operator-(const DenseMatrix<T> &m1, const DenseMatrix<T> &m2)
+{
+    DenseMatrix<T> res{m1.clone()};
+    res -= m2;
+
+    return res;
+}
+
+template <typename T>
+DenseMatrix<T> operator-(const DenseMatrix<T> &mat)
+{
+    DenseMatrix<T> res{mat.clone()};
+    res *= T{-1};
+
+    return res;
+}
+
+template <typename T, typename V, typename = typename std::enable_if<std::is_arithmetic<V>::value>::type>
+DenseMatrix<T> operator*(const DenseMatrix<T> &mat, V scalar)
+{
+    DenseMatrix<T> res{mat.clone()};
+    res *= static_cast<T>(scalar);
+
+    return res;
+}
+
+template <typename T, typename V, typename = typename std::enable_if<std::is_arithmetic<V>::value>::type>
+DenseMatrix<T> operator*(V scalar, const DenseMatrix<T> &mat)
+{
+    return mat * scalar;
+}
+
+template <typename T, typename V, typename = typename std::enable_if<std::is_arithmetic<V>::value>::type>
+DenseMatrix<T> operator/(const DenseMatrix<T> &mat, V scalar)
+{
+    DenseMatrix<T> res{mat.clone()};
+    res /= static_cast<T>(scalar);
+
+    return res;
+}
+
+// C = alpha A B + beta C for dense matrices, see gemm in gemm.h
+template <typename T>
+void gemm(T alpha, const DenseMatrix<T> &a, const DenseMatrix<T> &b, T beta, DenseMatrix<T> &c)
+{
+    assert("Multiplying matrices with mismatching dimensions" && a.cols() == b.rows() && c.rows() == a.rows() &&
+           c.cols() == b.cols());
+
+    gemm(a.rows(), b.cols(), a.cols(), alpha, a.raw(), a.rows(), b.raw(), b.rows(), beta, c.raw(), c.rows());
+}
+
+namespace detail
+{
+// below this number of multiply-adds packing costs more than the blocked product saves
+constexpr std::size_t dense_gemm_threshold{32 * 32 * 32};
+} // namespace detail
+
+// small products use loops which run down the columns of the result and of m1, big ones the blocked gemm
+template <typename T>
+DenseMatrix<T> operator*(const DenseMatrix<T> &m1, const DenseMatrix<T> &m2)
+{
+    assert("Multiplying matrices with mismatching dimensions" && m1.cols() == m2.rows());
+
+    DenseMatrix<T> res{m1.rows(), m2.cols()};
+    if (m1.rows() * m1.cols() * m2.cols() >= detail::dense_gemm_threshold)
+    {
+        gemm(T{1}, m1, m2, T{0}, res);
+        return res;
+    }
+
+    for (std::size_t col{0}; col < m2.cols(); ++col)
+    {
+        T *out = res.column(col);
+        for (std::size_t i{0}; i < m1.cols(); ++i)
+        {
+            const T factor{m2(i, col)};
+            const T *in = m1.column(i);
+            for (std::size_t row{0}; row < m1.rows(); ++row)
+            {
+                out[row] += in[row] * factor;
+            }
+        }
+    }
+
+    return res;
+}
+
+template <typename T>
+DenseVector<T> operator*(const DenseMatrix<T> &mat, const DenseVector<T> &vec)
+{
+    assert("Multiplying a matrix and a vector with mismatching dimensions" && mat.cols() == vec.size());
+
+    DenseVector<T> res(mat.rows());
+    for (std::size_t col{0}; col < mat.cols(); ++col)
+    {
+        const T factor{vec(col)};
+        const T *in = mat.column(col);
+        for (std::size_t row{0}; row < mat.rows(); ++row)
+        {
+            res(row) += in[row] * factor;
+        }
+    }
+
+    return res;
+}
+
+template <typename T>
+bool operator==(const DenseMatrix<T> &m1, const DenseMatrix<T> &m2)
+{
+    if (m1.rows() != m2.rows() || m1.cols() != m2.cols())
+    {
+        return false;
+    }
+
+    for (std::size_t i{0}; i < m1.rows() * m1.cols(); ++i)
+    {
+        if (m1.raw()[i] != m2.raw()[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename T>
+bool operator!=(const DenseMatrix<T> &m1, const DenseMatrix<T> &m2)
+{
+    return !(m1 == m2);
+}
+
+template <typename T, typename = typename std::enable_if<std::is_floating_point<T>::value, T>::type>
+bool allClose(const DenseMatrix<T> &m1,
+              const DenseMatrix<T> &m2,
+              T maxDiff = std::numeric_limits<T>::epsilon(),
+              T maxRelDiff = std::numeric_limits<T>::epsilon())
+{
+    if (m1.rows() != m2.rows() || m1.cols() != m2.cols())
+    {
+        return false;
+    }
+
+    for (std::size_t i{0}; i < m1.rows() * m1.cols(); ++i)
+    {
+        if (!Util::isClose(m1.raw()[i], m2.raw()[i], maxDiff, maxRelDiff))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename T>
+std::ostream &operator<<(std::ostream &out, const DenseMatrix<T> &mat)
+{
+    out << "[ ";
+
+    for (std::size_t i{0}; i < mat.rows(); ++i)
+    {
+        out << (i ? ", [ " : "[ ");
+        for (std::size_t j{0}; j < mat.cols(); ++j)
+        {
+            out << (j ? ", " : "") << mat(i, j);
+        }
+        out << " ]";
+    }
+
+    out << " ]";
+
+    return out;
+}
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,399 @@
+#ifndef MATHLIB_CORE_MATRIX_GEMM_H
+#define MATHLIB_CORE_MATRIX_GEMM_H
+
+#include "../../util/alignedBuffer.h"
+#include "../../util/simd.h"
+#include "../../util/threadPool.h"
+#include <algorithm>
+#include <cstddef>
+
+namespace MathLib
+{
+/**
+ * Cache blocked matrix product C = alpha A B + beta C for big column major matrices (the layering of GotoBLAS/BLIS):
+ * B is split into blocks of kc x nc elements and A into blocks of mc x kc elements which are copied ("packed") into
+ * contiguous buffers that stay in the L3 and L2 cache. A micro kernel then computes mr x nr tiles of C in registers
+ * while streaming through a panel of packed A (mr values per step) and one of packed B (nr values per step), which
+ * keeps it in the L1 cache.
+ **/
+
+// portable micro kernel, the compiler keeps the small tile in registers
+template <typename T>
+struct GemmMicroKernel
+{
+    static constexpr std::size_t mr{4};
+    static constexpr std::size_t nr{4};
+    static constexpr std::size_t mc{128};
+    static constexpr std::size_t kc{256};
+    static constexpr std::size_t nc{2048};
+
+    // c (mr x nr tile, leading dimension ldc) += a (k steps of mr values) * b (k steps of nr values)
+    static void multiply(std::size_t k, const T *a, const T *b, T *c, std::size_t ldc)
+    {
+        T acc[mr * nr]{};
+        for (std::size_t p{0}; p < k; ++p)
+        {
+            for (std::size_t j{0}; j < nr; ++j)
+            {
+                for (std::size_t i{0}; i < mr; ++i)
+                {
+                    acc[j * mr + i] += a[i] * b[j];
+                }
+            }
+            a += mr;
+            b += nr;
+        }
+
+        for (std::size_t j{0}; j < nr; ++j)
+        {
+            for (std::size_t i{0}; i < mr; ++i)
+            {
+                c[j * ldc + i] += acc[j * mr + i];
+            }
+        }
+    }
+};
+
+#if defined(MATHLIB_AVX) && defined(MATHLIB_FMA)
+// 16 x 6 tile in 12 ymm accumulators, each step needs 2 loads of A and 6 broadcasts of B for 12 fmas
+template <>
+struct GemmMicroKernel<float>
+{
+    static constexpr std::size_t mr{16};
+    static constexpr std::size_t nr{6};
+    static constexpr std::size_t mc{128};
+    static constexpr std::size_t kc{384};
+    static constexpr std::size_t nc{3072};
+
+    static void multiply(std::size_t k, const float *a, const float *b, float *c, std::size_t ldc)
+    {
+        __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+        __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+        __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+        __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+        __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+        __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+        for (std::size_t p{0}; p < k; ++p)
+        {
+            const __m256 a0 = _mm256_load_ps(a);
+            const __m256 a1 = _mm256_load_ps(a + 8);
+
+            __m256 bj = _mm256_broadcast_ss(b);
+            c00 = _mm256_fmadd_ps(a0, bj, c00);
+            c01 = _mm256_fmadd_ps(a1, bj, c01);
+            bj = _mm256_broadcast_ss(b + 1);
+            c10 = _mm256_fmadd_ps(a0, bj, c10);
+            c11 = _mm256_fmadd_ps(a1, bj, c11);
+            bj = _mm256_broadcast_ss(b + 2);
+            c20 = _mm256_fmadd_ps(a0, bj, c20);
+            c21 = _mm256_fmadd_ps(a1, bj, c21);
+            bj = _mm256_broadcast_ss(b + 3);
+            c30 = _mm256_fmadd_ps(a0, bj, c30);
+            c31 = _mm256_fmadd_ps(a1, bj, c31);
+            bj = _mm256_broadcast_ss(b + 4);
+            c40 = _mm256_fmadd_ps(a0, bj, c40);
+            c41 = _mm256_fmadd_ps(a1, bj, c41);
+            bj = _mm256_broadcast_ss(b + 5);
+            c50 = _mm256_fmadd_ps(a0, bj, c50);
+            c51 = _mm256_fmadd_ps(a1, bj, c51);
+
+            a += mr;
+            b += nr;
+        }
+
+        accumulate(c, c00, c01);
+        accumulate(c + ldc, c10, c11);
+        accumulate(c + 2 * ldc, c20, c21);
+        accumulate(c + 3 * ldc, c30, c31);
+        accumulate(c + 4 * ldc, c40, c41);
+        accumulate(c + 5 * ldc, c50, c51);
+    }
+
+private:
+    static void accumulate(float *column, __m256 upper, __m256 lower)
+    {
+        _mm256_storeu_ps(column, _mm256_add_ps(_mm256_loadu_ps(column), upper));
+        _mm256_storeu_ps(column + 8, _mm256_add_ps(_mm256_loadu_ps(column + 8), lower));
+    }
+};
+
+// 8 x 6 tile, the double version of the float kernel
+template <>
+struct GemmMicroKernel<double>
+{
+    static constexpr std::size_t mr{8};
+    static constexpr std::size_t nr{6};
+    static constexpr std::size_t mc{96};
+    static constexpr std::size_t kc{256};
+    static constexpr std::size_t nc{3072};
+
+    static void multiply(std::size_t k, const double *a, const double *b, double *c, std::size_t ldc)
+    {
+        __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+        __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+        __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+        __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+        __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+        __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+
+        for (std::size_t p{0}; p < k; ++p)
+        {
+            const __m256d a0 = _mm256_load_pd(a);
+            const __m256d a1 = _mm256_load_pd(a + 4);
+
+            __m256d bj = _mm256_broadcast_sd(b);
+            c00 = _mm256_fmadd_pd(a0, bj, c00);
+            c01 = _mm256_fmadd_pd(a1, bj, c01);
+            bj = _mm256_broadcast_sd(b + 1);
+            c10 = _mm256_fmadd_pd(a0, bj, c10);
+            c11 = _mm256_fmadd_pd(a1, bj, c11);
+            bj = _mm256_broadcast_sd(b + 2);
+            c20 = _mm256_fmadd_pd(a0, bj, c20);
+            c21 = _mm256_fmadd_pd(a1, bj, c21);
+            bj = _mm256_broadcast_sd(b + 3);
+            c30 = _mm256_fmadd_pd(a0, bj, c30);
+            c31 = _mm256_fmadd_pd(a1, bj, c31);
+            bj = _mm256_broadcast_sd(b + 4);
+            c40 = _mm256_fmadd_pd(a0, bj, c40);
+            c41 = _mm256_fmadd_pd(a1, bj, c41);
+            bj = _mm256_broadcast_sd(b + 5);
+            c50 = _mm256_fmadd_pd(a0, bj, c50);
+            c51 = _mm256_fmadd_pd(a1, bj, c51);
+
+            a += mr;
+            b += nr;
+        }
+
+        accumulate(c, c00, c01);
+        accumulate(c + ldc, c10, c11);
+        accumulate(c + 2 * ldc, c20, c21);
+        accumulate(c + 3 * ldc, c30, c31);
+        accumulate(c + 4 * ldc, c40, c41);
+        accumulate(c + 5 * ldc, c50, c51);
+    }
+
+private:
+    static void accumulate(double *column, __m256d upper, __m256d lower)
+    {
+        _mm256_storeu_pd(column, _mm256_add_pd(_mm256_loadu_pd(column), upper));
+        _mm256_storeu_pd(column + 4, _mm256_add_pd(_mm256_loadu_pd(column + 4), lower));
+    }
+};
+#endif
+
+namespace detail
+{
+// copies the rows x depth block of alpha A into panels of mr rows, each panel stores its mr values per step of depth
+// contiguously, rows missing in the last panel are filled with 0
+template <typename T, std::size_t mr>
+void packGemmA(std::size_t rows, std::size_t depth, const T *a, std::size_t lda, T alpha, T *out)
+{
+    for (std::size_t i0{0}; i0 < rows; i0 += mr)
+    {
+        const std::size_t panelRows{std::min(mr, rows - i0)};
+        for (std::size_t p{0}; p < depth; ++p)
+        {
+            const T *column = a + p * lda + i0;
+            for (std::size_t i{0}; i < panelRows; ++i)
+            {
+                out[i] = alpha * column[i];
+            }
+            for (std::size_t i{panelRows}; i < mr; ++i)
+            {
+                out[i] = T{0};
+            }
+            out += mr;
+        }
+    }
+}
+
+// copies the depth x cols block of B into panels of nr columns, each panel stores its nr values per step of depth
+// contiguously, columns missing in the last panel are filled with 0
+template <typename T, std::size_t nr>
+void packGemmB(std::size_t depth, std::size_t cols, const T *b, std::size_t ldb, T *out)
+{
+    for (std::size_t j0{0}; j0 < cols; j0 += nr)
+    {
+        const std::size_t panelCols{std::min(nr, cols - j0)};
+        for (std::size_t p{0}; p < depth; ++p)
+        {
+            for (std::size_t j{0}; j < panelCols; ++j)
+            {
+                out[j] = b[(j0 + j) * ldb + p];
+            }
+            for (std::size_t j{panelCols}; j < nr; ++j)
+            {
+                out[j] = T{0};
+            }
+            out += nr;
+        }
+    }
+}
+
+// computes the tiles of one packed block of A times one packed block of B
+template <typename T>
+void gemmMacroKernel(std::size_t rows,
+                     std::size_t cols,
+                     std::size_t depth,
+                     const T *packedA,
+                     const T *packedB,
+                     T *c,
+                     std::size_t ldc)
+{
+    using Kernel = GemmMicroKernel<T>;
+    constexpr std::size_t mr{Kernel::mr};
+    constexpr std::size_t nr{Kernel::nr};
+
+    for (std::size_t j0{0}; j0 < cols; j0 += nr)
+    {
+        const std::size_t tileCols{std::min(nr, cols - j0)};
+        const T *panelB = packedB + j0 * depth;
+
+        for (std::size_t i0{0}; i0 < rows; i0 += mr)
+        {
+            const std::size_t tileRows{std::min(mr, rows - i0)};
+            const T *panelA = packedA + i0 * depth;
+            T *tile = c + j0 * ldc + i0;
+
+            if (tileRows == mr && tileCols == nr)
+            {
+                Kernel::multiply(depth, panelA, panelB, tile, ldc);
+            }
+            else
+            {
+                // the tiles at the border of C are computed in a buffer and only the valid part is added
+                alignas(Util::buffer_alignment) T buffer[mr * nr]{};
+                Kernel::multiply(depth, panelA, panelB, buffer, mr);
+                for (std::size_t j{0}; j < tileCols; ++j)
+                {
+                    for (std::size_t i{0}; i < tileRows; ++i)
+                    {
+                        tile[j * ldc + i] += buffer[j * mr + i];
+                    }
+                }
+            }
+        }
+    }
+}
+
+// the product on the calling thread
+template <typename T>
+void gemmSerial(std::size_t m,
+                std::size_t n,
+                std::size_t k,
+                T alpha,
+                const T *a,
+                std::size_t lda,
+                const T *b,
+                std::size_t ldb,
+                T beta,
+                T *c,
+                std::size_t ldc)
+{
+    using Kernel = GemmMicroKernel<T>;
+
+    if (beta != T{1})
+    {
+        for (std::size_t j{0}; j < n; ++j)
+        {
+            for (std::size_t i{0}; i < m; ++i)
+            {
+                // beta == 0 overwrites C, even if it holds NaNs
+                c[j * ldc + i] = beta == T{0} ? T{0} : beta * c[j * ldc + i];
+            }
+        }
+    }
+
+    if (m == 0 || n == 0 || k == 0 || alpha == T{0})
+    {
+        return;
+    }
+
+    // the packing buffers are sized for the biggest blocks (rounded up to full panels) actually needed
+    const std::size_t blockRows{std::min(Kernel::mc, (m + Kernel::mr - 1) / Kernel::mr * Kernel::mr)};
+    const std::size_t blockCols{std::min(Kernel::nc, (n + Kernel::nr - 1) / Kernel::nr * Kernel::nr)};
+    const std::size_t blockDepth{std::min(Kernel::kc, k)};
+    Util::AlignedBuffer<T> packedA{blockRows * blockDepth};
+    Util::AlignedBuffer<T> packedB{blockDepth * blockCols};
+
+    for (std::size_t jc{0}; jc < n; jc += Kernel::nc)
+    {
+        const std::size_t cols{std::min(Kernel::nc, n - jc)};
+
+        for (std::size_t pc{0}; pc < k; pc += Kernel::kc)
+        {
+            const std::size_t depth{std::min(Kernel::kc, k - pc)};
+            packGemmB<T, Kernel::nr>(depth, cols, b + jc * ldb + pc, ldb, packedB.data());
+
+            for (std::size_t ic{0}; ic < m; ic += Kernel::mc)
+            {
+                const std::size_t rows{std::min(Kernel::mc, m - ic)};
+                packGemmA<T, Kernel::mr>(rows, depth, a + pc * lda + ic, lda, alpha, packedA.data());
+                gemmMacroKernel(rows, cols, depth, packedA.data(), packedB.data(), c + jc * ldc + ic, ldc);
+            }
+        }
+    }
+}
+
+// products with fewer multiply-adds are not worth distributing over threads
+constexpr std::size_t gemm_parallel_threshold{128 * 128 * 128};
+} // namespace detail
+
+/**
+ * C (m x n) = alpha A (m x k) B (k x n) + beta C with column major matrices, ld* is the distance between the starts of
+ * two columns (e.g. the number of rows of the matrix a block is taken from). C must not alias A or B.
+ * Big products are split into tiles of C which are computed on the thread pool (see util/threadPool.h).
+ **/
+template <typename T>
+void gemm(std::size_t m,
+          std::size_t n,
+          std::size_t k,
+          T alpha,
+          const T *a,
+          std::size_t lda,
+          const T *b,
+          std::size_t ldb,
+          T beta,
+          T *c,
+          std::size_t ldc)
+{
+    using Kernel = GemmMicroKernel<T>;
+
+    const std::size_t threads{Util::threadCount()};
+    if (threads == 1 || m * n * k < detail::gemm_parallel_threshold)
+    {
+        detail::gemmSerial(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        return;
+    }
+
+    // the tiles are mc row blocks times strips of whole nr panels, about 4 per thread so that threads which finish
+    // early can take over tiles of the others, every tile is an independent product with its own packing buffers
+    const std::size_t rowBlocks{(m + Kernel::mc - 1) / Kernel::mc};
+    const std::size_t panels{(n + Kernel::nr - 1) / Kernel::nr};
+    const std::size_t strips{std::min(panels, (4 * threads + rowBlocks - 1) / rowBlocks)};
+    const std::size_t stripCols{(panels + strips - 1) / strips * Kernel::nr};
+    const std::size_t columnStrips{(n + stripCols - 1) / stripCols};
+
+    Util::parallelFor(0, rowBlocks * columnStrips, 1, [&](std::size_t first, std::size_t last) {
+        for (std::size_t tile{first}; tile < last; ++tile)
+        {
+            const std::size_t i0{tile % rowBlocks * Kernel::mc};
+            const std::size_t j0{tile / rowBlocks * stripCols};
+            detail::gemmSerial(std::min(Kernel::mc, m - i0),
+                               std::min(stripCols, n - j0),
+                               k,
+                               alpha,
+                               a + i0,
+                               lda,
+                               b + j0 * ldb,
+                               ldb,
+                               beta,
+                               c + j0 * ldc + i0,
+                               ldc);
+        }
+    });
+}
+} // namespace MathLib
+
+#endif
@@ -3,7 +3,11 @@
 
 #include "../../util/type_traits.h"
 #include "../Vector/point.h"
+#include "./matrixExpression.h"
+#include "./matrixInverseKernels.h"
+#include "./matrixKernels.h"
 #include "../Vector/vector.h"
+#include "../Vector/vectorView.h"
 #include <cassert>
 #include <iostream>
 #include <math.h>
@@ -11,33 +15,28 @@
 
 namespace MathLib
 {
+template <typename T, int rows, int cols>
+class MatrixView;
 
 // a template for a basic matrix of static size (data stored in column major order)
 template <typename T, int rows, int cols, typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
 class Matrix
 {
 protected:
-    T *m_data = nullptr;
+    // elements are stored inline which makes Matrix trivially copyable and free of heap allocations
+    alignas(Util::storage_alignment<T, rows * cols>::value) T m_data[rows * cols];
     friend class Matrix<T, rows - 1, cols - 1>;
     friend class Matrix<T, rows + 1, cols + 1>;
 
 public:
-    Matrix() { m_data = new T[rows * cols]; }
-
-    ~Matrix()
-    {
-        if (m_data != nullptr)
-        {
-            delete[] m_data;
-        }
-        m_data = nullptr;
-    }
+    // elements are left uninitialized unless the matrix is value initialized (Matrix<T, rows, cols>{})
+    constexpr Matrix() = default;
 
     // provide constructor that is only callable with correct number of numerical parameters
     template <typename... Tail>
-    Matrix(typename std::enable_if<sizeof...(Tail) + 1 == rows * cols && are_arithmetic<T, Tail...>{}, T>::type head,
-           Tail... tail)
-        : m_data{new T[rows * cols]}
+    constexpr Matrix(
+        typename std::enable_if<sizeof...(Tail) + 1 == rows * cols && are_arithmetic<T, Tail...>{}, T>::type head,
+        Tail... tail)
     {
         const T tmp[rows * cols]{head, T(tail)...};
 
@@ -54,10 +53,9 @@ public:
      * Constructor for initialization with column vectors
      **/
     template <typename... Tail>
-    Matrix(typename std::enable_if<sizeof...(Tail) + 1 == cols && are_same<Vector<T, rows>, Tail...>{},
-                                   Vector<T, rows>>::type head,
-           Tail... tail)
-        : m_data{new T[rows * cols]}
+    constexpr Matrix(typename std::enable_if<sizeof...(Tail) + 1 == cols && are_same<Vector<T, rows>, Tail...>{},
+                                             Vector<T, rows>>::type head,
+                     Tail... tail)
     {
         const Vector<T, rows> tmp[cols]{head, tail...};
 
@@ -72,43 +70,49 @@ public:
         }
     }
 
-    Matrix(const Matrix &other) : Matrix() { *this = other; }
-
-    Matrix(Matrix &&other) { *this = std::move(other); }
-
-    Matrix &operator=(const Matrix &other)
+    // copies and moves are memberwise copies of the inline storage
+    Matrix(const Matrix &other) = default;
+    Matrix(Matrix &&other) = default;
+    Matrix &operator=(const Matrix &other) = default;
+    Matrix &operator=(Matrix &&other) = default;
+    ~Matrix() = default;
+
+    // evaluates a lazy matrix expression (e.g. A * s + B) in a single pass over the elements
+    template <typename E,
+              typename = typename std::enable_if<
+                  is_matrix_expression<E>::value &&
+                  std::is_same<typename E::result_type, Matrix<typename E::value_type, rows, cols>>::value>::type>
+    constexpr Matrix(const E &expression)
     {
-        if (this == &other)
-        {
-            return *this;
-        }
+        assign(expression);
+    }
 
-        for (int i = 0; i < rows * cols; ++i)
+    template <typename E,
+              typename = typename std::enable_if<
+                  is_matrix_expression<E>::value &&
+                  std::is_same<typename E::result_type, Matrix<typename E::value_type, rows, cols>>::value>::type>
+    constexpr Matrix &operator=(const E &expression)
+    {
+        if (expression.aliases(m_data))
         {
-            m_data[i] = other.m_data[i];
+            // the expression reads elements of this matrix after they would be overwritten (e.g. A = transpose(A))
+            return *this = Matrix{expression};
         }
 
-        return *this;
-    }
-
-    Matrix &operator=(Matrix &&other)
-    {
-        delete this->m_data;
-        this->m_data = other.m_data;
-        other.m_data = nullptr;
+        assign(expression);
 
         return *this;
     }
 
     // copy construction and assignment with conversion
     template <typename U>
-    Matrix(const Matrix<U, rows, cols> &other) : Matrix()
+    constexpr Matrix(const Matrix<U, rows, cols> &other) : Matrix()
     {
         *this = other;
     }
 
     template <typename U>
-    Matrix<T, rows, cols> &operator=(const Matrix<U, rows, cols> &other)
+    constexpr Matrix<T, rows, cols> &operator=(const Matrix<U, rows, cols> &other)
     {
         const U *raw = other.raw();
         for (int i = 0; i < rows * cols; ++i)
@@ -120,7 +124,7 @@ public:
     }
 
     // create Matrix equal to the upper left subMatrix of the given Matrix
-    Matrix(const Matrix<T, rows + 1, cols + 1> &other) : Matrix()
+    constexpr Matrix(const Matrix<T, rows + 1, cols + 1> &other) : Matrix()
     {
         for (int i = 0; i < cols; ++i)
         {
@@ -138,7 +142,7 @@ public:
      * A 0
      * 0 1
      **/
-    Matrix(const Matrix<T, rows - 1, cols - 1> &other) : Matrix()
+    constexpr Matrix(const Matrix<T, rows - 1, cols - 1> &other) : Matrix()
     {
         for (int i = 0; i < (cols - 1); ++i)
         {
@@ -163,9 +167,9 @@ public:
         m_data[cols * rows - 1] = 1;
     }
 
-    Matrix<T, rows, cols> &negate() { return *this *= -1; }
+    constexpr Matrix<T, rows, cols> &negate() { return *this *= -1; }
 
-    Matrix<T, rows, cols> &transpose()
+    constexpr Matrix<T, rows, cols> &transpose()
     {
         assert(rows == cols);
 
@@ -182,7 +186,7 @@ public:
         return *this;
     }
 
-    Matrix<T, rows, cols> &setIdentity()
+    constexpr Matrix<T, rows, cols> &setIdentity()
     {
         assert("Using setIdentity on a matrix that is not square" && rows == cols);
 
@@ -197,35 +201,123 @@ public:
         return *this;
     }
 
-    T operator()(int row, int col) const { return m_data[col * rows + row]; }
+    constexpr T operator()(int row, int col) const { return m_data[col * rows + row]; }
 
-    T &operator()(int row, int col) { return m_data[col * rows + row]; }
+    constexpr T &operator()(int row, int col) { return m_data[col * rows + row]; }
 
-    T at(int row, int col) const
+    constexpr T at(int row, int col) const
     {
         assert("Accessing matrix with index out of its bounds" && row >= 0 && row < rows && col >= 0 && col < cols);
 
         return m_data[col * rows + row];
     }
 
-    T &at(int row, int col)
+    constexpr T &at(int row, int col)
     {
         assert("Accessing matrix with index out of its bounds" && row >= 0 && row < rows && col >= 0 && col < cols);
 
         return m_data[col * rows + row];
     }
 
-    void set(int row, int col, T val)
+    constexpr void set(int row, int col, T val)
     {
         assert("Accessing matrix with index out of its bounds" && row >= 0 && row < rows && col >= 0 && col < cols);
 
         m_data[col * rows + row] = val;
     }
 
-    // returns the internal array (BEWARE!: the internal storage is in row major order)
-    T *raw() const { return m_data; }
+    // returns the internal array (BEWARE!: the internal storage is in column major order)
+    constexpr const T *raw() const { return m_data; }
+
+    constexpr T *raw() { return m_data; }
+
+    // views which read and write the elements of a row, a column or a block in place (see matrixView.h)
+    constexpr VectorView<T, cols> row(int index)
+    {
+        assert("Accessing matrix with index out of its bounds" && index >= 0 && index < rows);
+
+        return VectorView<T, cols>{m_data + index, rows};
+    }
+
+    constexpr VectorView<const T, cols> row(int index) const
+    {
+        assert("Accessing matrix with index out of its bounds" && index >= 0 && index < rows);
+
+        return VectorView<const T, cols>{m_data + index, rows};
+    }
+
+    constexpr VectorView<T, rows> col(int index)
+    {
+        assert("Accessing matrix with index out of its bounds" && index >= 0 && index < cols);
+
+        return VectorView<T, rows>{m_data + index * rows};
+    }
+
+    constexpr VectorView<const T, rows> col(int index) const
+    {
+        assert("Accessing matrix with index out of its bounds" && index >= 0 && index < cols);
+
+        return VectorView<const T, rows>{m_data + index * rows};
+    }
+
+    // the blockRows x blockCols block starting at (row, col)
+    template <int blockRows, int blockCols>
+    constexpr MatrixView<T, blockRows, blockCols> block(int row, int col)
+    {
+        assert("Accessing matrix with index out of its bounds" && row >= 0 && col >= 0 && row + blockRows <= rows &&
+               col + blockCols <= cols);
+
+        return MatrixView<T, blockRows, blockCols>{m_data + col * rows + row, 1, rows};
+    }
+
+    template <int blockRows, int blockCols>
+    constexpr MatrixView<const T, blockRows, blockCols> block(int row, int col) const
+    {
+        assert("Accessing matrix with index out of its bounds" && row >= 0 && col >= 0 && row + blockRows <= rows &&
+               col + blockCols <= cols);
+
+        return MatrixView<const T, blockRows, blockCols>{m_data + col * rows + row, 1, rows};
+    }
+
+    template <typename E, typename = typename std::enable_if<is_matrix_expression<E>::value>::type>
+    constexpr Matrix<T, rows, cols> &operator+=(const E &expression)
+    {
+        if (expression.aliases(m_data))
+        {
+            return *this += Matrix{expression};
+        }
+
+        for (int col = 0; col < cols; ++col)
+        {
+            for (int row = 0; row < rows; ++row)
+            {
+                m_data[col * rows + row] += expression(row, col);
+            }
+        }
+
+        return *this;
+    }
+
+    template <typename E, typename = typename std::enable_if<is_matrix_expression<E>::value>::type>
+    constexpr Matrix<T, rows, cols> &operator-=(const E &expression)
+    {
+        if (expression.aliases(m_data))
+        {
+            return *this -= Matrix{expression};
+        }
+
+        for (int col = 0; col < cols; ++col)
+        {
+            for (int row = 0; row < rows; ++row)
+            {
+                m_data[col * rows + row] -= expression(row, col);
+            }
+        }
+
+        return *this;
+    }
 
-    Matrix<T, rows, cols> &operator+=(const Matrix<T, rows, cols> &other)
+    constexpr Matrix<T, rows, cols> &operator+=(const Matrix<T, rows, cols> &other)
     {
         for (int i = 0; i < rows * cols; ++i)
         {
@@ -235,7 +327,7 @@ public:
         return *this;
     }
 
-    Matrix<T, rows, cols> &operator-=(const Matrix<T, rows, cols> &other)
+    constexpr Matrix<T, rows, cols> &operator-=(const Matrix<T, rows, cols> &other)
     {
         for (int i = 0; i < rows * cols; ++i)
         {
@@ -245,8 +337,8 @@ public:
         return *this;
     }
 
-    template <typename V>
-    Matrix<T, rows, cols> &operator*=(typename std::enable_if<std::is_arithmetic<V>::value, V>::type scalar)
+    template <typename V, typename = typename std::enable_if<std::is_arithmetic<V>::value>::type>
+    constexpr Matrix<T, rows, cols> &operator*=(V scalar)
     {
         for (int i = 0; i < rows * cols; ++i)
         {
@@ -257,7 +349,7 @@ public:
     }
 
     template <typename V>
-    Matrix<T, rows, cols> &operator/=(V scalar)
+    constexpr Matrix<T, rows, cols> &operator/=(V scalar)
     {
         assert("Division by zero" && scalar != 0);
 
@@ -269,7 +361,7 @@ public:
         return *this;
     }
 
-    T trace() const
+    constexpr T trace() const
     {
         assert(rows == cols);
 
@@ -282,133 +374,149 @@ public:
 
         return sum;
     }
-};
-
-template <typename T, int rows, int cols>
-Matrix<T, cols, rows> transpose(const Matrix<T, rows, cols> &mat)
-{
-    Matrix<T, cols, rows> trans;
 
-    for (int col = 0; col < cols; ++col)
+    // closed form for matrices up to 4x4, bigger ones are decomposed with a pivoted LU decomposition
+    template <int n = rows, typename = typename std::enable_if<n == cols>::type>
+    constexpr T determinant() const
     {
-        for (int row = 0; row < rows; ++row)
+        if (std::is_constant_evaluated())
         {
-            trans.at(col, row) = mat.at(row, col);
+            return GenericMatrixInverseKernel<T, rows>::determinant(m_data);
         }
-    }
-
-    return trans;
-}
-
-template <typename T, int rows, int cols>
-Matrix<T, rows, cols> operator+(const Matrix<T, rows, cols> &m1, const Matrix<T, rows, cols> &m2)
-{
-    Matrix<T, rows, cols> sum{m1};
 
-    return sum += m2;
-}
-
-template <typename T, int rows, int cols>
-Matrix<T, rows, cols> operator-(const Matrix<T, rows, cols> &m1, const Matrix<T, rows, cols> &m2)
-{
-    Matrix<T, rows, cols> diff{m1};
-
-    return diff -= m2;
-}
+        return MatrixInverseKernel<T, rows>::determinant(m_data);
+    }
 
-template <typename T, int rows, int cols, typename V>
-Matrix<T, rows, cols> operator*(const Matrix<T, rows, cols> &m1,
-                                typename std::enable_if<std::is_arithmetic<V>::value, V>::type scalar)
-{
-    Matrix<T, rows, cols> base{m1};
+    // inverts the matrix in place (see determinant for the methods used), the matrix has to be invertible
+    template <int n = rows,
+              typename = typename std::enable_if<n == cols && std::is_floating_point<T>::value>::type>
+    constexpr Matrix<T, rows, cols> &invert()
+    {
+        [[maybe_unused]] T det{0};
+        if (std::is_constant_evaluated())
+        {
+            det = GenericMatrixInverseKernel<T, rows>::invert(m_data, m_data);
+        }
+        else
+        {
+            det = MatrixInverseKernel<T, rows>::invert(m_data, m_data);
+        }
 
-    return base *= scalar;
-}
+        assert("Inverting a singular matrix" && det != 0);
 
-template <typename T, int rows, int cols, typename V>
-Matrix<T, rows, cols> operator*(V scalar, const Matrix<T, rows, cols> &m1)
-{
-    Matrix<T, rows, cols> base{m1};
+        return *this;
+    }
 
-    return base *= scalar;
-}
+private:
+    template <typename E>
+    constexpr void assign(const E &expression)
+    {
+        for (int col = 0; col < cols; ++col)
+        {
+            for (int row = 0; row < rows; ++row)
+            {
+                m_data[col * rows + row] = expression(row, col);
+            }
+        }
+    }
+};
 
+// the products are computed by the kernels in matrixKernels.h (SIMD versions for 4x4 float and double matrices)
 template <typename T, int rowsM1, int colsM1rowsM2, int colsM2, typename V>
-Matrix<T, rowsM1, colsM2> operator*(const Matrix<T, rowsM1, colsM1rowsM2> &m1,
-                                    const Matrix<V, colsM1rowsM2, colsM2> &m2)
+constexpr Matrix<T, rowsM1, colsM2> operator*(const Matrix<T, rowsM1, colsM1rowsM2> &m1,
+                                              const Matrix<V, colsM1rowsM2, colsM2> &m2)
 {
     Matrix<T, rowsM1, colsM2> res;
 
-    for (int col{0}; col < colsM2; ++col)
+    if (std::is_constant_evaluated())
     {
-        for (int row{0}; row < rowsM1; ++row)
-        {
-            T sum{0};
-            for (int i{0}; i < colsM1rowsM2; ++i)
-            {
-                sum += m1.at(row, i) * m2.at(i, col);
-            }
-            res.set(row, col, sum);
-        }
+        GenericMatrixProductKernel<T, V, rowsM1, colsM1rowsM2, colsM2>::multiply(m1.raw(), m2.raw(), res.raw());
+    }
+    else
+    {
+        MatrixProductKernel<T, V, rowsM1, colsM1rowsM2, colsM2>::multiply(m1.raw(), m2.raw(), res.raw());
     }
 
     return res;
 }
 
 template <typename T, int rows, int cols, typename V>
-Vector<T, rows> operator*(const Matrix<T, rows, cols> &mat, const Vector<V, cols> &vec)
+constexpr Vector<T, rows> operator*(const Matrix<T, rows, cols> &mat, const Vector<V, cols> &vec)
 {
-    Vector<T, rows> res{};
+    Vector<T, rows> res;
 
-    for (int i{0}; i < rows; ++i)
+    if (std::is_constant_evaluated())
     {
-        T sum{0};
-        for (int j{0}; j < cols; ++j)
-        {
-            sum += mat.at(i, j) * vec.at(j);
-        }
-        res.set(i, sum);
+        GenericMatrixVectorKernel<T, V, rows, cols>::multiply(mat.raw(), vec.data(), res.data());
+    }
+    else
+    {
+        MatrixVectorKernel<T, V, rows, cols>::multiply(mat.raw(), vec.data(), res.data());
     }
 
     return res;
 }
 
 template <typename T, int rows, int cols, typename V>
-Point<T, rows> operator*(const Matrix<T, rows, cols> &mat, const Point<V, cols> &vec)
+constexpr Point<T, rows> operator*(const Matrix<T, rows, cols> &mat, const Point<V, cols> &point)
 {
-    Point<T, rows> res{};
+    Point<T, rows> res;
 
-    for (int i{0}; i < rows; ++i)
+    if (std::is_constant_evaluated())
     {
-        T sum{0};
-        for (int j{0}; j < cols; ++j)
-        {
-            sum += mat.at(i, j) * vec.at(j);
-        }
-        res.set(i, sum);
+        GenericMatrixVectorKernel<T, V, rows, cols>::multiply(mat.raw(), point.data(), res.data());
+    }
+    else
+    {
+        MatrixVectorKernel<T, V, rows, cols>::multiply(mat.raw(), point.data(), res.data());
     }
 
     return res;
 }
 
-template <typename T, int rows, int cols, typename V>
-Matrix<T, rows, cols> operator/(const Matrix<T, rows, cols> &m1, V scalar)
+// products involving expressions evaluate their operands first, the product itself is never lazy
+template <typename L, typename R>
+constexpr typename std::enable_if<(is_matrix_expression<L>::value || is_matrix_expression<R>::value) &&
+                                      is_matrix_operand<L>::value && is_matrix_operand<R>::value,
+                                  Matrix<matrix_value_type<L>,
+                                         matrix_traits<typename matrix_result<L>::type>::rows,
+                                         matrix_traits<typename matrix_result<R>::type>::cols>>::type
+operator*(const L &m1, const R &m2)
 {
-    Matrix<T, rows, cols> base{m1};
-
-    return base /= scalar;
+    return typename matrix_result<L>::type{m1} * typename matrix_result<R>::type{m2};
 }
 
-template <typename T, int rows, int cols>
-Matrix<T, rows, cols> operator-(const Matrix<T, rows, cols> &mat)
+// the result of transforming a vector or point of type U with a matrix with rows rows and elements of type T
+template <typename U, typename T, int rows>
+struct matrix_transform_result
+{
+};
+
+template <typename V, int size, typename T, int rows>
+struct matrix_transform_result<Vector<V, size>, T, rows>
+{
+    using type = Vector<T, rows>;
+};
+
+template <typename V, int size, typename T, int rows>
+struct matrix_transform_result<Point<V, size>, T, rows>
 {
-    Matrix<T, rows, cols> negation{mat};
+    using type = Point<T, rows>;
+};
 
-    return negation.negate();
+template <typename L, typename R>
+constexpr typename std::enable_if<
+    (is_matrix_expression<L>::value || is_vp_expression<R>::value) && is_matrix_operand<L>::value,
+    typename matrix_transform_result<typename vp_result<R>::type,
+                                     matrix_value_type<L>,
+                                     matrix_traits<typename matrix_result<L>::type>::rows>::type>::type
+operator*(const L &mat, const R &vp)
+{
+    return typename matrix_result<L>::type{mat} * typename vp_result<R>::type{vp};
 }
 
 template <typename T, int rows, int cols>
-bool operator==(const Matrix<T, rows, cols> &m1, const Matrix<T, rows, cols> &m2)
+constexpr bool operator==(const Matrix<T, rows, cols> &m1, const Matrix<T, rows, cols> &m2)
 {
     for (int i = 0; i < rows; ++i)
     {
@@ -445,13 +553,13 @@ bool allClose(const Matrix<T, rows, cols> &m1,
 }
 
 template <typename T, int rows, int cols>
-bool operator!=(const Matrix<T, rows, cols> &m1, const Matrix<T, rows, cols> &m2)
+constexpr bool operator!=(const Matrix<T, rows, cols> &m1, const Matrix<T, rows, cols> &m2)
 {
     return !(m1 == m2);
 }
 
 template <typename T, int rows, int cols>
-std::ostream &operator<<(std::ostream &out, Matrix<T, rows, cols> &mat)
+std::ostream &operator<<(std::ostream &out, const Matrix<T, rows, cols> &mat)
 {
     out << "[ ";
 
@@ -477,34 +585,109 @@ std::ostream &operator<<(std::ostream &out, Matrix<T, rows, cols> &mat)
     return out;
 }
 
+// returns the inverse of a square matrix which has to be invertible (see Matrix::invert)
+template <typename T, int n, typename = typename std::enable_if<std::is_floating_point<T>::value, T>::type>
+constexpr Matrix<T, n, n> inverse(const Matrix<T, n, n> &mat)
+{
+    Matrix<T, n, n> res{mat};
+    return res.invert();
+}
+
+/**
+ * Inverse of an affine transformation, i.e. a 4x4 matrix with the last row (0, 0, 0, 1) like the ones built from
+ * getTranslation, getRotation and getScaling. Only the linear part L has to be inverted:
+ * (L t; 0 1)^-1 = (L^-1 -L^-1 t; 0 1)
+ **/
+template <typename T, typename = typename std::enable_if<std::is_floating_point<T>::value, T>::type>
+constexpr Matrix<T, 4, 4> affineInverse(const Matrix<T, 4, 4> &mat)
+{
+    assert("Computing the affine inverse of a projective matrix" && mat(3, 0) == 0 && mat(3, 1) == 0 &&
+           mat(3, 2) == 0 && mat(3, 3) == 1);
+
+    // the rows of the adjugate of L are the cross products of its columns
+    const T *m = mat.raw();
+    const Vector<T, 3> c0{m[0], m[1], m[2]};
+    const Vector<T, 3> c1{m[4], m[5], m[6]};
+    const Vector<T, 3> c2{m[8], m[9], m[10]};
+    const Vector<T, 3> translation{m[12], m[13], m[14]};
+    const Vector<T, 3> adjugate[3]{cross(c1, c2), cross(c2, c0), cross(c0, c1)};
+
+    const T det{dot(c0, adjugate[0])};
+    assert("Inverting a singular matrix" && det != 0);
+    const T inverseDet{T{1} / det};
+
+    Matrix<T, 4, 4> res{};
+    for (int row{0}; row < 3; ++row)
+    {
+        for (int col{0}; col < 3; ++col)
+        {
+            res(row, col) = adjugate[row](col) * inverseDet;
+        }
+        res(row, 3) = -dot(adjugate[row], translation) * inverseDet;
+    }
+    res(3, 3) = 1;
+
+    return res;
+}
+
 template <typename T>
-Matrix<T, 4, 4> getTranslation(const Vector<T, 3> &translation)
+constexpr Matrix<T, 4, 4> getTranslation(const Vector<T, 3> &translation)
 {
     return Matrix<T, 4, 4>{1, 0, 0, translation(0), 0, 1, 0, translation(1), 0, 0, 1, translation(2), 0, 0, 0, 1};
 }
 
 template <typename T>
-Matrix<T, 3, 3> getScaling(const Vector<T, 3> &scaling)
+constexpr Matrix<T, 3, 3> getScaling(const Vector<T, 3> &scaling)
 {
     return Matrix<T, 3, 3>{scaling(0), 0, 0, 0, scaling(1), 0, 0, 0, scaling(2)};
 }
 
+namespace detail
+{
+// sine and cosine of a rotation angle, from Fast::sincos for float if MATHLIB_FAST_MATH is defined
+template <typename T>
+void rotationSinCos(T rad, T &s, T &c)
+{
+    if constexpr (Fast::enabled<T>)
+    {
+        Fast::sincos(rad, s, c);
+    }
+    else
+    {
+        s = sin(rad);
+        c = cos(rad);
+    }
+}
+} // namespace detail
+
 template <typename T, typename = typename std::enable_if<std::is_floating_point<T>::value, T>::type>
 Matrix<T, 3, 3> getRotateX(T rad)
 {
-    return Matrix<T, 3, 3>{1.0, 0.0, 0.0, 0.0, cos(rad), -sin(rad), 0.0, sin(rad), cos(rad)};
+    T s;
+    T c;
+    detail::rotationSinCos(rad, s, c);
+
+    return Matrix<T, 3, 3>{1.0, 0.0, 0.0, 0.0, c, -s, 0.0, s, c};
 }
 
 template <typename T, typename = typename std::enable_if<std::is_floating_point<T>::value, T>::type>
 Matrix<T, 3, 3> getRotateY(T rad)
 {
-    return Matrix<T, 3, 3>{cos(rad), 0.0, sin(rad), 0.0, 1.0, 0.0, -sin(rad), 0.0, cos(rad)};
+    T s;
+    T c;
+    detail::rotationSinCos(rad, s, c);
+
+    return Matrix<T, 3, 3>{c, 0.0, s, 0.0, 1.0, 0.0, -s, 0.0, c};
 }
 
 template <typename T, typename = typename std::enable_if<std::is_floating_point<T>::value, T>::type>
 Matrix<T, 3, 3> getRotateZ(T rad)
 {
-    return Matrix<T, 3, 3>{cos(rad), -sin(rad), 0.0, sin(rad), cos(rad), 0.0, 0.0, 0.0, 1.0};
+    T s;
+    T c;
+    detail::rotationSinCos(rad, s, c);
+
+    return Matrix<T, 3, 3>{c, -s, 0.0, s, c, 0.0, 0.0, 0.0, 1.0};
 }
 
 template <typename T, typename = typename std::enable_if<std::is_floating_point<T>::value, T>::type>
@@ -513,4 +696,8 @@ Matrix<T, 3, 3> getRotation(const Vector<T, 3> &rotation)
     return getRotateX(rotation(0)) * getRotateY(rotation(1)) * getRotateZ(rotation(2));
 }
 } // namespace MathLib
-#endif
\ No newline at end of file
+
+// the views returned by row, col and block, they need the complete Matrix
+#include "./matrixView.h"
+
+#endif
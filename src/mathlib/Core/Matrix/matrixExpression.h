@@ -0,0 +1,420 @@
+#ifndef MATHLIB_CORE_MATRIX_MATRIX_EXPRESSION_TEMPLATE
+#define MATHLIB_CORE_MATRIX_MATRIX_EXPRESSION_TEMPLATE
+
+#include "../../util/type_traits.h"
+#include "../../util/util.h"
+#include <cassert>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+
+/**
+ * Lazily evaluated expressions over matrices.
+ *
+ * Sums, differences, scalar products, negation and transposition of matrices return expression objects that only
+ * store their operands. The result is computed element by element when the expression is assigned to a Matrix, so
+ * A * s + B - transpose(C) is evaluated in a single pass without temporaries.
+ *
+ * Matrix products are not lazy: they are evaluated right away into a temporary which then takes part in the
+ * surrounding expression like any other matrix. This keeps every element from being recomputed and prevents the
+ * product from reading the destination while it is written.
+ *
+ * An assignment whose expression transposes the destination (A = transpose(A)) is detected at runtime and
+ * evaluated into a temporary first. Matrices are stored by reference inside an expression and nested expressions by
+ * value, so an expression must not outlive its operands.
+ **/
+
+namespace MathLib
+{
+template <typename T, int rows, int cols, typename>
+class Matrix;
+
+template <typename Derived, typename Result>
+class MatrixExpression;
+
+std::false_type is_matrix_impl(...);
+template <typename T, int rows, int cols, typename E>
+std::true_type is_matrix_impl(Matrix<T, rows, cols, E> const volatile &);
+
+template <typename T>
+using is_matrix = decltype(is_matrix_impl(std::declval<T &>()));
+
+std::false_type is_matrix_expression_impl(...);
+template <typename Derived, typename Result>
+std::true_type is_matrix_expression_impl(MatrixExpression<Derived, Result> const volatile &);
+
+template <typename T>
+using is_matrix_expression = decltype(is_matrix_expression_impl(std::declval<T &>()));
+
+// true for matrices and expressions over them
+template <typename T>
+using is_matrix_operand = std::integral_constant<bool, is_matrix<T>::value || is_matrix_expression<T>::value>;
+
+// element type and dimensions of a concrete Matrix type
+template <typename U>
+struct matrix_traits
+{
+};
+
+template <typename T, int numRows, int numCols, typename E>
+struct matrix_traits<Matrix<T, numRows, numCols, E>>
+{
+    using value_type = T;
+    static constexpr int rows = numRows;
+    static constexpr int cols = numCols;
+};
+
+// the concrete Matrix type an operand evaluates to
+template <typename U, typename = void>
+struct matrix_result
+{
+};
+
+template <typename U>
+struct matrix_result<U, typename std::enable_if<is_matrix<U>::value>::type>
+{
+    using type = U;
+};
+
+template <typename U>
+struct matrix_result<U, typename std::enable_if<is_matrix_expression<U>::value>::type>
+{
+    using type = typename U::result_type;
+};
+
+// the Matrix type with swapped dimensions
+template <typename U>
+struct matrix_transpose_result
+{
+};
+
+template <typename T, int rows, int cols, typename E>
+struct matrix_transpose_result<Matrix<T, rows, cols, E>>
+{
+    using type = Matrix<T, cols, rows, E>;
+};
+
+template <typename U>
+using matrix_value_type = typename matrix_traits<typename matrix_result<U>::type>::value_type;
+
+// matrices are held by reference inside an expression, nested expressions by value
+template <typename U>
+using matrix_operand_storage = typename std::conditional<is_matrix_expression<U>::value, const U, const U &>::type;
+
+namespace detail
+{
+// true if the operand reads from the given storage
+template <typename T, int rows, int cols, typename E>
+constexpr bool matrix_contains(const Matrix<T, rows, cols, E> &mat, const void *data)
+{
+    return mat.raw() == data;
+}
+
+template <typename Derived, typename Result>
+constexpr bool matrix_contains(const MatrixExpression<Derived, Result> &expression, const void *data)
+{
+    return expression.derived().contains(data);
+}
+
+// true if writing the result element by element into the given storage would change elements that are read later
+template <typename T, int rows, int cols, typename E>
+constexpr bool matrix_aliases(const Matrix<T, rows, cols, E> &, const void *)
+{
+    return false;
+}
+
+template <typename Derived, typename Result>
+constexpr bool matrix_aliases(const MatrixExpression<Derived, Result> &expression, const void *data)
+{
+    return expression.derived().aliases(data);
+}
+
+struct matrix_add_op
+{
+    template <typename A, typename B>
+    static constexpr auto apply(A a, B b) -> decltype(a + b)
+    {
+        return a + b;
+    }
+};
+
+struct matrix_subtract_op
+{
+    template <typename A, typename B>
+    static constexpr auto apply(A a, B b) -> decltype(a - b)
+    {
+        return a - b;
+    }
+};
+
+struct matrix_multiply_op
+{
+    template <typename A, typename B>
+    static constexpr auto apply(A a, B b) -> decltype(a * b)
+    {
+        return a * b;
+    }
+};
+
+struct matrix_divide_op
+{
+    template <typename A, typename B>
+    static constexpr auto apply(A a, B b) -> decltype(a / b)
+    {
+        return a / b;
+    }
+};
+
+struct matrix_negate_op
+{
+    template <typename A>
+    static constexpr A apply(A a)
+    {
+        return -a;
+    }
+};
+} // namespace detail
+
+template <typename Derived, typename Result>
+class MatrixExpression
+{
+public:
+    using result_type = Result;
+    using value_type = typename matrix_traits<Result>::value_type;
+
+    constexpr const Derived &derived() const { return static_cast<const Derived &>(*this); }
+
+    constexpr int rows() const { return matrix_traits<Result>::rows; }
+
+    constexpr int cols() const { return matrix_traits<Result>::cols; }
+
+    constexpr value_type at(int row, int col) const
+    {
+        assert("Accessing matrix with index out of its bounds" && row >= 0 && row < matrix_traits<Result>::rows &&
+               col >= 0 && col < matrix_traits<Result>::cols);
+
+        return derived()(row, col);
+    }
+
+    // computes all elements of the expression
+    constexpr Result eval() const { return Result{derived()}; }
+};
+
+// element-wise combination of two matrix operands of the same type
+template <typename Op, typename L, typename R>
+class MatrixBinaryExpression
+    : public MatrixExpression<MatrixBinaryExpression<Op, L, R>, typename matrix_result<L>::type>
+{
+private:
+    matrix_operand_storage<L> m_lhs;
+    matrix_operand_storage<R> m_rhs;
+
+public:
+    using value_type = matrix_value_type<L>;
+
+    constexpr MatrixBinaryExpression(const L &lhs, const R &rhs) : m_lhs(lhs), m_rhs(rhs) {}
+
+    constexpr value_type operator()(int row, int col) const
+    {
+        return static_cast<value_type>(Op::apply(m_lhs(row, col), m_rhs(row, col)));
+    }
+
+    constexpr bool contains(const void *data) const
+    {
+        return detail::matrix_contains(m_lhs, data) || detail::matrix_contains(m_rhs, data);
+    }
+
+    constexpr bool aliases(const void *data) const
+    {
+        return detail::matrix_aliases(m_lhs, data) || detail::matrix_aliases(m_rhs, data);
+    }
+};
+
+// element-wise combination of a matrix operand with a scalar
+template <typename Op, typename E, typename S>
+class MatrixScalarExpression
+    : public MatrixExpression<MatrixScalarExpression<Op, E, S>, typename matrix_result<E>::type>
+{
+private:
+    matrix_operand_storage<E> m_expression;
+    S m_scalar;
+
+public:
+    using value_type = matrix_value_type<E>;
+
+    constexpr MatrixScalarExpression(const E &expression, S scalar) : m_expression(expression), m_scalar(scalar) {}
+
+    constexpr value_type operator()(int row, int col) const
+    {
+        return static_cast<value_type>(Op::apply(m_expression(row, col), m_scalar));
+    }
+
+    constexpr bool contains(const void *data) const { return detail::matrix_contains(m_expression, data); }
+
+    constexpr bool aliases(const void *data) const { return detail::matrix_aliases(m_expression, data); }
+};
+
+// element-wise function applied to a matrix operand
+template <typename Op, typename E>
+class MatrixUnaryExpression : public MatrixExpression<MatrixUnaryExpression<Op, E>, typename matrix_result<E>::type>
+{
+private:
+    matrix_operand_storage<E> m_expression;
+
+public:
+    using value_type = matrix_value_type<E>;
+
+    constexpr explicit MatrixUnaryExpression(const E &expression) : m_expression(expression) {}
+
+    constexpr value_type operator()(int row, int col) const
+    {
+        return static_cast<value_type>(Op::apply(m_expression(row, col)));
+    }
+
+    constexpr bool contains(const void *data) const { return detail::matrix_contains(m_expression, data); }
+
+    constexpr bool aliases(const void *data) const { return detail::matrix_aliases(m_expression, data); }
+};
+
+// transposed view of a matrix operand
+template <typename E>
+class MatrixTransposeExpression
+    : public MatrixExpression<MatrixTransposeExpression<E>,
+                              typename matrix_transpose_result<typename matrix_result<E>::type>::type>
+{
+private:
+    matrix_operand_storage<E> m_expression;
+
+public:
+    using value_type = matrix_value_type<E>;
+
+    constexpr explicit MatrixTransposeExpression(const E &expression) : m_expression(expression) {}
+
+    constexpr value_type operator()(int row, int col) const { return m_expression(col, row); }
+
+    constexpr bool contains(const void *data) const { return detail::matrix_contains(m_expression, data); }
+
+    // element (row, col) of the result reads element (col, row) of the operand
+    constexpr bool aliases(const void *data) const { return detail::matrix_contains(m_expression, data); }
+};
+
+template <typename L, typename R>
+constexpr typename std::enable_if<std::is_same<typename matrix_result<L>::type, typename matrix_result<R>::type>::value,
+                                  MatrixBinaryExpression<detail::matrix_add_op, L, R>>::type
+operator+(const L &m1, const R &m2)
+{
+    return {m1, m2};
+}
+
+template <typename L, typename R>
+constexpr typename std::enable_if<std::is_same<typename matrix_result<L>::type, typename matrix_result<R>::type>::value,
+                                  MatrixBinaryExpression<detail::matrix_subtract_op, L, R>>::type
+operator-(const L &m1, const R &m2)
+{
+    return {m1, m2};
+}
+
+template <typename E, typename V>
+constexpr typename std::enable_if<is_matrix_operand<E>::value && std::is_arithmetic<V>::value,
+                                  MatrixScalarExpression<detail::matrix_multiply_op, E, V>>::type
+operator*(const E &mat, V scalar)
+{
+    return {mat, scalar};
+}
+
+template <typename E, typename V>
+constexpr typename std::enable_if<is_matrix_operand<E>::value && std::is_arithmetic<V>::value,
+                                  MatrixScalarExpression<detail::matrix_multiply_op, E, V>>::type
+operator*(V scalar, const E &mat)
+{
+    return {mat, scalar};
+}
+
+template <typename E, typename V>
+constexpr typename std::enable_if<is_matrix_operand<E>::value && std::is_arithmetic<V>::value,
+                                  MatrixScalarExpression<detail::matrix_divide_op, E, V>>::type
+operator/(const E &mat, V scalar)
+{
+    assert("Division by zero" && scalar != 0);
+
+    return {mat, scalar};
+}
+
+template <typename E>
+constexpr typename std::enable_if<is_matrix_operand<E>::value, MatrixUnaryExpression<detail::matrix_negate_op, E>>::type
+operator-(const E &mat)
+{
+    return MatrixUnaryExpression<detail::matrix_negate_op, E>{mat};
+}
+
+template <typename E>
+constexpr typename std::enable_if<is_matrix_operand<E>::value, MatrixTransposeExpression<E>>::type
+transpose(const E &mat)
+{
+    return MatrixTransposeExpression<E>{mat};
+}
+
+// comparisons where at least one side is an expression
+template <typename L, typename R>
+constexpr typename std::enable_if<
+    (is_matrix_expression<L>::value || is_matrix_expression<R>::value) &&
+        std::is_same<typename matrix_result<L>::type, typename matrix_result<R>::type>::value,
+    bool>::type
+operator==(const L &m1, const R &m2)
+{
+    for (int i = 0; i < matrix_traits<typename matrix_result<L>::type>::rows; ++i)
+    {
+        for (int j = 0; j < matrix_traits<typename matrix_result<L>::type>::cols; ++j)
+        {
+            if (m1(i, j) != m2(i, j))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+template <typename L, typename R>
+constexpr typename std::enable_if<
+    (is_matrix_expression<L>::value || is_matrix_expression<R>::value) &&
+        std::is_same<typename matrix_result<L>::type, typename matrix_result<R>::type>::value,
+    bool>::type
+operator!=(const L &m1, const R &m2)
+{
+    return !(m1 == m2);
+}
+
+template <typename L, typename R>
+typename std::enable_if<(is_matrix_expression<L>::value || is_matrix_expression<R>::value) &&
+                            std::is_same<typename matrix_result<L>::type, typename matrix_result<R>::type>::value &&
+                            std::is_floating_point<matrix_value_type<L>>::value,
+                        bool>::type
+allClose(const L &m1,
+         const R &m2,
+         matrix_value_type<L> maxDiff = std::numeric_limits<matrix_value_type<L>>::epsilon(),
+         matrix_value_type<L> maxRelDiff = std::numeric_limits<matrix_value_type<L>>::epsilon())
+{
+    for (int i = 0; i < matrix_traits<typename matrix_result<L>::type>::rows; ++i)
+    {
+        for (int j = 0; j < matrix_traits<typename matrix_result<L>::type>::cols; ++j)
+        {
+            if (!Util::isClose(m1(i, j), m2(i, j), maxDiff, maxRelDiff))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+template <typename Derived, typename Result>
+std::ostream &operator<<(std::ostream &out, const MatrixExpression<Derived, Result> &expression)
+{
+    return out << expression.eval();
+}
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,450 @@
+#ifndef MATHLIB_CORE_MATRIX_MATRIX_INVERSE_KERNELS_H
+#define MATHLIB_CORE_MATRIX_MATRIX_INVERSE_KERNELS_H
+
+#include "../../util/simd.h"
+#include <type_traits>
+
+namespace MathLib
+{
+// Kernels behind Matrix::determinant and Matrix::invert. Like the product kernels they work on the raw column major
+// storage: 2x2, 3x3 and 4x4 matrices use closed form expressions, bigger ones a LU decomposition with partial
+// pivoting. The 4x4 float inverse is specialized with SSE if the instruction set is enabled (see util/simd.h).
+
+namespace detail
+{
+template <typename T>
+constexpr T absolute(T value)
+{
+    return value < T{0} ? -value : value;
+}
+
+/**
+ * LU decomposition with partial pivoting of the n x n column major matrix lu (in place): P A = L U with the unit lower
+ * triangular L stored below the diagonal and U on and above it. Row i of P A is row permutation[i] of A.
+ * Returns the sign of the permutation (1 or -1) or 0 if the matrix is singular.
+ **/
+template <typename T, int n>
+constexpr int luDecompose(T *lu, int *permutation)
+{
+    int sign{1};
+    for (int i{0}; i < n; ++i)
+    {
+        permutation[i] = i;
+    }
+
+    for (int k{0}; k < n; ++k)
+    {
+        // the row with the biggest element in column k becomes the pivot row
+        int pivot{k};
+        for (int row{k + 1}; row < n; ++row)
+        {
+            if (absolute(lu[k * n + row]) > absolute(lu[k * n + pivot]))
+            {
+                pivot = row;
+            }
+        }
+
+        if (lu[k * n + pivot] == T{0})
+        {
+            return 0;
+        }
+
+        if (pivot != k)
+        {
+            for (int col{0}; col < n; ++col)
+            {
+                const T tmp{lu[col * n + k]};
+                lu[col * n + k] = lu[col * n + pivot];
+                lu[col * n + pivot] = tmp;
+            }
+
+            const int tmp{permutation[k]};
+            permutation[k] = permutation[pivot];
+            permutation[pivot] = tmp;
+            sign = -sign;
+        }
+
+        const T inversePivot{T{1} / lu[k * n + k]};
+        for (int row{k + 1}; row < n; ++row)
+        {
+            lu[k * n + row] *= inversePivot;
+        }
+
+        // the column major storage makes the update of the trailing sub-matrix a series of axpys on its columns
+        for (int col{k + 1}; col < n; ++col)
+        {
+            const T factor{lu[col * n + k]};
+            for (int row{k + 1}; row < n; ++row)
+            {
+                lu[col * n + row] -= lu[k * n + row] * factor;
+            }
+        }
+    }
+
+    return sign;
+}
+
+// solves A x = b with the decomposition computed by luDecompose, x may alias b
+template <typename T, int n>
+constexpr void luSolve(const T *lu, const int *permutation, const T *b, T *x)
+{
+    T y[n]{};
+    for (int i{0}; i < n; ++i)
+    {
+        y[i] = b[permutation[i]];
+    }
+
+    // forward substitution with L (unit diagonal)
+    for (int col{0}; col < n; ++col)
+    {
+        for (int row{col + 1}; row < n; ++row)
+        {
+            y[row] -= lu[col * n + row] * y[col];
+        }
+    }
+
+    // backward substitution with U
+    for (int col{n - 1}; col >= 0; --col)
+    {
+        y[col] /= lu[col * n + col];
+        for (int row{0}; row < col; ++row)
+        {
+            y[row] -= lu[col * n + row] * y[col];
+        }
+    }
+
+    for (int i{0}; i < n; ++i)
+    {
+        x[i] = y[i];
+    }
+}
+} // namespace detail
+
+// determinant(m) and out = m^-1 for an n x n matrix. invert returns the determinant of m and leaves out untouched if
+// it is 0, out may alias m.
+template <typename T, int n>
+struct GenericMatrixInverseKernel
+{
+    // integer matrices are decomposed in double precision and the determinant is rounded afterwards
+    using lu_type = typename std::conditional<std::is_floating_point<T>::value, T, double>::type;
+
+    static constexpr T determinant(const T *m)
+    {
+        lu_type lu[n * n]{};
+        for (int i{0}; i < n * n; ++i)
+        {
+            lu[i] = static_cast<lu_type>(m[i]);
+        }
+
+        int permutation[n]{};
+        lu_type det = detail::luDecompose<lu_type, n>(lu, permutation);
+        for (int i{0}; i < n; ++i)
+        {
+            det *= lu[i * n + i];
+        }
+
+        if constexpr (std::is_floating_point<T>::value)
+        {
+            return det;
+        }
+        else
+        {
+            return static_cast<T>(det < 0 ? det - 0.5 : det + 0.5);
+        }
+    }
+
+    static constexpr T invert(const T *m, T *out)
+    {
+        static_assert(std::is_floating_point<T>::value, "Only matrices of floating point numbers can be inverted");
+
+        T lu[n * n]{};
+        for (int i{0}; i < n * n; ++i)
+        {
+            lu[i] = m[i];
+        }
+
+        int permutation[n]{};
+        T det = detail::luDecompose<T, n>(lu, permutation);
+        if (det == T{0})
+        {
+            return det;
+        }
+
+        for (int i{0}; i < n; ++i)
+        {
+            det *= lu[i * n + i];
+        }
+
+        // the columns of the inverse are the solutions for the columns of the identity
+        for (int col{0}; col < n; ++col)
+        {
+            T *column = out + col * n;
+            for (int row{0}; row < n; ++row)
+            {
+                column[row] = row == col ? T{1} : T{0};
+            }
+            detail::luSolve<T, n>(lu, permutation, column, column);
+        }
+
+        return det;
+    }
+};
+
+template <typename T>
+struct GenericMatrixInverseKernel<T, 2>
+{
+    static constexpr T determinant(const T *m) { return m[0] * m[3] - m[2] * m[1]; }
+
+    static constexpr T invert(const T *m, T *out)
+    {
+        const T det{determinant(m)};
+        if (det == T{0})
+        {
+            return det;
+        }
+
+        const T inverseDet{T{1} / det};
+        const T m0{m[0]};
+        out[0] = m[3] * inverseDet;
+        out[1] = -m[1] * inverseDet;
+        out[2] = -m[2] * inverseDet;
+        out[3] = m0 * inverseDet;
+
+        return det;
+    }
+};
+
+/**
+ * With the columns c0, c1 and c2 of the matrix the rows of the adjugate are c1 x c2, c2 x c0 and c0 x c1 and the
+ * determinant is c0 . (c1 x c2)
+ **/
+template <typename T>
+struct GenericMatrixInverseKernel<T, 3>
+{
+    static constexpr T determinant(const T *m)
+    {
+        return m[0] * (m[4] * m[8] - m[5] * m[7]) + m[1] * (m[5] * m[6] - m[3] * m[8]) +
+               m[2] * (m[3] * m[7] - m[4] * m[6]);
+    }
+
+    static constexpr T invert(const T *m, T *out)
+    {
+        const T adjugate[9]{m[4] * m[8] - m[5] * m[7],
+                            m[2] * m[7] - m[1] * m[8],
+                            m[1] * m[5] - m[2] * m[4],
+                            m[5] * m[6] - m[3] * m[8],
+                            m[0] * m[8] - m[2] * m[6],
+                            m[2] * m[3] - m[0] * m[5],
+                            m[3] * m[7] - m[4] * m[6],
+                            m[1] * m[6] - m[0] * m[7],
+                            m[0] * m[4] - m[1] * m[3]};
+
+        const T det{m[0] * adjugate[0] + m[1] * adjugate[3] + m[2] * adjugate[6]};
+        if (det == T{0})
+        {
+            return det;
+        }
+
+        const T inverseDet{T{1} / det};
+        for (int i{0}; i < 9; ++i)
+        {
+            out[i] = adjugate[i] * inverseDet;
+        }
+
+        return det;
+    }
+};
+
+/**
+ * Cofactor expansion using the 2x2 determinants of the first two (s) and the last two (c) columns. Both are shared
+ * between the determinant and all 16 cofactors.
+ **/
+template <typename T>
+struct GenericMatrixInverseKernel<T, 4>
+{
+    static constexpr T determinant(const T *m)
+    {
+        T s[6]{}, c[6]{};
+        subDeterminants(m, s, c);
+
+        return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+    }
+
+    static constexpr T invert(const T *m, T *out)
+    {
+        T s[6]{}, c[6]{};
+        subDeterminants(m, s, c);
+
+        const T det{s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0]};
+        if (det == T{0})
+        {
+            return det;
+        }
+
+        // these are the cofactors of the transposed matrix (its rows are our columns), the transposed inverse is the
+        // inverse in column major order
+        const T adjugate[16]{m[5] * c[5] - m[6] * c[4] + m[7] * c[3],
+                             -m[1] * c[5] + m[2] * c[4] - m[3] * c[3],
+                             m[13] * s[5] - m[14] * s[4] + m[15] * s[3],
+                             -m[9] * s[5] + m[10] * s[4] - m[11] * s[3],
+                             -m[4] * c[5] + m[6] * c[2] - m[7] * c[1],
+                             m[0] * c[5] - m[2] * c[2] + m[3] * c[1],
+                             -m[12] * s[5] + m[14] * s[2] - m[15] * s[1],
+                             m[8] * s[5] - m[10] * s[2] + m[11] * s[1],
+                             m[4] * c[4] - m[5] * c[2] + m[7] * c[0],
+                             -m[0] * c[4] + m[1] * c[2] - m[3] * c[0],
+                             m[12] * s[4] - m[13] * s[2] + m[15] * s[0],
+                             -m[8] * s[4] + m[9] * s[2] - m[11] * s[0],
+                             -m[4] * c[3] + m[5] * c[1] - m[6] * c[0],
+                             m[0] * c[3] - m[1] * c[1] + m[2] * c[0],
+                             -m[12] * s[3] + m[13] * s[1] - m[14] * s[0],
+                             m[8] * s[3] - m[9] * s[1] + m[10] * s[0]};
+
+        const T inverseDet{T{1} / det};
+        for (int i{0}; i < 16; ++i)
+        {
+            out[i] = adjugate[i] * inverseDet;
+        }
+
+        return det;
+    }
+
+private:
+    static constexpr void subDeterminants(const T *m, T *s, T *c)
+    {
+        s[0] = m[0] * m[5] - m[4] * m[1];
+        s[1] = m[0] * m[6] - m[4] * m[2];
+        s[2] = m[0] * m[7] - m[4] * m[3];
+        s[3] = m[1] * m[6] - m[5] * m[2];
+        s[4] = m[1] * m[7] - m[5] * m[3];
+        s[5] = m[2] * m[7] - m[6] * m[3];
+
+        c[0] = m[8] * m[13] - m[12] * m[9];
+        c[1] = m[8] * m[14] - m[12] * m[10];
+        c[2] = m[8] * m[15] - m[12] * m[11];
+        c[3] = m[9] * m[14] - m[13] * m[10];
+        c[4] = m[9] * m[15] - m[13] * m[11];
+        c[5] = m[10] * m[15] - m[14] * m[11];
+    }
+};
+
+// the versions above are usable in constant expressions, the kernels below are the ones selected at runtime
+template <typename T, int n>
+struct MatrixInverseKernel : GenericMatrixInverseKernel<T, n>
+{
+};
+
+#if defined(MATHLIB_SSE2)
+namespace detail
+{
+// 2x2 matrices are stored in one register as (m00, m01, m10, m11)
+
+// a * b
+inline __m128 mat2Multiply(__m128 a, __m128 b)
+{
+    return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+                      _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)),
+                                 _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+// adjugate(a) * b
+inline __m128 mat2AdjugateMultiply(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+                      _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)),
+                                 _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+}
+
+// a * adjugate(b)
+inline __m128 mat2MultiplyAdjugate(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+                      _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)),
+                                 _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+inline __m128 broadcastLane(__m128 value, int lane)
+{
+    switch (lane)
+    {
+    case 0:
+        return _mm_shuffle_ps(value, value, _MM_SHUFFLE(0, 0, 0, 0));
+    case 1:
+        return _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 1, 1, 1));
+    case 2:
+        return _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 2, 2, 2));
+    default:
+        return _mm_shuffle_ps(value, value, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+}
+} // namespace detail
+
+/**
+ * Blockwise inversion of M = (A B; C D) with 2x2 blocks which only needs the 2x2 adjugates and determinants:
+ * M^-1 = 1 / |M| (X Y; Z W) with adjugate(X) = |D| A - B adjugate(D) C, adjugate(W) = |A| D - C adjugate(A) B,
+ * adjugate(Y) = |B| C - D adjugate(adjugate(A) B), adjugate(Z) = |C| B - A adjugate(adjugate(D) C) and
+ * |M| = |A| |D| + |B| |C| - trace(adjugate(A) B adjugate(D) C)
+ * The columns are treated as rows which inverts the transposed matrix and gives the inverse in column major order.
+ **/
+template <>
+struct MatrixInverseKernel<float, 4> : GenericMatrixInverseKernel<float, 4>
+{
+    static float invert(const float *m, float *out)
+    {
+        const __m128 r0 = _mm_loadu_ps(m);
+        const __m128 r1 = _mm_loadu_ps(m + 4);
+        const __m128 r2 = _mm_loadu_ps(m + 8);
+        const __m128 r3 = _mm_loadu_ps(m + 12);
+
+        const __m128 a = _mm_movelh_ps(r0, r1);
+        const __m128 b = _mm_movehl_ps(r1, r0);
+        const __m128 c = _mm_movelh_ps(r2, r3);
+        const __m128 d = _mm_movehl_ps(r3, r2);
+
+        // (|A|, |B|, |C|, |D|)
+        const __m128 blockDets =
+            _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(2, 0, 2, 0)),
+                                  _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(3, 1, 3, 1))),
+                       _mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(3, 1, 3, 1)),
+                                  _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(2, 0, 2, 0))));
+        const __m128 detA = detail::broadcastLane(blockDets, 0);
+        const __m128 detB = detail::broadcastLane(blockDets, 1);
+        const __m128 detC = detail::broadcastLane(blockDets, 2);
+        const __m128 detD = detail::broadcastLane(blockDets, 3);
+
+        const __m128 adjDC = detail::mat2AdjugateMultiply(d, c);
+        const __m128 adjAB = detail::mat2AdjugateMultiply(a, b);
+
+        // trace(adjugate(A) B adjugate(D) C) summed into all lanes
+        __m128 trace = _mm_mul_ps(adjAB, _mm_shuffle_ps(adjDC, adjDC, _MM_SHUFFLE(3, 1, 2, 0)));
+        trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(2, 3, 0, 1)));
+        trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(1, 0, 3, 2)));
+
+        const __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+        const float detValue = _mm_cvtss_f32(det);
+        if (detValue == 0.0f)
+        {
+            return detValue;
+        }
+
+        // the signs turn the adjugates of the blocks back into the blocks
+        const __m128 inverseDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+        const __m128 x = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(detD, a), detail::mat2Multiply(b, adjDC)), inverseDet);
+        const __m128 w = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(detA, d), detail::mat2Multiply(c, adjAB)), inverseDet);
+        const __m128 y =
+            _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(detB, c), detail::mat2MultiplyAdjugate(d, adjAB)), inverseDet);
+        const __m128 z =
+            _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(detC, b), detail::mat2MultiplyAdjugate(a, adjDC)), inverseDet);
+
+        _mm_storeu_ps(out, _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3)));
+        _mm_storeu_ps(out + 4, _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)));
+        _mm_storeu_ps(out + 8, _mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3)));
+        _mm_storeu_ps(out + 12, _mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2)));
+
+        return detValue;
+    }
+};
+#endif
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,210 @@
+#ifndef MATHLIB_CORE_MATRIX_MATRIX_KERNELS_H
+#define MATHLIB_CORE_MATRIX_MATRIX_KERNELS_H
+
+#include "../../util/simd.h"
+
+namespace MathLib
+{
+// Kernels behind the matrix products. They work on the raw column major storage of the operands, the generic
+// versions are plain loops and the 4x4 float and double versions are specialized with SSE/AVX intrinsics if the
+// instruction sets are enabled at compile time (see util/simd.h).
+
+// out (rows x cols) = m1 (rows x inner) * m2 (inner x cols), out must not alias m1 or m2
+template <typename T, typename V, int rows, int inner, int cols>
+struct GenericMatrixProductKernel
+{
+    static constexpr void multiply(const T *m1, const V *m2, T *out)
+    {
+        for (int col{0}; col < cols; ++col)
+        {
+            for (int row{0}; row < rows; ++row)
+            {
+                T sum{0};
+                for (int i{0}; i < inner; ++i)
+                {
+                    sum += m1[i * rows + row] * m2[col * inner + i];
+                }
+                out[col * rows + row] = sum;
+            }
+        }
+    }
+};
+
+// out (rows) = mat (rows x cols) * vec (cols), out must not alias mat or vec
+template <typename T, typename V, int rows, int cols>
+struct GenericMatrixVectorKernel
+{
+    static constexpr void multiply(const T *mat, const V *vec, T *out)
+    {
+        for (int row{0}; row < rows; ++row)
+        {
+            T sum{0};
+            for (int col{0}; col < cols; ++col)
+            {
+                sum += mat[col * rows + row] * vec[col];
+            }
+            out[row] = sum;
+        }
+    }
+};
+
+// the loops above are usable in constant expressions, the kernels below are the ones selected at runtime
+template <typename T, typename V, int rows, int inner, int cols>
+struct MatrixProductKernel : GenericMatrixProductKernel<T, V, rows, inner, cols>
+{
+};
+
+template <typename T, typename V, int rows, int cols>
+struct MatrixVectorKernel : GenericMatrixVectorKernel<T, V, rows, cols>
+{
+};
+
+#if defined(MATHLIB_SSE2)
+namespace detail
+{
+inline __m128 madd(__m128 a, __m128 b, __m128 c)
+{
+#if defined(MATHLIB_FMA)
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+// linear combination of the four columns of a 4x4 float matrix
+inline __m128 combineColumns(__m128 c0, __m128 c1, __m128 c2, __m128 c3, float x, float y, float z, float w)
+{
+    __m128 res = _mm_mul_ps(c0, _mm_set1_ps(x));
+    res = madd(c1, _mm_set1_ps(y), res);
+    res = madd(c2, _mm_set1_ps(z), res);
+    return madd(c3, _mm_set1_ps(w), res);
+}
+
+#if defined(MATHLIB_AVX)
+inline __m256d madd(__m256d a, __m256d b, __m256d c)
+{
+#if defined(MATHLIB_FMA)
+    return _mm256_fmadd_pd(a, b, c);
+#else
+    return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#endif
+}
+
+// linear combination of the four columns of a 4x4 double matrix
+inline __m256d combineColumns(__m256d c0, __m256d c1, __m256d c2, __m256d c3, const double *factors)
+{
+    __m256d res = _mm256_mul_pd(c0, _mm256_broadcast_sd(factors));
+    res = madd(c1, _mm256_broadcast_sd(factors + 1), res);
+    res = madd(c2, _mm256_broadcast_sd(factors + 2), res);
+    return madd(c3, _mm256_broadcast_sd(factors + 3), res);
+}
+#else
+// linear combination of the four columns of a 4x4 double matrix, each column is split into two halves
+inline void combineColumns(const __m128d *columns, const double *factors, double *out)
+{
+    for (int half{0}; half < 2; ++half)
+    {
+        __m128d res = _mm_mul_pd(columns[half], _mm_set1_pd(factors[0]));
+        for (int col{1}; col < 4; ++col)
+        {
+            res = _mm_add_pd(res, _mm_mul_pd(columns[2 * col + half], _mm_set1_pd(factors[col])));
+        }
+        _mm_storeu_pd(out + 2 * half, res);
+    }
+}
+#endif
+} // namespace detail
+
+template <>
+struct MatrixProductKernel<float, float, 4, 4, 4>
+{
+    static void multiply(const float *m1, const float *m2, float *out)
+    {
+        const __m128 c0 = _mm_loadu_ps(m1);
+        const __m128 c1 = _mm_loadu_ps(m1 + 4);
+        const __m128 c2 = _mm_loadu_ps(m1 + 8);
+        const __m128 c3 = _mm_loadu_ps(m1 + 12);
+
+        for (int col{0}; col < 4; ++col)
+        {
+            const float *factors = m2 + 4 * col;
+            _mm_storeu_ps(out + 4 * col,
+                          detail::combineColumns(c0, c1, c2, c3, factors[0], factors[1], factors[2], factors[3]));
+        }
+    }
+};
+
+template <>
+struct MatrixVectorKernel<float, float, 4, 4>
+{
+    static void multiply(const float *mat, const float *vec, float *out)
+    {
+        _mm_storeu_ps(out,
+                      detail::combineColumns(_mm_loadu_ps(mat),
+                                             _mm_loadu_ps(mat + 4),
+                                             _mm_loadu_ps(mat + 8),
+                                             _mm_loadu_ps(mat + 12),
+                                             vec[0],
+                                             vec[1],
+                                             vec[2],
+                                             vec[3]));
+    }
+};
+
+template <>
+struct MatrixProductKernel<double, double, 4, 4, 4>
+{
+    static void multiply(const double *m1, const double *m2, double *out)
+    {
+#if defined(MATHLIB_AVX)
+        const __m256d c0 = _mm256_loadu_pd(m1);
+        const __m256d c1 = _mm256_loadu_pd(m1 + 4);
+        const __m256d c2 = _mm256_loadu_pd(m1 + 8);
+        const __m256d c3 = _mm256_loadu_pd(m1 + 12);
+
+        for (int col{0}; col < 4; ++col)
+        {
+            _mm256_storeu_pd(out + 4 * col, detail::combineColumns(c0, c1, c2, c3, m2 + 4 * col));
+        }
+#else
+        __m128d columns[8];
+        for (int i{0}; i < 8; ++i)
+        {
+            columns[i] = _mm_loadu_pd(m1 + 2 * i);
+        }
+
+        for (int col{0}; col < 4; ++col)
+        {
+            detail::combineColumns(columns, m2 + 4 * col, out + 4 * col);
+        }
+#endif
+    }
+};
+
+template <>
+struct MatrixVectorKernel<double, double, 4, 4>
+{
+    static void multiply(const double *mat, const double *vec, double *out)
+    {
+#if defined(MATHLIB_AVX)
+        _mm256_storeu_pd(out,
+                         detail::combineColumns(_mm256_loadu_pd(mat),
+                                                _mm256_loadu_pd(mat + 4),
+                                                _mm256_loadu_pd(mat + 8),
+                                                _mm256_loadu_pd(mat + 12),
+                                                vec));
+#else
+        __m128d columns[8];
+        for (int i{0}; i < 8; ++i)
+        {
+            columns[i] = _mm_loadu_pd(mat + 2 * i);
+        }
+
+        detail::combineColumns(columns, vec, out);
+#endif
+    }
+};
+#endif
+} // namespace MathLib
+
+#endif
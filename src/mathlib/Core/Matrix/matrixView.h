@@ -0,0 +1,168 @@
+#ifndef MATHLIB_CORE_MATRIX_MATRIX_VIEW_TEMPLATE
+#define MATHLIB_CORE_MATRIX_MATRIX_VIEW_TEMPLATE
+
+#include "../Vector/vectorView.h"
+#include "./matrix.h"
+#include "./matrixExpression.h"
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace MathLib
+{
+/**
+ * Non-owning view of a rows x cols matrix whose element (row, col) lies at data[row * rowStride + col * colStride],
+ * e.g. a block of a bigger Matrix or DenseMatrix or a matrix inside a foreign buffer (the default strides describe
+ * column major storage, rowStride = cols and colStride = 1 row major storage). Views take part in matrix expressions
+ * like any Matrix (A + view, view * B, transpose(view)) without copying, a view of const T is read only.
+ *
+ * Like a reference the view does not own its elements: it must not outlive the memory it was created from, copies of
+ * a view refer to the same memory and assigning to a view overwrites the viewed elements.
+ **/
+template <typename T, int rows, int cols>
+class MatrixView
+    : public MatrixExpression<MatrixView<T, rows, cols>, Matrix<typename std::remove_const<T>::type, rows, cols>>
+{
+private:
+    T *m_data;
+    std::ptrdiff_t m_rowStride;
+    std::ptrdiff_t m_colStride;
+
+public:
+    using value_type = typename std::remove_const<T>::type;
+
+    constexpr explicit MatrixView(T *data, std::ptrdiff_t rowStride = 1, std::ptrdiff_t colStride = rows)
+        : m_data{data}, m_rowStride{rowStride}, m_colStride{colStride}
+    {
+    }
+
+    // read only view of the elements of a writable one
+    template <typename U, typename = typename std::enable_if<std::is_same<const U, T>::value>::type>
+    constexpr MatrixView(const MatrixView<U, rows, cols> &other)
+        : m_data{other.data()}, m_rowStride{other.rowStride()}, m_colStride{other.colStride()}
+    {
+    }
+
+    MatrixView(const MatrixView &other) = default;
+
+    // copies the elements of the other view (not the view itself)
+    constexpr MatrixView &operator=(const MatrixView &other) { return *this = Matrix<value_type, rows, cols>{other}; }
+
+    // overwrites the viewed elements with a matrix or the result of a matrix expression
+    template <typename E,
+              typename = typename std::enable_if<
+                  is_matrix_operand<E>::value &&
+                  std::is_same<typename matrix_result<E>::type, Matrix<value_type, rows, cols>>::value>::type>
+    constexpr MatrixView &operator=(const E &other)
+    {
+        static_assert(!std::is_const<T>::value, "Assigning to a read only view");
+
+        // evaluated first, the operand may read the viewed elements at other positions (e.g. another block of the
+        // same matrix)
+        const Matrix<value_type, rows, cols> values{other};
+        for (int col{0}; col < cols; ++col)
+        {
+            for (int row{0}; row < rows; ++row)
+            {
+                (*this)(row, col) = values(row, col);
+            }
+        }
+
+        return *this;
+    }
+
+    constexpr T &operator()(int row, int col) const { return m_data[row * m_rowStride + col * m_colStride]; }
+
+    constexpr T &at(int row, int col) const
+    {
+        assert("Accessing matrix with index out of its bounds" && row >= 0 && row < rows && col >= 0 && col < cols);
+
+        return (*this)(row, col);
+    }
+
+    // the element (0, 0)
+    constexpr T *data() const { return m_data; }
+
+    constexpr std::ptrdiff_t rowStride() const { return m_rowStride; }
+
+    constexpr std::ptrdiff_t colStride() const { return m_colStride; }
+
+    constexpr VectorView<T, cols> row(int index) const
+    {
+        assert("Accessing matrix with index out of its bounds" && index >= 0 && index < rows);
+
+        return VectorView<T, cols>{m_data + index * m_rowStride, m_colStride};
+    }
+
+    constexpr VectorView<T, rows> col(int index) const
+    {
+        assert("Accessing matrix with index out of its bounds" && index >= 0 && index < cols);
+
+        return VectorView<T, rows>{m_data + index * m_colStride, m_rowStride};
+    }
+
+    // the blockRows x blockCols block starting at (row, col)
+    template <int blockRows, int blockCols>
+    constexpr MatrixView<T, blockRows, blockCols> block(int row, int col) const
+    {
+        assert("Accessing matrix with index out of its bounds" && row >= 0 && col >= 0 && row + blockRows <= rows &&
+               col + blockCols <= cols);
+
+        return MatrixView<T, blockRows, blockCols>{&(*this)(row, col), m_rowStride, m_colStride};
+    }
+
+    template <typename E>
+    constexpr MatrixView &operator+=(const E &other)
+    {
+        return *this = *this + other;
+    }
+
+    template <typename E>
+    constexpr MatrixView &operator-=(const E &other)
+    {
+        return *this = *this - other;
+    }
+
+    template <typename V, typename = typename std::enable_if<std::is_arithmetic<V>::value>::type>
+    constexpr MatrixView &operator*=(V scalar)
+    {
+        return *this = *this * scalar;
+    }
+
+    template <typename V, typename = typename std::enable_if<std::is_arithmetic<V>::value>::type>
+    constexpr MatrixView &operator/=(V scalar)
+    {
+        return *this = *this / scalar;
+    }
+
+    // true if the viewed elements may overlap the rows * cols elements starting at data (the destination of an
+    // assignment with this view as an operand)
+    constexpr bool contains(const void *data) const
+    {
+        if (std::is_constant_evaluated())
+        {
+            return true;
+        }
+
+        const std::ptrdiff_t rowSpan{(rows - 1) * m_rowStride};
+        const std::ptrdiff_t colSpan{(cols - 1) * m_colStride};
+        const std::ptrdiff_t first{(rowSpan < 0 ? rowSpan : 0) + (colSpan < 0 ? colSpan : 0)};
+        const std::ptrdiff_t last{(rowSpan > 0 ? rowSpan : 0) + (colSpan > 0 ? colSpan : 0)};
+
+        const std::uintptr_t begin{reinterpret_cast<std::uintptr_t>(m_data + first)};
+        const std::uintptr_t end{reinterpret_cast<std::uintptr_t>(m_data + last + 1)};
+        const std::uintptr_t target{reinterpret_cast<std::uintptr_t>(data)};
+
+        return target < end && begin < target + rows * cols * sizeof(value_type);
+    }
+
+    // reading element (row, col) only conflicts with writing the destination if the view has another layout
+    constexpr bool aliases(const void *data) const
+    {
+        return contains(data) && !(data == m_data && m_rowStride == 1 && m_colStride == rows);
+    }
+};
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,310 @@
+#ifndef MATHLIB_CORE_MATRIX_TRANSFORM_H
+#define MATHLIB_CORE_MATRIX_TRANSFORM_H
+
+#include "../../util/simd.h"
+#include "../../util/threadPool.h"
+#include "../Vector/point.h"
+#include "../Vector/vector.h"
+#include "./matrix.h"
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace MathLib
+{
+// Transforms 3D points and vectors with a 4x4 matrix: points are treated as (x, y, z, 1), vectors as (x, y, z, 0).
+// The matrix columns are loaded once and kept in registers while the kernel streams through the data.
+template <typename T>
+class AffineTransformKernel
+{
+private:
+    T m_columns[4][4];
+
+public:
+    explicit AffineTransformKernel(const Matrix<T, 4, 4> &mat)
+    {
+        for (int col{0}; col < 4; ++col)
+        {
+            for (int row{0}; row < 4; ++row)
+            {
+                m_columns[col][row] = mat(row, col);
+            }
+        }
+    }
+
+    template <bool homogeneousDivide>
+    void transformPoint(const T *in, T *out) const
+    {
+        T res[4];
+        for (int row{0}; row < 4; ++row)
+        {
+            res[row] = m_columns[0][row] * in[0] + m_columns[1][row] * in[1] + m_columns[2][row] * in[2] +
+                       m_columns[3][row];
+        }
+
+        const T scale = homogeneousDivide ? T{1} / res[3] : T{1};
+        for (int i{0}; i < 3; ++i)
+        {
+            out[i] = res[i] * scale;
+        }
+    }
+
+    void transformVector(const T *in, T *out) const
+    {
+        T res[3];
+        for (int row{0}; row < 3; ++row)
+        {
+            res[row] = m_columns[0][row] * in[0] + m_columns[1][row] * in[1] + m_columns[2][row] * in[2];
+        }
+
+        for (int i{0}; i < 3; ++i)
+        {
+            out[i] = res[i];
+        }
+    }
+};
+
+#if defined(MATHLIB_SSE2)
+template <>
+class AffineTransformKernel<float>
+{
+private:
+    __m128 m_c0, m_c1, m_c2, m_c3;
+
+    static void store3(float *out, __m128 res)
+    {
+        _mm_storel_pi(reinterpret_cast<__m64 *>(out), res);
+        _mm_store_ss(out + 2, _mm_movehl_ps(res, res));
+    }
+
+    static __m128 madd(__m128 a, __m128 b, __m128 c)
+    {
+#if defined(MATHLIB_FMA)
+        return _mm_fmadd_ps(a, b, c);
+#else
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+    }
+
+public:
+    explicit AffineTransformKernel(const Matrix<float, 4, 4> &mat)
+        : m_c0{_mm_loadu_ps(mat.raw())}, m_c1{_mm_loadu_ps(mat.raw() + 4)}, m_c2{_mm_loadu_ps(mat.raw() + 8)},
+          m_c3{_mm_loadu_ps(mat.raw() + 12)}
+    {
+    }
+
+    template <bool homogeneousDivide>
+    void transformPoint(const float *in, float *out) const
+    {
+        __m128 res = madd(m_c0, _mm_set1_ps(in[0]), m_c3);
+        res = madd(m_c1, _mm_set1_ps(in[1]), res);
+        res = madd(m_c2, _mm_set1_ps(in[2]), res);
+
+        if (homogeneousDivide)
+        {
+            res = _mm_div_ps(res, _mm_shuffle_ps(res, res, _MM_SHUFFLE(3, 3, 3, 3)));
+        }
+
+        store3(out, res);
+    }
+
+    void transformVector(const float *in, float *out) const
+    {
+        __m128 res = _mm_mul_ps(m_c0, _mm_set1_ps(in[0]));
+        res = madd(m_c1, _mm_set1_ps(in[1]), res);
+        res = madd(m_c2, _mm_set1_ps(in[2]), res);
+
+        store3(out, res);
+    }
+};
+#endif
+
+#if defined(MATHLIB_AVX)
+template <>
+class AffineTransformKernel<double>
+{
+private:
+    __m256d m_c0, m_c1, m_c2, m_c3;
+
+    static void store3(double *out, __m256d res)
+    {
+        _mm_storeu_pd(out, _mm256_castpd256_pd128(res));
+        _mm_store_sd(out + 2, _mm256_extractf128_pd(res, 1));
+    }
+
+    static __m256d madd(__m256d a, __m256d b, __m256d c)
+    {
+#if defined(MATHLIB_FMA)
+        return _mm256_fmadd_pd(a, b, c);
+#else
+        return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#endif
+    }
+
+public:
+    explicit AffineTransformKernel(const Matrix<double, 4, 4> &mat)
+        : m_c0{_mm256_loadu_pd(mat.raw())}, m_c1{_mm256_loadu_pd(mat.raw() + 4)},
+          m_c2{_mm256_loadu_pd(mat.raw() + 8)}, m_c3{_mm256_loadu_pd(mat.raw() + 12)}
+    {
+    }
+
+    template <bool homogeneousDivide>
+    void transformPoint(const double *in, double *out) const
+    {
+        __m256d res = madd(m_c0, _mm256_broadcast_sd(in), m_c3);
+        res = madd(m_c1, _mm256_broadcast_sd(in + 1), res);
+        res = madd(m_c2, _mm256_broadcast_sd(in + 2), res);
+
+        if (homogeneousDivide)
+        {
+            const __m256d upper = _mm256_permute2f128_pd(res, res, 0x11);
+            const __m256d w = _mm256_permute_pd(upper, 0xF);
+            res = _mm256_div_pd(res, w);
+        }
+
+        store3(out, res);
+    }
+
+    void transformVector(const double *in, double *out) const
+    {
+        __m256d res = _mm256_mul_pd(m_c0, _mm256_broadcast_sd(in));
+        res = madd(m_c1, _mm256_broadcast_sd(in + 1), res);
+        res = madd(m_c2, _mm256_broadcast_sd(in + 2), res);
+
+        store3(out, res);
+    }
+};
+#endif
+
+namespace detail
+{
+// points per block when the batch is split across threads
+constexpr std::size_t transform_parallel_grain{8192};
+
+// true if out does not overlap in or is the same array with the same stride, every element is then only written after
+// it has been read (in place with different strides, writing element i would overwrite the input of element i + 1)
+template <typename T>
+bool validStridedAliasing(const T *in, std::size_t inStride, const T *out, std::size_t outStride, std::size_t count)
+{
+    if (count == 0)
+    {
+        return true;
+    }
+
+    const std::uintptr_t inBegin{reinterpret_cast<std::uintptr_t>(in)};
+    const std::uintptr_t inEnd{inBegin + (count - 1) * inStride + 3 * sizeof(T)};
+    const std::uintptr_t outBegin{reinterpret_cast<std::uintptr_t>(out)};
+    const std::uintptr_t outEnd{outBegin + (count - 1) * outStride + 3 * sizeof(T)};
+
+    return inEnd <= outBegin || outEnd <= inBegin || (in == out && inStride == outStride);
+}
+
+template <bool homogeneousDivide, typename T>
+void transformPointsStrided(const AffineTransformKernel<T> &kernel,
+                            const unsigned char *in,
+                            std::size_t inStride,
+                            unsigned char *out,
+                            std::size_t outStride,
+                            std::size_t count)
+{
+    for (std::size_t i{0}; i < count; ++i)
+    {
+        kernel.template transformPoint<homogeneousDivide>(reinterpret_cast<const T *>(in + i * inStride),
+                                                          reinterpret_cast<T *>(out + i * outStride));
+    }
+}
+} // namespace detail
+
+/**
+ * Transforms count points given as three consecutive values of type T each, the start of two consecutive points is
+ * inStride (outStride) bytes apart. This allows transforming e.g. the positions inside an interleaved vertex buffer.
+ * If homogeneousDivide is set the result is divided by its w component (perspective projection).
+ * in and out may point to the same memory only if inStride equals outStride, otherwise they must not overlap. Big
+ * batches are split into blocks which run on the thread pool.
+ **/
+template <typename T>
+void transformPoints(const Matrix<T, 4, 4> &mat,
+                     const T *in,
+                     std::size_t inStride,
+                     T *out,
+                     std::size_t outStride,
+                     std::size_t count,
+                     bool homogeneousDivide = false)
+{
+    assert("Transforming in place requires equal strides, otherwise in and out must not overlap" &&
+           detail::validStridedAliasing(in, inStride, out, outStride, count));
+
+    const AffineTransformKernel<T> kernel{mat};
+    const unsigned char *inBytes = reinterpret_cast<const unsigned char *>(in);
+    unsigned char *outBytes = reinterpret_cast<unsigned char *>(out);
+
+    Util::parallelFor(0, count, detail::transform_parallel_grain, [&](std::size_t begin, std::size_t end) {
+        const unsigned char *blockIn = inBytes + begin * inStride;
+        unsigned char *blockOut = outBytes + begin * outStride;
+
+        if (homogeneousDivide)
+        {
+            detail::transformPointsStrided<true>(kernel, blockIn, inStride, blockOut, outStride, end - begin);
+        }
+        else
+        {
+            detail::transformPointsStrided<false>(kernel, blockIn, inStride, blockOut, outStride, end - begin);
+        }
+    });
+}
+
+// transforms count vectors (w = 0) given as three consecutive values of type T each (see transformPoints)
+template <typename T>
+void transformVectors(const Matrix<T, 4, 4> &mat,
+                      const T *in,
+                      std::size_t inStride,
+                      T *out,
+                      std::size_t outStride,
+                      std::size_t count)
+{
+    assert("Transforming in place requires equal strides, otherwise in and out must not overlap" &&
+           detail::validStridedAliasing(in, inStride, out, outStride, count));
+
+    const AffineTransformKernel<T> kernel{mat};
+    const unsigned char *inBytes = reinterpret_cast<const unsigned char *>(in);
+    unsigned char *outBytes = reinterpret_cast<unsigned char *>(out);
+
+    Util::parallelFor(0, count, detail::transform_parallel_grain, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i{begin}; i < end; ++i)
+        {
+            kernel.transformVector(reinterpret_cast<const T *>(inBytes + i * inStride),
+                                   reinterpret_cast<T *>(outBytes + i * outStride));
+        }
+    });
+}
+
+// transforms an array of points, in and out may be the same array
+template <typename T>
+void transformPoints(const Matrix<T, 4, 4> &mat,
+                     const Point<T, 3> *in,
+                     Point<T, 3> *out,
+                     std::size_t count,
+                     bool homogeneousDivide = false)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    transformPoints(mat, in->data(), sizeof(Point<T, 3>), out->data(), sizeof(Point<T, 3>), count, homogeneousDivide);
+}
+
+// transforms an array of vectors, in and out may be the same array
+template <typename T>
+void transformVectors(const Matrix<T, 4, 4> &mat, const Vector<T, 3> *in, Vector<T, 3> *out, std::size_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    transformVectors(mat, in->data(), sizeof(Vector<T, 3>), out->data(), sizeof(Vector<T, 3>), count);
+}
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,452 @@
+#ifndef MATHLIB_CORE_QUATERNION_QUATERNION_TEMPLATE
+#define MATHLIB_CORE_QUATERNION_QUATERNION_TEMPLATE
+
+#include "../../util/type_traits.h"
+#include "../../util/util.h"
+#include "../Matrix/matrix.h"
+#include "../Vector/point.h"
+#include "../Vector/vector.h"
+#include "./quaternionKernels.h"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <math.h>
+#include <type_traits>
+
+namespace MathLib
+{
+/**
+ * A quaternion q = (qv, qw) = x i + y j + z k + w with the imaginary part qv = (x, y, z) and the real part qw
+ * Unit quaternions represent rotations: the rotation by rad around the unit axis a is (sin(rad / 2) a, cos(rad / 2))
+ **/
+template <typename T, typename = typename std::enable_if<std::is_floating_point<T>::value, T>::type>
+class Quaternion
+{
+private:
+    // stored as (x, y, z, w) inline like Vector<T, 4>, which allows loading all components into one SIMD register
+    alignas(Util::storage_alignment<T, 4>::value) T m_data[4];
+
+public:
+    // components are left uninitialized unless the quaternion is value initialized (Quaternion<T>{})
+    Quaternion() = default;
+
+    constexpr Quaternion(const Vector<T, 3> &imaginary, T real)
+        : m_data{imaginary(0), imaginary(1), imaginary(2), real}
+    {
+    }
+
+    template <typename X,
+              typename Y,
+              typename Z,
+              typename W,
+              typename = typename std::enable_if<are_arithmetic<X, Y, Z, W>{}>::type>
+    constexpr Quaternion(X x, Y y, Z z, W w) : m_data{T(x), T(y), T(z), T(w)}
+    {
+    }
+
+    // rotation that corresponds to the given rotation matrix (which has to be orthonormal)
+    explicit Quaternion(const Matrix<T, 3, 3> &rotation) { setRotation(rotation); }
+
+    // copy construction and assignment with conversion
+    template <typename U>
+    constexpr Quaternion(const Quaternion<U> &other) : m_data{T(other(0)), T(other(1)), T(other(2)), T(other(3))}
+    {
+    }
+
+    template <typename U>
+    constexpr Quaternion<T> &operator=(const Quaternion<U> &other)
+    {
+        for (int i{0}; i < 4; ++i)
+        {
+            m_data[i] = other(i);
+        }
+
+        return *this;
+    }
+
+    // access to the components in the order x, y, z, w
+    constexpr T operator()(int index) const { return m_data[index]; }
+
+    constexpr T &operator()(int index) { return m_data[index]; }
+
+    constexpr T at(int index) const
+    {
+        assert("Accessing quaternion with index out of its bounds" && index >= 0 && index < 4);
+
+        return m_data[index];
+    }
+
+    constexpr T &at(int index)
+    {
+        assert("Accessing quaternion with index out of its bounds" && index >= 0 && index < 4);
+
+        return m_data[index];
+    }
+
+    // imaginary part
+    constexpr Vector<T, 3> qv() const { return Vector<T, 3>{m_data[0], m_data[1], m_data[2]}; }
+
+    // real part
+    constexpr T qw() const { return m_data[3]; }
+
+    constexpr const T *data() const { return m_data; }
+
+    constexpr T *data() { return m_data; }
+
+    constexpr T norm_squared() const
+    {
+        return m_data[0] * m_data[0] + m_data[1] * m_data[1] + m_data[2] * m_data[2] + m_data[3] * m_data[3];
+    }
+
+    T norm() const { return sqrt(norm_squared()); }
+
+    constexpr Quaternion<T> &setIdentity()
+    {
+        m_data[0] = 0;
+        m_data[1] = 0;
+        m_data[2] = 0;
+        m_data[3] = 1;
+
+        return *this;
+    }
+
+    constexpr Quaternion<T> &conjugate()
+    {
+        m_data[0] = -m_data[0];
+        m_data[1] = -m_data[1];
+        m_data[2] = -m_data[2];
+
+        return *this;
+    }
+
+    constexpr Quaternion<T> getConjugate() const { return Quaternion<T>{*this}.conjugate(); }
+
+    // q^-1 = q* / |q|^2, for unit quaternions the inverse is the conjugate (which is cheaper to compute)
+    constexpr Quaternion<T> &invert()
+    {
+        const T normSquared{norm_squared()};
+        assert("Inverting a quaternion with norm zero" && normSquared != 0);
+
+        conjugate();
+        for (int i{0}; i < 4; ++i)
+        {
+            m_data[i] /= normSquared;
+        }
+
+        return *this;
+    }
+
+    constexpr Quaternion<T> getInverse() const { return Quaternion<T>{*this}.invert(); }
+
+    Quaternion<T> &setUnit()
+    {
+        const T n{norm()};
+        assert("Normalizing a quaternion with norm zero" && n != 0);
+
+        for (int i{0}; i < 4; ++i)
+        {
+            m_data[i] /= n;
+        }
+
+        return *this;
+    }
+
+    Quaternion<T> getUnit() const { return Quaternion<T>{*this}.setUnit(); }
+
+    // rotation by rad around the given axis (which has to be a unit vector)
+    Quaternion<T> &setRotation(const Vector<T, 3> &axis, T rad)
+    {
+        const T halfAngle{rad / 2};
+        const T s{sin(halfAngle)};
+
+        m_data[0] = s * axis(0);
+        m_data[1] = s * axis(1);
+        m_data[2] = s * axis(2);
+        m_data[3] = cos(halfAngle);
+
+        return *this;
+    }
+
+    /**
+     * rotation equal to getRotation(rotation), i.e. the product of the rotations around the x, y and z axis by the
+     * angles given in rotation (the rotation around z is applied first)
+     **/
+    Quaternion<T> &setRotation(const Vector<T, 3> &rotation)
+    {
+        const T sx{sin(rotation(0) / 2)}, cx{cos(rotation(0) / 2)};
+        const T sy{sin(rotation(1) / 2)}, cy{cos(rotation(1) / 2)};
+        const T sz{sin(rotation(2) / 2)}, cz{cos(rotation(2) / 2)};
+
+        m_data[0] = sx * cy * cz + cx * sy * sz;
+        m_data[1] = cx * sy * cz - sx * cy * sz;
+        m_data[2] = cx * cy * sz + sx * sy * cz;
+        m_data[3] = cx * cy * cz - sx * sy * sz;
+
+        return *this;
+    }
+
+    // rotation described by the given orthonormal rotation matrix
+    Quaternion<T> &setRotation(const Matrix<T, 3, 3> &rotation)
+    {
+        // computes the largest component from the diagonal first to avoid dividing by a small number
+        const T trace{rotation.trace()};
+
+        if (trace > 0)
+        {
+            const T s{sqrt(trace + 1) * 2};
+            m_data[0] = (rotation(2, 1) - rotation(1, 2)) / s;
+            m_data[1] = (rotation(0, 2) - rotation(2, 0)) / s;
+            m_data[2] = (rotation(1, 0) - rotation(0, 1)) / s;
+            m_data[3] = s / 4;
+        }
+        else if (rotation(0, 0) > rotation(1, 1) && rotation(0, 0) > rotation(2, 2))
+        {
+            const T s{sqrt(1 + rotation(0, 0) - rotation(1, 1) - rotation(2, 2)) * 2};
+            m_data[0] = s / 4;
+            m_data[1] = (rotation(0, 1) + rotation(1, 0)) / s;
+            m_data[2] = (rotation(0, 2) + rotation(2, 0)) / s;
+            m_data[3] = (rotation(2, 1) - rotation(1, 2)) / s;
+        }
+        else if (rotation(1, 1) > rotation(2, 2))
+        {
+            const T s{sqrt(1 + rotation(1, 1) - rotation(0, 0) - rotation(2, 2)) * 2};
+            m_data[0] = (rotation(0, 1) + rotation(1, 0)) / s;
+            m_data[1] = s / 4;
+            m_data[2] = (rotation(1, 2) + rotation(2, 1)) / s;
+            m_data[3] = (rotation(0, 2) - rotation(2, 0)) / s;
+        }
+        else
+        {
+            const T s{sqrt(1 + rotation(2, 2) - rotation(0, 0) - rotation(1, 1)) * 2};
+            m_data[0] = (rotation(0, 2) + rotation(2, 0)) / s;
+            m_data[1] = (rotation(1, 2) + rotation(2, 1)) / s;
+            m_data[2] = s / 4;
+            m_data[3] = (rotation(1, 0) - rotation(0, 1)) / s;
+        }
+
+        return *this;
+    }
+
+    // the rotation matrix of this (unit) quaternion
+    constexpr Matrix<T, 3, 3> getRotationMatrix() const
+    {
+        const T x{m_data[0]}, y{m_data[1]}, z{m_data[2]}, w{m_data[3]};
+
+        return Matrix<T, 3, 3>{1 - 2 * (y * y + z * z),
+                               2 * (x * y - z * w),
+                               2 * (x * z + y * w),
+                               2 * (x * y + z * w),
+                               1 - 2 * (x * x + z * z),
+                               2 * (y * z - x * w),
+                               2 * (x * z - y * w),
+                               2 * (y * z + x * w),
+                               1 - 2 * (x * x + y * y)};
+    }
+
+    /**
+     * rotates the vector by this (unit) quaternion, this is the same as (q * (v, 0) * q*).qv() but needs only two cross
+     * products: v' = v + w t + qv x t with t = 2 qv x v
+     **/
+    constexpr Vector<T, 3> rotate(const Vector<T, 3> &vector) const
+    {
+        const Vector<T, 3> imaginary{qv()};
+        const Vector<T, 3> t{T{2} * cross(imaginary, vector)};
+
+        return vector + m_data[3] * t + cross(imaginary, t);
+    }
+
+    // rotates the point around the origin
+    constexpr Point<T, 3> rotate(const Point<T, 3> &point) const
+    {
+        const Vector<T, 3> rotated{rotate(Vector<T, 3>{point(0), point(1), point(2)})};
+
+        return Point<T, 3>{rotated(0), rotated(1), rotated(2)};
+    }
+
+    constexpr Quaternion<T> &operator+=(const Quaternion<T> &other)
+    {
+        for (int i{0}; i < 4; ++i)
+        {
+            m_data[i] += other.m_data[i];
+        }
+
+        return *this;
+    }
+
+    constexpr Quaternion<T> &operator-=(const Quaternion<T> &other)
+    {
+        for (int i{0}; i < 4; ++i)
+        {
+            m_data[i] -= other.m_data[i];
+        }
+
+        return *this;
+    }
+
+    template <typename V, typename = typename std::enable_if<std::is_arithmetic<V>::value>::type>
+    constexpr Quaternion<T> &operator*=(V scalar)
+    {
+        for (int i{0}; i < 4; ++i)
+        {
+            m_data[i] *= scalar;
+        }
+
+        return *this;
+    }
+
+    // Hamilton product, this = this * other (the rotation other is applied first)
+    constexpr Quaternion<T> &operator*=(const Quaternion<T> &other)
+    {
+        if (std::is_constant_evaluated())
+        {
+            GenericQuaternionProductKernel<T>::multiply(m_data, other.m_data, m_data);
+        }
+        else
+        {
+            QuaternionProductKernel<T>::multiply(m_data, other.m_data, m_data);
+        }
+
+        return *this;
+    }
+};
+
+template <typename T>
+constexpr Quaternion<T> operator+(const Quaternion<T> &q1, const Quaternion<T> &q2)
+{
+    Quaternion<T> res{q1};
+
+    return res += q2;
+}
+
+template <typename T>
+constexpr Quaternion<T> operator-(const Quaternion<T> &q1, const Quaternion<T> &q2)
+{
+    Quaternion<T> res{q1};
+
+    return res -= q2;
+}
+
+template <typename T>
+constexpr Quaternion<T> operator-(const Quaternion<T> &q)
+{
+    return Quaternion<T>{-q(0), -q(1), -q(2), -q(3)};
+}
+
+template <typename T, typename V, typename = typename std::enable_if<std::is_arithmetic<V>::value>::type>
+constexpr Quaternion<T> operator*(const Quaternion<T> &q, V scalar)
+{
+    Quaternion<T> res{q};
+
+    return res *= scalar;
+}
+
+template <typename T, typename V, typename = typename std::enable_if<std::is_arithmetic<V>::value>::type>
+constexpr Quaternion<T> operator*(V scalar, const Quaternion<T> &q)
+{
+    return q * scalar;
+}
+
+// Hamilton product, the resulting rotation applies q2 first and q1 second
+template <typename T>
+constexpr Quaternion<T> operator*(const Quaternion<T> &q1, const Quaternion<T> &q2)
+{
+    Quaternion<T> res{q1};
+
+    return res *= q2;
+}
+
+// the four dimensional dot product, for unit quaternions it is the cosine of half the angle between the rotations
+template <typename T>
+constexpr T dot(const Quaternion<T> &q1, const Quaternion<T> &q2)
+{
+    return q1(0) * q2(0) + q1(1) * q2(1) + q1(2) * q2(2) + q1(3) * q2(3);
+}
+
+/**
+ * Normalized linear interpolation between two unit quaternions. Cheaper than slerp, the rotation follows the same path
+ * but not at constant angular velocity.
+ * Like slerp it takes the shorter path: q and -r represent the same rotation, so it interpolates towards -r if
+ * dot(q, r) < 0.
+ **/
+template <typename T, typename V, typename = typename std::enable_if<std::is_arithmetic<V>::value>::type>
+Quaternion<T> nlerp(const Quaternion<T> &q, const Quaternion<T> &r, V t)
+{
+    const T rWeight{dot(q, r) < 0 ? -static_cast<T>(t) : static_cast<T>(t)};
+
+    return (q * (1 - t) + r * rWeight).setUnit();
+}
+
+/**
+ * Spherical linear interpolation between two unit quaternions, the result moves at constant angular velocity along
+ * the shorter path (towards -r if dot(q, r) < 0, see nlerp).
+ **/
+template <typename T, typename V, typename = typename std::enable_if<std::is_arithmetic<V>::value>::type>
+Quaternion<T> slerp(const Quaternion<T> &q, const Quaternion<T> &r, V t)
+{
+    T cosTheta{dot(q, r)};
+    T rSign{1};
+    if (cosTheta < 0)
+    {
+        cosTheta = -cosTheta;
+        rSign = -1;
+    }
+
+    // sin(theta) gets too small to divide by for (nearly) equal rotations, the paths are indistinguishable then
+    if (cosTheta > T{0.9995})
+    {
+        return nlerp(q, r, t);
+    }
+
+    const T theta{std::acos(cosTheta)};
+    const T sinTheta{std::sin(theta)};
+
+    return q * (std::sin((1 - t) * theta) / sinTheta) + r * (rSign * std::sin(t * theta) / sinTheta);
+}
+
+template <typename T>
+constexpr bool operator==(const Quaternion<T> &q1, const Quaternion<T> &q2)
+{
+    for (int i{0}; i < 4; ++i)
+    {
+        if (q1(i) != q2(i))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename T>
+constexpr bool operator!=(const Quaternion<T> &q1, const Quaternion<T> &q2)
+{
+    return !(q1 == q2);
+}
+
+template <typename T>
+bool allClose(const Quaternion<T> &q1,
+              const Quaternion<T> &q2,
+              T maxDiff = std::numeric_limits<T>::epsilon(),
+              T maxRelDiff = std::numeric_limits<T>::epsilon())
+{
+    for (int i{0}; i < 4; ++i)
+    {
+        if (!Util::isClose(q1(i), q2(i), maxDiff, maxRelDiff))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename T>
+std::ostream &operator<<(std::ostream &out, const Quaternion<T> &q)
+{
+    out << "( " << q(0) << ", " << q(1) << ", " << q(2) << ", " << q(3) << " )";
+
+    return out;
+}
+} // namespace MathLib
+
+#endif
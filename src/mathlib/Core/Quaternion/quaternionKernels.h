@@ -0,0 +1,91 @@
+#ifndef MATHLIB_CORE_QUATERNION_QUATERNION_KERNELS_H
+#define MATHLIB_CORE_QUATERNION_QUATERNION_KERNELS_H
+
+#include "../../util/simd.h"
+
+namespace MathLib
+{
+// Kernels behind the Hamilton product. Quaternions are stored as (x, y, z, w), the generic version is plain scalar
+// code and the float and double versions use SSE/AVX if the instruction sets are enabled (see util/simd.h).
+
+// out = q1 * q2, out may alias q1 or q2
+template <typename T>
+struct GenericQuaternionProductKernel
+{
+    static constexpr void multiply(const T *q1, const T *q2, T *out)
+    {
+        const T x{q1[3] * q2[0] + q1[0] * q2[3] + q1[1] * q2[2] - q1[2] * q2[1]};
+        const T y{q1[3] * q2[1] - q1[0] * q2[2] + q1[1] * q2[3] + q1[2] * q2[0]};
+        const T z{q1[3] * q2[2] + q1[0] * q2[1] - q1[1] * q2[0] + q1[2] * q2[3]};
+        const T w{q1[3] * q2[3] - q1[0] * q2[0] - q1[1] * q2[1] - q1[2] * q2[2]};
+
+        out[0] = x;
+        out[1] = y;
+        out[2] = z;
+        out[3] = w;
+    }
+};
+
+template <typename T>
+struct QuaternionProductKernel : GenericQuaternionProductKernel<T>
+{
+};
+
+/**
+ * The product is written as a sum of the second operand with permuted and sign flipped components scaled by the
+ * components of the first one:
+ * q1 * q2 = w1 (x2, y2, z2, w2) + x1 (w2, -z2, y2, -x2) + y1 (z2, w2, -x2, -y2) + z1 (-y2, x2, w2, -z2)
+ **/
+#if defined(MATHLIB_SSE2)
+template <>
+struct QuaternionProductKernel<float>
+{
+    static void multiply(const float *q1, const float *q2, float *out)
+    {
+        const __m128 b = _mm_loadu_ps(q2);
+
+        // _mm_set_ps takes the lanes in reverse order
+        const __m128 signX = _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+        const __m128 signY = _mm_set_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+        const __m128 signZ = _mm_set_ps(-0.0f, 0.0f, 0.0f, -0.0f);
+
+        const __m128 bx = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3)), signX);
+        const __m128 by = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)), signY);
+        const __m128 bz = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)), signZ);
+
+        __m128 res = _mm_mul_ps(_mm_set1_ps(q1[3]), b);
+        res = _mm_add_ps(res, _mm_mul_ps(_mm_set1_ps(q1[0]), bx));
+        res = _mm_add_ps(res, _mm_mul_ps(_mm_set1_ps(q1[1]), by));
+        res = _mm_add_ps(res, _mm_mul_ps(_mm_set1_ps(q1[2]), bz));
+
+        _mm_storeu_ps(out, res);
+    }
+};
+#endif
+
+#if defined(MATHLIB_AVX)
+template <>
+struct QuaternionProductKernel<double>
+{
+    static void multiply(const double *q1, const double *q2, double *out)
+    {
+        const __m256d b = _mm256_loadu_pd(q2);
+        // (z2, w2, x2, y2)
+        const __m256d swapped = _mm256_permute2f128_pd(b, b, 0x01);
+
+        const __m256d bx = _mm256_xor_pd(_mm256_permute_pd(swapped, 0x5), _mm256_set_pd(-0.0, 0.0, -0.0, 0.0));
+        const __m256d by = _mm256_xor_pd(swapped, _mm256_set_pd(-0.0, -0.0, 0.0, 0.0));
+        const __m256d bz = _mm256_xor_pd(_mm256_permute_pd(b, 0x5), _mm256_set_pd(-0.0, 0.0, 0.0, -0.0));
+
+        __m256d res = _mm256_mul_pd(_mm256_broadcast_sd(q1 + 3), b);
+        res = _mm256_add_pd(res, _mm256_mul_pd(_mm256_broadcast_sd(q1), bx));
+        res = _mm256_add_pd(res, _mm256_mul_pd(_mm256_broadcast_sd(q1 + 1), by));
+        res = _mm256_add_pd(res, _mm256_mul_pd(_mm256_broadcast_sd(q1 + 2), bz));
+
+        _mm256_storeu_pd(out, res);
+    }
+};
+#endif
+} // namespace MathLib
+
+#endif
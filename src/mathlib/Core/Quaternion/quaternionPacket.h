@@ -0,0 +1,350 @@
+#ifndef MATHLIB_CORE_QUATERNION_QUATERNION_PACKET_TEMPLATE
+#define MATHLIB_CORE_QUATERNION_QUATERNION_PACKET_TEMPLATE
+
+#include "../../util/fastMath.h"
+#include "../../util/packet.h"
+#include "../../util/simd.h"
+#include "../Matrix/matrix.h"
+#include "./quaternion.h"
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+namespace MathLib
+{
+/**
+ * Non-owning structure of arrays view of quaternions: the i-th quaternion is (x[i], y[i], z[i], w[i]).
+ * Use QuaternionSoA<const T> for read only input.
+ **/
+template <typename T>
+struct QuaternionSoA
+{
+    T *x;
+    T *y;
+    T *z;
+    T *w;
+
+    // a view of const quaternions can be created from a mutable one
+    operator QuaternionSoA<const T>() const { return QuaternionSoA<const T>{x, y, z, w}; }
+};
+
+// read only view used by the batch functions, T is not deduced from it so that mutable views convert implicitly
+template <typename T>
+using ConstQuaternionSoA = QuaternionSoA<const std::type_identity_t<T>>;
+
+// width quaternions stored as structure of arrays, lane i of x, y, z and w together form the i-th quaternion
+template <typename T, int width>
+class QuaternionPacket
+{
+public:
+    using packet_type = Packet<T, width>;
+    using mask_type = typename packet_type::mask_type;
+
+    packet_type x;
+    packet_type y;
+    packet_type z;
+    packet_type w;
+
+    QuaternionPacket() = default;
+
+    QuaternionPacket(const packet_type &x, const packet_type &y, const packet_type &z, const packet_type &w)
+        : x{x}, y{y}, z{z}, w{w}
+    {
+    }
+
+    // the same quaternion in all lanes
+    explicit QuaternionPacket(const Quaternion<T> &q) : x{q(0)}, y{q(1)}, z{q(2)}, w{q(3)} {}
+
+    static constexpr int size() { return width; }
+
+    // loads the quaternions index to index + width - 1
+    static QuaternionPacket load(const QuaternionSoA<const T> &soa, std::size_t index)
+    {
+        return QuaternionPacket{packet_type::load(soa.x + index),
+                                packet_type::load(soa.y + index),
+                                packet_type::load(soa.z + index),
+                                packet_type::load(soa.w + index)};
+    }
+
+    void store(const QuaternionSoA<T> &soa, std::size_t index) const
+    {
+        x.store(soa.x + index);
+        y.store(soa.y + index);
+        z.store(soa.z + index);
+        w.store(soa.w + index);
+    }
+
+    Quaternion<T> get(int lane) const
+    {
+        assert("Accessing out of bounds lane" && lane >= 0 && lane < width);
+
+        return Quaternion<T>{x[lane], y[lane], z[lane], w[lane]};
+    }
+
+    void set(int lane, const Quaternion<T> &q)
+    {
+        assert("Accessing out of bounds lane" && lane >= 0 && lane < width);
+
+        x.set(lane, q(0));
+        y.set(lane, q(1));
+        z.set(lane, q(2));
+        w.set(lane, q(3));
+    }
+
+    packet_type norm_squared() const { return x * x + y * y + z * z + w * w; }
+
+    QuaternionPacket &setUnit()
+    {
+        const packet_type inverseNorm{packet_type{1} / sqrt(norm_squared())};
+        x = x * inverseNorm;
+        y = y * inverseNorm;
+        z = z * inverseNorm;
+        w = w * inverseNorm;
+
+        return *this;
+    }
+
+    friend QuaternionPacket operator+(const QuaternionPacket &q1, const QuaternionPacket &q2)
+    {
+        return QuaternionPacket{q1.x + q2.x, q1.y + q2.y, q1.z + q2.z, q1.w + q2.w};
+    }
+
+    friend QuaternionPacket operator-(const QuaternionPacket &q) { return QuaternionPacket{-q.x, -q.y, -q.z, -q.w}; }
+
+    friend QuaternionPacket operator*(const packet_type &s, const QuaternionPacket &q)
+    {
+        return QuaternionPacket{s * q.x, s * q.y, s * q.z, s * q.w};
+    }
+
+    // lane-wise Hamilton product
+    friend QuaternionPacket operator*(const QuaternionPacket &q1, const QuaternionPacket &q2)
+    {
+        return QuaternionPacket{q1.w * q2.x + q1.x * q2.w + q1.y * q2.z - q1.z * q2.y,
+                                q1.w * q2.y - q1.x * q2.z + q1.y * q2.w + q1.z * q2.x,
+                                q1.w * q2.z + q1.x * q2.y - q1.y * q2.x + q1.z * q2.w,
+                                q1.w * q2.w - q1.x * q2.x - q1.y * q2.y - q1.z * q2.z};
+    }
+
+    friend QuaternionPacket select(const mask_type &mask, const QuaternionPacket &q1, const QuaternionPacket &q2)
+    {
+        return QuaternionPacket{
+            select(mask, q1.x, q2.x), select(mask, q1.y, q2.y), select(mask, q1.z, q2.z), select(mask, q1.w, q2.w)};
+    }
+};
+
+template <typename T>
+using Quaternionx4 = QuaternionPacket<T, 4>;
+
+template <typename T>
+using Quaternionx8 = QuaternionPacket<T, 8>;
+
+template <typename T, int width>
+Packet<T, width> dot(const QuaternionPacket<T, width> &q1, const QuaternionPacket<T, width> &q2)
+{
+    return q1.x * q2.x + q1.y * q2.y + q1.z * q2.z + q1.w * q2.w;
+}
+
+/**
+ * Lane-wise interpolation between unit quaternions for blending animation poses. Like the single quaternion versions
+ * these always take the shorter path: lanes with dot(q, r) < 0 interpolate towards -r (the same rotation).
+ * The results are unit quaternions.
+ **/
+template <typename T, int width>
+QuaternionPacket<T, width>
+nlerp(const QuaternionPacket<T, width> &q, const QuaternionPacket<T, width> &r, const Packet<T, width> &t)
+{
+    const Packet<T, width> d{dot(q, r)};
+    const Packet<T, width> rWeight{select(d < Packet<T, width>{0}, -t, t)};
+
+    return ((Packet<T, width>{1} - t) * q + rWeight * r).setUnit();
+}
+
+/**
+ * Uses Fast::acos and Fast::sin, the error of the interpolated components stays below 1e-6 in float (compared to the
+ * exact slerp of the same quaternions). Lanes with nearly equal rotations fall back to nlerp like slerp() does.
+ **/
+template <typename T, int width>
+QuaternionPacket<T, width>
+slerp(const QuaternionPacket<T, width> &q, const QuaternionPacket<T, width> &r, const Packet<T, width> &t)
+{
+    using packet_type = Packet<T, width>;
+
+    const packet_type d{dot(q, r)};
+    const typename packet_type::mask_type flip{d < packet_type{0}};
+    const packet_type cosTheta{min(abs(d), packet_type{1})};
+
+    // theta is in [0, pi / 2] so that all angles passed to Fast::sin stay in its range
+    const packet_type theta{Fast::acos(cosTheta)};
+    const packet_type sinTheta{Fast::sin(theta)};
+    const typename packet_type::mask_type nearlyEqual{cosTheta > packet_type{T(0.9995)}};
+
+    // the division is discarded by select() for nearly equal lanes, guard it against sinTheta == 0 anyway
+    const packet_type inverseSin{packet_type{1} / select(nearlyEqual, packet_type{1}, sinTheta)};
+    const packet_type qWeight{
+        select(nearlyEqual, packet_type{1} - t, Fast::sin((packet_type{1} - t) * theta) * inverseSin)};
+    packet_type rWeight{select(nearlyEqual, t, Fast::sin(t * theta) * inverseSin)};
+    rWeight = select(flip, -rWeight, rWeight);
+
+    return (qWeight * q + rWeight * r).setUnit();
+}
+
+namespace detail
+{
+// number of lanes used by the batch functions
+template <typename T>
+struct quaternion_batch_width : std::integral_constant<int, 4>
+{
+};
+
+#if defined(MATHLIB_AVX)
+template <>
+struct quaternion_batch_width<float> : std::integral_constant<int, 8>
+{
+};
+#endif
+
+// applies kernel(index, lanes) to blocks of width quaternions, the last block may be partial
+template <int width, typename Kernel>
+void forEachQuaternionBlock(std::size_t count, Kernel kernel)
+{
+    for (std::size_t index{0}; index < count; index += width)
+    {
+        kernel(index, count - index < static_cast<std::size_t>(width) ? static_cast<int>(count - index) : width);
+    }
+}
+
+// loads lanes quaternions starting at index, unused lanes are filled with the identity
+template <typename T, int width>
+QuaternionPacket<T, width> loadQuaternions(const QuaternionSoA<const T> &soa, std::size_t index, int lanes)
+{
+    if (lanes == width)
+    {
+        return QuaternionPacket<T, width>::load(soa, index);
+    }
+
+    QuaternionPacket<T, width> res{Quaternion<T>{0, 0, 0, 1}};
+    for (int lane{0}; lane < lanes; ++lane)
+    {
+        const std::size_t i{index + lane};
+        res.set(lane, Quaternion<T>{soa.x[i], soa.y[i], soa.z[i], soa.w[i]});
+    }
+
+    return res;
+}
+
+template <typename T, int width>
+void storeQuaternions(const QuaternionPacket<T, width> &q, const QuaternionSoA<T> &soa, std::size_t index, int lanes)
+{
+    if (lanes == width)
+    {
+        q.store(soa, index);
+        return;
+    }
+
+    for (int lane{0}; lane < lanes; ++lane)
+    {
+        const Quaternion<T> quaternion{q.get(lane)};
+        soa.x[index + lane] = quaternion(0);
+        soa.y[index + lane] = quaternion(1);
+        soa.z[index + lane] = quaternion(2);
+        soa.w[index + lane] = quaternion(3);
+    }
+}
+
+template <typename T, bool spherical>
+void interpolateQuaternions(const QuaternionSoA<const T> &q,
+                            const QuaternionSoA<const T> &r,
+                            T t,
+                            const QuaternionSoA<T> &out,
+                            std::size_t count)
+{
+    constexpr int width{quaternion_batch_width<T>::value};
+    const Packet<T, width> weight{t};
+
+    forEachQuaternionBlock<width>(count, [&](std::size_t index, int lanes) {
+        const QuaternionPacket<T, width> qs{loadQuaternions<T, width>(q, index, lanes)};
+        const QuaternionPacket<T, width> rs{loadQuaternions<T, width>(r, index, lanes)};
+
+        storeQuaternions(spherical ? slerp(qs, rs, weight) : nlerp(qs, rs, weight), out, index, lanes);
+    });
+}
+} // namespace detail
+
+/**
+ * out[i] = nlerp(q[i], r[i], t) for count quaternions (taking the shorter path, see the QuaternionPacket version)
+ * out may be the same arrays as q or r
+ **/
+template <typename T>
+void nlerp(const ConstQuaternionSoA<T> &q,
+           const ConstQuaternionSoA<T> &r,
+           T t,
+           const QuaternionSoA<T> &out,
+           std::size_t count)
+{
+    detail::interpolateQuaternions<T, false>(q, r, t, out, count);
+}
+
+// out[i] = slerp(q[i], r[i], t) for count quaternions with the accuracy of the QuaternionPacket version
+template <typename T>
+void slerp(const ConstQuaternionSoA<T> &q,
+           const ConstQuaternionSoA<T> &r,
+           T t,
+           const QuaternionSoA<T> &out,
+           std::size_t count)
+{
+    detail::interpolateQuaternions<T, true>(q, r, t, out, count);
+}
+
+/**
+ * Writes the rotation matrices of count unit quaternions into out, the last row and column are those of the identity
+ * (so the matrices can be used as homogeneous transforms)
+ **/
+template <typename T>
+void toRotationMatrices(const ConstQuaternionSoA<T> &q, Matrix<T, 4, 4> *out, std::size_t count)
+{
+    constexpr int width{detail::quaternion_batch_width<T>::value};
+    using packet_type = Packet<T, width>;
+
+    detail::forEachQuaternionBlock<width>(count, [&](std::size_t index, int lanes) {
+        const QuaternionPacket<T, width> qs{detail::loadQuaternions<T, width>(q, index, lanes)};
+        const packet_type one{1};
+        const packet_type two{2};
+
+        // the upper 3x3 block in column major order
+        const packet_type elements[9]{one - two * (qs.y * qs.y + qs.z * qs.z),
+                                      two * (qs.x * qs.y + qs.z * qs.w),
+                                      two * (qs.x * qs.z - qs.y * qs.w),
+                                      two * (qs.x * qs.y - qs.z * qs.w),
+                                      one - two * (qs.x * qs.x + qs.z * qs.z),
+                                      two * (qs.y * qs.z + qs.x * qs.w),
+                                      two * (qs.x * qs.z + qs.y * qs.w),
+                                      two * (qs.y * qs.z - qs.x * qs.w),
+                                      one - two * (qs.x * qs.x + qs.y * qs.y)};
+
+        T lanesOfElements[9][width];
+        for (int i{0}; i < 9; ++i)
+        {
+            elements[i].store(lanesOfElements[i]);
+        }
+
+        for (int lane{0}; lane < lanes; ++lane)
+        {
+            T *raw{out[index + lane].raw()};
+            for (int col{0}; col < 3; ++col)
+            {
+                for (int row{0}; row < 3; ++row)
+                {
+                    raw[col * 4 + row] = lanesOfElements[col * 3 + row][lane];
+                }
+                raw[col * 4 + 3] = 0;
+            }
+            raw[12] = 0;
+            raw[13] = 0;
+            raw[14] = 0;
+            raw[15] = 1;
+        }
+    });
+}
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,228 @@
+#ifndef MATHLIB_CORE_VECTOR_ARRAY_VIEW_TEMPLATE
+#define MATHLIB_CORE_VECTOR_ARRAY_VIEW_TEMPLATE
+
+#include "./point.h"
+#include "./vector.h"
+#include "./vectorView.h"
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace MathLib
+{
+/**
+ * Non-owning array of count vectors or points (of type Result) inside an external buffer of T, e.g. the positions or
+ * normals of a vertex buffer loaded from disk. Nothing is copied: element i is a VectorPointView of the buffer whose
+ * component c lies at
+ *
+ *     data + offset + i * stride + c * componentStride    (all distances in bytes, like transformPoints)
+ *
+ * interleaved() describes buffers where the components of an element are consecutive (stride is the size of a
+ * vertex), planar() buffers with one array per component. An array of const T is read only.
+ **/
+template <typename T, int size, typename Result>
+class VectorPointArrayView
+{
+public:
+    using value_type = Result;
+    using reference = VectorPointView<T, size, Result>;
+    using byte_type = typename std::conditional<std::is_const<T>::value, const unsigned char, unsigned char>::type;
+
+    class iterator
+    {
+    private:
+        byte_type *m_element{nullptr};
+        std::ptrdiff_t m_stride{0};
+        std::ptrdiff_t m_componentStride{0};
+
+    public:
+        // the elements are proxies (views) like the ones of std::vector<bool>
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Result;
+        using difference_type = std::ptrdiff_t;
+        using reference = VectorPointView<T, size, Result>;
+        using pointer = void;
+
+        iterator() = default;
+
+        constexpr iterator(byte_type *element, std::ptrdiff_t stride, std::ptrdiff_t componentStride)
+            : m_element{element}, m_stride{stride}, m_componentStride{componentStride}
+        {
+        }
+
+        reference operator*() const { return reference{reinterpret_cast<T *>(m_element), m_componentStride}; }
+
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+        iterator &operator++()
+        {
+            m_element += m_stride;
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator old{*this};
+            ++*this;
+            return old;
+        }
+
+        iterator &operator--()
+        {
+            m_element -= m_stride;
+            return *this;
+        }
+
+        iterator operator--(int)
+        {
+            iterator old{*this};
+            --*this;
+            return old;
+        }
+
+        iterator &operator+=(difference_type n)
+        {
+            m_element += n * m_stride;
+            return *this;
+        }
+
+        iterator &operator-=(difference_type n)
+        {
+            m_element -= n * m_stride;
+            return *this;
+        }
+
+        friend iterator operator+(iterator it, difference_type n) { return it += n; }
+
+        friend iterator operator+(difference_type n, iterator it) { return it += n; }
+
+        friend iterator operator-(iterator it, difference_type n) { return it -= n; }
+
+        // equal iterators are 0 apart even without a stride (default constructed ones)
+        friend difference_type operator-(const iterator &it1, const iterator &it2)
+        {
+            return it1.m_element == it2.m_element ? 0 : (it1.m_element - it2.m_element) / it1.m_stride;
+        }
+
+        friend bool operator==(const iterator &it1, const iterator &it2) { return it1.m_element == it2.m_element; }
+
+        friend bool operator!=(const iterator &it1, const iterator &it2) { return it1.m_element != it2.m_element; }
+
+        friend bool operator<(const iterator &it1, const iterator &it2) { return it2 - it1 > 0; }
+
+        friend bool operator>(const iterator &it1, const iterator &it2) { return it2 < it1; }
+
+        friend bool operator<=(const iterator &it1, const iterator &it2) { return !(it2 < it1); }
+
+        friend bool operator>=(const iterator &it1, const iterator &it2) { return !(it1 < it2); }
+    };
+
+private:
+    byte_type *m_data{nullptr};
+    std::size_t m_count{0};
+    std::ptrdiff_t m_stride{0};
+    std::ptrdiff_t m_componentStride{0};
+
+public:
+    VectorPointArrayView() = default;
+
+    VectorPointArrayView(T *data, std::size_t count, std::ptrdiff_t stride, std::ptrdiff_t componentStride)
+        : m_data{reinterpret_cast<byte_type *>(data)}, m_count{count}, m_stride{stride},
+          m_componentStride{componentStride / static_cast<std::ptrdiff_t>(sizeof(T))}
+    {
+        assert("Components have to be whole elements of T apart" &&
+               componentStride % static_cast<std::ptrdiff_t>(sizeof(T)) == 0);
+        assert("Elements have to be aligned to T" && stride % static_cast<std::ptrdiff_t>(alignof(T)) == 0);
+        assert("Elements of a non-empty view need a nonzero stride" && (stride != 0 || count == 0));
+    }
+
+    // count elements starting offset bytes into data, each one stride bytes after the previous one
+    static VectorPointArrayView interleaved(T *data,
+                                            std::size_t count,
+                                            std::ptrdiff_t stride = sizeof(T) * size,
+                                            std::ptrdiff_t offset = 0)
+    {
+        return VectorPointArrayView{reinterpret_cast<T *>(reinterpret_cast<byte_type *>(data) + offset),
+                                    count,
+                                    stride,
+                                    sizeof(T)};
+    }
+
+    // one array of count values per component, the arrays start planeStride bytes apart (by default right after
+    // each other)
+    static VectorPointArrayView planar(T *data, std::size_t count, std::ptrdiff_t planeStride = 0)
+    {
+        return VectorPointArrayView{data,
+                                    count,
+                                    sizeof(T),
+                                    planeStride ? planeStride : static_cast<std::ptrdiff_t>(sizeof(T) * count)};
+    }
+
+    // read only view of the elements of a writable one
+    template <typename U, typename = typename std::enable_if<std::is_same<const U, T>::value>::type>
+    VectorPointArrayView(const VectorPointArrayView<U, size, Result> &other)
+        : VectorPointArrayView{other.data(), other.count(), other.stride(), other.componentStride()}
+    {
+    }
+
+    // the first component of the first element
+    T *data() const { return reinterpret_cast<T *>(m_data); }
+
+    std::size_t count() const { return m_count; }
+
+    bool empty() const { return m_count == 0; }
+
+    // distance of two elements in bytes
+    std::ptrdiff_t stride() const { return m_stride; }
+
+    // distance of two components of an element in bytes
+    std::ptrdiff_t componentStride() const { return m_componentStride * static_cast<std::ptrdiff_t>(sizeof(T)); }
+
+    reference operator[](std::size_t index) const
+    {
+        return reference{reinterpret_cast<T *>(m_data + static_cast<std::ptrdiff_t>(index) * m_stride),
+                         m_componentStride};
+    }
+
+    reference at(std::size_t index) const
+    {
+        assert("Accessing array with index out of its bounds" && index < m_count);
+
+        return (*this)[index];
+    }
+
+    iterator begin() const { return iterator{m_data, m_stride, m_componentStride}; }
+
+    iterator end() const
+    {
+        return iterator{m_data + static_cast<std::ptrdiff_t>(m_count) * m_stride, m_stride, m_componentStride};
+    }
+
+    // copies the elements into the contiguous array out (count elements)
+    void copyTo(Result *out) const
+    {
+        for (std::size_t i{0}; i < m_count; ++i)
+        {
+            out[i] = (*this)[i];
+        }
+    }
+
+    // overwrites the elements with the contiguous array in (count elements)
+    void copyFrom(const Result *in) const
+    {
+        for (std::size_t i{0}; i < m_count; ++i)
+        {
+            (*this)[i] = in[i];
+        }
+    }
+};
+
+template <typename T, int size>
+using VectorArrayView = VectorPointArrayView<T, size, Vector<typename std::remove_const<T>::type, size>>;
+
+template <typename T, int size>
+using PointArrayView = VectorPointArrayView<T, size, Point<typename std::remove_const<T>::type, size>>;
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,308 @@
+#ifndef MATHLIB_CORE_VECTOR_DENSE_VECTOR_TEMPLATE
+#define MATHLIB_CORE_VECTOR_DENSE_VECTOR_TEMPLATE
+
+#include "../../util/alignedBuffer.h"
+#include "../../util/util.h"
+#include "./vector.h"
+#include "./vectorView.h"
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+
+namespace MathLib
+{
+/**
+ * A vector whose size is only known at runtime (the counterpart of Vector for e.g. batch solvers and statistics).
+ * The elements live in a cache line aligned heap buffer which is owned exclusively: DenseVectors can be moved but
+ * copies have to be made explicitly with clone().
+ **/
+template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
+class DenseVector
+{
+private:
+    Util::AlignedBuffer<T> m_data;
+
+public:
+    DenseVector() = default;
+
+    explicit DenseVector(std::size_t size, T value = T{0}) : m_data{size} { fill(value); }
+
+    DenseVector(std::initializer_list<T> values) : m_data{values.size()}
+    {
+        std::size_t i{0};
+        for (T value : values)
+        {
+            m_data[i++] = value;
+        }
+    }
+
+    template <int size>
+    explicit DenseVector(const Vector<T, size> &other) : m_data{size}
+    {
+        setSegment(0, other);
+    }
+
+    DenseVector(DenseVector &&other) = default;
+    DenseVector &operator=(DenseVector &&other) = default;
+
+    DenseVector clone() const
+    {
+        DenseVector copy{};
+        copy.m_data = m_data.clone();
+
+        return copy;
+    }
+
+    std::size_t size() const { return m_data.size(); }
+
+    T *data() { return m_data.data(); }
+
+    const T *data() const { return m_data.data(); }
+
+    T *begin() { return data(); }
+
+    T *end() { return data() + size(); }
+
+    const T *begin() const { return data(); }
+
+    const T *end() const { return data() + size(); }
+
+    T operator()(std::size_t index) const { return m_data[index]; }
+
+    T &operator()(std::size_t index) { return m_data[index]; }
+
+    T at(std::size_t index) const
+    {
+        assert("Accessing vector with index out of its bounds" && index < size());
+
+        return m_data[index];
+    }
+
+    T &at(std::size_t index)
+    {
+        assert("Accessing vector with index out of its bounds" && index < size());
+
+        return m_data[index];
+    }
+
+    DenseVector &fill(T value)
+    {
+        for (std::size_t i{0}; i < size(); ++i)
+        {
+            m_data[i] = value;
+        }
+
+        return *this;
+    }
+
+    // view of the n elements starting at start, it converts to a fixed size vector
+    template <int n>
+    VectorView<T, n> segment(std::size_t start)
+    {
+        assert("Accessing vector with index out of its bounds" && start + n <= size());
+
+        return VectorView<T, n>{data() + start};
+    }
+
+    template <int n>
+    VectorView<const T, n> segment(std::size_t start) const
+    {
+        assert("Accessing vector with index out of its bounds" && start + n <= size());
+
+        return VectorView<const T, n>{data() + start};
+    }
+
+    // overwrites the elements starting at start with the elements of a fixed size vector
+    template <int n>
+    DenseVector &setSegment(std::size_t start, const Vector<T, n> &segment)
+    {
+        assert("Accessing vector with index out of its bounds" && start + n <= size());
+
+        for (int i{0}; i < n; ++i)
+        {
+            m_data[start + i] = segment(i);
+        }
+
+        return *this;
+    }
+
+    DenseVector &operator+=(const DenseVector &other)
+    {
+        assert("Adding vectors of different sizes" && size() == other.size());
+
+        for (std::size_t i{0}; i < size(); ++i)
+        {
+            m_data[i] += other.m_data[i];
+        }
+
+        return *this;
+    }
+
+    DenseVector &operator-=(const DenseVector &other)
+    {
+        assert("Subtracting vectors of different sizes" && size() == other.size());
+
+        for (std::size_t i{0}; i < size(); ++i)
+        {
+            m_data[i] -= other.m_data[i];
+        }
+
+        return *this;
+    }
+
+    DenseVector &operator*=(T scalar)
+    {
+        for (std::size_t i{0}; i < size(); ++i)
+        {
+            m_data[i] *= scalar;
+        }
+
+        return *this;
+    }
+
+    DenseVector &operator/=(T scalar)
+    {
+        assert("Division by zero" && scalar != 0);
+
+        for (std::size_t i{0}; i < size(); ++i)
+        {
+            m_data[i] /= scalar;
+        }
+
+        return *this;
+    }
+
+    T norm_squared() const { return dot(*this, *this); }
+
+    T norm() const { return std::sqrt(norm_squared()); }
+};
+
+template <typename T>
+T dot(const DenseVector<T> &v1, const DenseVector<T> &v2)
+{
+    assert("Dot product of vectors of different sizes" && v1.size() == v2.size());
+
+    T sum{0};
+    for (std::size_t i{0}; i < v1.size(); ++i)
+    {
+        sum += v1(i) * v2(i);
+    }
+
+    return sum;
+}
+
+template <typename T>
+DenseVector<T> operator+(const DenseVector<T> &v1, const DenseVector<T> &v2)
+{
+    DenseVector<T> res{v1.clone()};
+    res += v2;
+
+    return res;
+}
+
+template <typename T>
+DenseVector<T> operator-(const DenseVector<T> &v1, const DenseVector<T> &v2)
+{
+    DenseVector<T> res{v1.clone()};
+    res -= v2;
+
+    return res;
+}
+
+template <typename T>
+DenseVector<T> operator-(const DenseVector<T> &vector)
+{
+    DenseVector<T> res{vector.clone()};
+    res *= T{-1};
+
+    return res;
+}
+
+template <typename T, typename V, typename = typename std::enable_if<std::is_arithmetic<V>::value>::type>
+DenseVector<T> operator*(const DenseVector<T> &vector, V scalar)
+{
+    DenseVector<T> res{vector.clone()};
+    res *= static_cast<T>(scalar);
+
+    return res;
+}
+
+template <typename T, typename V, typename = typename std::enable_if<std::is_arithmetic<V>::value>::type>
+DenseVector<T> operator*(V scalar, const DenseVector<T> &vector)
+{
+    return vector * scalar;
+}
+
+template <typename T, typename V, typename = typename std::enable_if<std::is_arithmetic<V>::value>::type>
+DenseVector<T> operator/(const DenseVector<T> &vector, V scalar)
+{
+    DenseVector<T> res{vector.clone()};
+    res /= static_cast<T>(scalar);
+
+    return res;
+}
+
+template <typename T>
+bool operator==(const DenseVector<T> &v1, const DenseVector<T> &v2)
+{
+    if (v1.size() != v2.size())
+    {
+        return false;
+    }
+
+    for (std::size_t i{0}; i < v1.size(); ++i)
+    {
+        if (v1(i) != v2(i))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename T>
+bool operator!=(const DenseVector<T> &v1, const DenseVector<T> &v2)
+{
+    return !(v1 == v2);
+}
+
+template <typename T, typename = typename std::enable_if<std::is_floating_point<T>::value, T>::type>
+bool allClose(const DenseVector<T> &v1,
+              const DenseVector<T> &v2,
+              T maxDiff = std::numeric_limits<T>::epsilon(),
+              T maxRelDiff = std::numeric_limits<T>::epsilon())
+{
+    if (v1.size() != v2.size())
+    {
+        return false;
+    }
+
+    for (std::size_t i{0}; i < v1.size(); ++i)
+    {
+        if (!Util::isClose(v1(i), v2(i), maxDiff, maxRelDiff))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename T>
+std::ostream &operator<<(std::ostream &out, const DenseVector<T> &vector)
+{
+    for (std::size_t i{0}; i < vector.size(); ++i)
+    {
+        out << (i ? ", " : "") << vector(i);
+    }
+
+    return out;
+}
+} // namespace MathLib
+
+#endif
@@ -4,6 +4,7 @@
 #include "../../util/type_traits.h"
 #include "../../util/util.h"
 #include "./vector.h"
+#include "./vectorExpression.h"
 #include "./vectorPointBase.h"
 #include <cassert>
 #include <iostream>
@@ -20,58 +21,65 @@ public:
     // friend class Vector<T, size - 1>;
     // friend class Vector<T, size + 1>;
 
-    Point() : VectorPointBase<T, size>{} {}
+    constexpr Point() : VectorPointBase<T, size>{} {}
 
     // provide constructor that is only callable with correct number of parameters
     template <typename... Tail>
-    Point(typename std::enable_if<sizeof...(Tail) + 1 == size && are_arithmetic<Tail...>{}, T>::type head, Tail... tail)
+    constexpr Point(typename std::enable_if<sizeof...(Tail) + 1 == size && are_arithmetic<Tail...>{}, T>::type head,
+                    Tail... tail)
         : VectorPointBase<T, size>{head, T(tail)...}
     {
     }
 
-    Point(const Point &other) : VectorPointBase<T, size>{other} {}
-
-    Point<T, size> &operator=(const Point<T, size> &other)
-    {
-        if (this == &other)
-        {
-            return *this;
-        }
-
-        VectorPointBase<T, size>::operator=(other);
-
-        return *this;
-    }
+    // copies and moves are memberwise copies of the inline storage
+    Point(const Point &other) = default;
+    Point(Point &&other) = default;
+    Point &operator=(const Point &other) = default;
+    Point &operator=(Point &&other) = default;
 
     // copy construction and assignment with conversion
     template <typename U>
-    Point(const Point<U, size> &other) : VectorPointBase<T, size>{other}
+    constexpr Point(const Point<U, size> &other) : VectorPointBase<T, size>{other}
     {
     }
 
     template <typename U>
-    Point<T, size> &operator=(const Point<U, size> &other)
+    constexpr Point<T, size> &operator=(const Point<U, size> &other)
     {
         VectorPointBase<T, size>::operator=(other);
 
         return *this;
     }
 
-    // move construction
-    Point(Point &&other) : VectorPointBase<T, size>{std::move(other)} {}
+    // evaluates a lazy point expression (e.g. p + 2 * v) in a single pass over the elements
+    template <typename E,
+              typename = typename std::enable_if<
+                  is_vp_expression<E>::value &&
+                  std::is_same<typename E::result_type, Point<typename E::value_type, size>>::value>::type>
+    constexpr Point(const E &expression)
+    {
+        *this = expression;
+    }
 
-    Point &operator=(Point &&other)
+    template <typename E,
+              typename = typename std::enable_if<
+                  is_vp_expression<E>::value &&
+                  std::is_same<typename E::result_type, Point<typename E::value_type, size>>::value>::type>
+    constexpr Point<T, size> &operator=(const E &expression)
     {
-        VectorPointBase<T, size>::operator=(std::move(other));
+        for (int i = 0; i < size; ++i)
+        {
+            this->m_data[i] = expression(i);
+        }
 
         return *this;
     }
 
-    Point(const Point<T, size - 1> &other, T val) : VectorPointBase<T, size>{other, val} {}
+    constexpr Point(const Point<T, size - 1> &other, T val) : VectorPointBase<T, size>{other, val} {}
 
-    Point(const Point<T, size + 1> &other) : VectorPointBase<T, size>{other} {}
+    constexpr Point(const Point<T, size + 1> &other) : VectorPointBase<T, size>{other} {}
 
-    Point<T, size> &operator+=(const Vector<T, size> &vector)
+    constexpr Point<T, size> &operator+=(const Vector<T, size> &vector)
     {
         for (int i = 0; i < size; ++i)
         {
@@ -81,7 +89,7 @@ public:
         return *this;
     }
 
-    Point<T, size> &operator-=(const Vector<T, size> &vector)
+    constexpr Point<T, size> &operator-=(const Vector<T, size> &vector)
     {
         for (int i = 0; i < size; ++i)
         {
@@ -114,42 +122,34 @@ public:
 
         return p;
     }
-};
 
-template <typename T, int size>
-Point<T, size> operator+(const Vector<T, size> &v, const Point<T, size> &p)
-{
-    return p + v;
-}
-
-template <typename T, int size>
-Point<T, size> operator+(const Point<T, size> &p, const Vector<T, size> &v)
-{
-    Point<T, size> sum{p};
+    // the same with the random numbers drawn from the given engine (e.g. a seeded Util::Pcg32)
+    template <typename Engine, typename = typename std::enable_if<!std::is_arithmetic<Engine>::value>::type>
+    static Point<T, size> random(Engine &engine)
+    {
+        Point<T, size> p{};
 
-    return sum += v;
-}
+        for (int i{0}; i < size; ++i)
+        {
+            p.m_data[i] = Util::random_number<T>(engine);
+        }
 
-template <typename T, int size>
-Point<T, size> operator-(const Point<T, size> &p, const Vector<T, size> &v)
-{
-    Point<T, size> diff{p};
+        return p;
+    }
 
-    return diff -= v;
-}
+    template <typename Engine>
+    static Point<T, size> random(T min, T max, Engine &engine)
+    {
+        Point<T, size> p{};
 
-template <typename T, int size>
-Vector<T, size> operator-(const Point<T, size> &p1, const Point<T, size> &p2)
-{
-    Vector<T, size> diff{};
+        for (int i{0}; i < size; ++i)
+        {
+            p.m_data[i] = Util::random_number<T>(min, max, engine);
+        }
 
-    for (int i{0}; i < size; ++i)
-    {
-        diff(i) = p1(i) - p2(i);
+        return p;
     }
-
-    return diff;
-}
+};
 
 template <typename T, int size>
 std::ostream &operator<<(std::ostream &out, const Point<T, size> &point)
@@ -1,9 +1,12 @@
 #ifndef MATHLIB_CORE_VECTOR_VECTOR_TEMPLATE
 #define MATHLIB_CORE_VECTOR_VECTOR_TEMPLATE
 
+#include "../../util/fastMath.h"
 #include "../../util/type_traits.h"
 #include "../../util/util.h"
+#include "./vectorExpression.h"
 #include "./vectorPointBase.h"
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <math.h>
@@ -20,13 +23,51 @@ public:
 
     // provide constructor that is only callable with correct number of parameters
     template <typename... Tail>
-    Vector(T head, Tail... tail) : VectorPointBase<T, size>{head, T(tail)...}
+    constexpr Vector(T head, Tail... tail) : VectorPointBase<T, size>{head, T(tail)...}
     {
     }
 
-    Vector(const Vector<T, size - 1> &other, T val) : VectorPointBase<T, size>{other, val} {}
+    // copy construction and assignment with conversion
+    template <typename U>
+    constexpr Vector(const Vector<U, size> &other) : VectorPointBase<T, size>{other}
+    {
+    }
+
+    template <typename U>
+    constexpr Vector<T, size> &operator=(const Vector<U, size> &other)
+    {
+        VectorPointBase<T, size>::operator=(other);
 
-    Vector(const Vector<T, size + 1> &other) : VectorPointBase<T, size>{other} {}
+        return *this;
+    }
+
+    // evaluates a lazy vector expression (e.g. a + 2 * b) in a single pass over the elements
+    template <typename E,
+              typename = typename std::enable_if<
+                  is_vp_expression<E>::value &&
+                  std::is_same<typename E::result_type, Vector<typename E::value_type, size>>::value>::type>
+    constexpr Vector(const E &expression)
+    {
+        *this = expression;
+    }
+
+    template <typename E,
+              typename = typename std::enable_if<
+                  is_vp_expression<E>::value &&
+                  std::is_same<typename E::result_type, Vector<typename E::value_type, size>>::value>::type>
+    constexpr Vector<T, size> &operator=(const E &expression)
+    {
+        for (int i = 0; i < size; ++i)
+        {
+            this->m_data[i] = expression(i);
+        }
+
+        return *this;
+    }
+
+    constexpr Vector(const Vector<T, size - 1> &other, T val) : VectorPointBase<T, size>{other, val} {}
+
+    constexpr Vector(const Vector<T, size + 1> &other) : VectorPointBase<T, size>{other} {}
 
     template <typename U = T>
     U norm() const
@@ -40,10 +81,46 @@ public:
         return dot(*this, *this);
     }
 
-    // returns the angle between this and the other vector
+    constexpr Vector<T, size> &negate()
+    {
+        for (int i = 0; i < size; ++i)
+        {
+            this->m_data[i] = -this->m_data[i];
+        }
+
+        return *this;
+    }
+
+    // uses Fast::rsqrt for float if MATHLIB_FAST_MATH is defined
+    Vector<T, size> &normalize()
+    {
+        if constexpr (Fast::enabled<T>)
+        {
+            *this *= Fast::rsqrt(norm_squared());
+        }
+        else
+        {
+            *this /= norm();
+        }
+
+        return *this;
+    }
+
+    // returns the angle between this and the other vector, uses Fast::rsqrt and Fast::acos for float if
+    // MATHLIB_FAST_MATH is defined
     double angleTo(const Vector<T, size> &other) const
     {
-        return acos(dot(*this, other) / (this->norm() * other.norm()));
+        if constexpr (Fast::enabled<T>)
+        {
+            // the approximation errors can push the cosine slightly out of [-1, 1]
+            const T cosine{dot(*this, other) * Fast::rsqrt(norm_squared() * other.norm_squared())};
+
+            return Fast::acos(std::clamp(cosine, T{-1}, T{1}));
+        }
+        else
+        {
+            return acos(dot(*this, other) / (this->norm() * other.norm()));
+        }
     }
 
     static Vector<T, size> random()
@@ -69,10 +146,37 @@ public:
 
         return v;
     }
+
+    // the same with the random numbers drawn from the given engine (e.g. a seeded Util::Pcg32)
+    template <typename Engine, typename = typename std::enable_if<!std::is_arithmetic<Engine>::value>::type>
+    static Vector<T, size> random(Engine &engine)
+    {
+        Vector<T, size> v{};
+
+        for (int i{0}; i < size; ++i)
+        {
+            v.m_data[i] = Util::random_number<T>(engine);
+        }
+
+        return v;
+    }
+
+    template <typename Engine>
+    static Vector<T, size> random(T min, T max, Engine &engine)
+    {
+        Vector<T, size> v{};
+
+        for (int i{0}; i < size; ++i)
+        {
+            v.m_data[i] = Util::random_number<T>(min, max, engine);
+        }
+
+        return v;
+    }
 };
 
 template <typename T, int size>
-Vector<T, size> &operator+=(Vector<T, size> &vector, const Vector<T, size> &other)
+constexpr Vector<T, size> &operator+=(Vector<T, size> &vector, const Vector<T, size> &other)
 {
     for (int i = 0; i < vector.size(); ++i)
     {
@@ -83,7 +187,7 @@ Vector<T, size> &operator+=(Vector<T, size> &vector, const Vector<T, size> &othe
 }
 
 template <typename T, int size>
-Vector<T, size> &operator-=(Vector<T, size> &vector, const Vector<T, size> &other)
+constexpr Vector<T, size> &operator-=(Vector<T, size> &vector, const Vector<T, size> &other)
 {
     for (int i = 0; i < vector.size(); ++i)
     {
@@ -93,37 +197,38 @@ Vector<T, size> &operator-=(Vector<T, size> &vector, const Vector<T, size> &othe
     return vector;
 }
 
-template <typename T, int size>
-Vector<T, size> operator+(const Vector<T, size> &v1, const Vector<T, size> &v2)
+template <typename T, int size, typename U = T>
+constexpr U dot(const Vector<T, size> &v1, const Vector<T, size> &v2)
 {
-    Vector<T, size> sum{v1};
-
-    return sum += v2;
-}
+    U sum{0};
 
-template <typename T, int size>
-Vector<T, size> operator-(const Vector<T, size> &v1, const Vector<T, size> &v2)
-{
-    Vector<T, size> diff{v1};
+    for (int i = 0; i < size; ++i)
+    {
+        sum += v1.at(i) * v2.at(i);
+    }
 
-    return diff -= v2;
+    return sum;
 }
 
-template <typename T, int size, typename U = T>
-U dot(const Vector<T, size> &v1, const Vector<T, size> &v2)
+// dot product where at least one operand is a lazy expression, computed without evaluating the operands
+template <typename L, typename R>
+constexpr typename std::enable_if<(is_vp_expression<L>::value || is_vp_expression<R>::value) &&
+                                      std::is_same<typename vp_result<L>::type, typename vp_result<R>::type>::value,
+                                  vp_value_type<L>>::type
+dot(const L &v1, const R &v2)
 {
-    U sum{0};
+    vp_value_type<L> sum{0};
 
-    for (int i = 0; i < size; ++i)
+    for (int i = 0; i < vp_traits<typename vp_result<L>::type>::size; ++i)
     {
-        sum += v1.at(i) * v2.at(i);
+        sum += v1(i) * v2(i);
     }
 
     return sum;
 }
 
 template <typename T>
-Vector<T, 3> cross(const Vector<T, 3> &v1, const Vector<T, 3> &v2)
+constexpr Vector<T, 3> cross(const Vector<T, 3> &v1, const Vector<T, 3> &v2)
 {
     Vector<T, 3> newVec;
 
@@ -134,11 +239,19 @@ Vector<T, 3> cross(const Vector<T, 3> &v1, const Vector<T, 3> &v2)
     return newVec;
 }
 
+template <typename L, typename R>
+constexpr typename std::enable_if<(is_vp_expression<L>::value || is_vp_expression<R>::value) &&
+                                      std::is_same<typename vp_result<L>::type, typename vp_result<R>::type>::value,
+                                  typename vp_result<L>::type>::type
+cross(const L &v1, const R &v2)
+{
+    return cross(typename vp_result<L>::type{v1}, typename vp_result<R>::type{v2});
+}
+
 template <typename T, int size>
 Vector<T, size> &normalize(Vector<T, size> &vector)
 {
-    vector /= vector.norm();
-    return vector;
+    return vector.normalize();
 }
 
 template <typename T, int size>
@@ -151,6 +264,16 @@ Vector<T, size> normalize(const Vector<T, size> &vector)
     return newVector;
 }
 
+template <typename E>
+typename std::enable_if<is_vp_expression<E>::value, typename E::result_type>::type normalize(const E &expression)
+{
+    typename E::result_type newVector{expression};
+
+    normalize(newVector);
+
+    return newVector;
+}
+
 template <typename T, int size>
 Vector<T, size> reflect(const Vector<T, size> &vector, const Vector<T, size> &normal)
 {
@@ -167,7 +290,7 @@ Vector<T, size> refract(const Vector<T, size> &vector, const Vector<T, size> &no
 }
 
 template <typename T, int size>
-bool operator==(const Vector<T, size> &v1, const Vector<T, size> &v2)
+constexpr bool operator==(const Vector<T, size> &v1, const Vector<T, size> &v2)
 {
     for (int i = 0; i < size; ++i)
     {
@@ -198,7 +321,7 @@ bool allClose(const Vector<T, size> &v1,
 }
 
 template <typename T, int size>
-bool operator!=(const Vector<T, size> &v1, const Vector<T, size> &v2)
+constexpr bool operator!=(const Vector<T, size> &v1, const Vector<T, size> &v2)
 {
     return !(v1 == v2);
 }
@@ -0,0 +1,93 @@
+#ifndef MATHLIB_CORE_VECTOR_VECTOR_ARRAY_TEMPLATE
+#define MATHLIB_CORE_VECTOR_VECTOR_ARRAY_TEMPLATE
+
+#include "../../util/threadPool.h"
+#include "./point.h"
+#include "./vector.h"
+#include "./vectorExpression.h"
+#include <cstddef>
+
+namespace MathLib
+{
+// Element-wise operations over arrays of vectors and points (e.g. the positions and normals of a mesh). Big arrays
+// are split into blocks of consecutive elements which run on the thread pool (see util/threadPool.h). The output may
+// always be one of the input arrays.
+
+namespace detail
+{
+// elements per block, enough work to make up for handing the block to another thread
+constexpr std::size_t array_parallel_grain{16384};
+} // namespace detail
+
+// out[i] = op(in[i]) for count elements, op has to return a value (not an expression referencing its temporaries)
+template <typename In, typename Out, typename Op>
+void transformArray(const In *in, Out *out, std::size_t count, const Op &op)
+{
+    Util::parallelFor(0, count, detail::array_parallel_grain, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i{begin}; i < end; ++i)
+        {
+            out[i] = op(in[i]);
+        }
+    });
+}
+
+// out[i] = op(a[i], b[i]) for count elements
+template <typename A, typename B, typename Out, typename Op>
+void transformArrays(const A *a, const B *b, Out *out, std::size_t count, const Op &op)
+{
+    Util::parallelFor(0, count, detail::array_parallel_grain, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i{begin}; i < end; ++i)
+        {
+            out[i] = op(a[i], b[i]);
+        }
+    });
+}
+
+// out[i] = a[i] + b[i], vector + vector or point + vector
+template <typename L, typename R>
+void addArrays(const L *a, const R *b, typename vp_sum_result<L, R>::type *out, std::size_t count)
+{
+    transformArrays(a, b, out, count, [](const L &lhs, const R &rhs) {
+        return typename vp_sum_result<L, R>::type{lhs + rhs};
+    });
+}
+
+// out[i] = a[i] - b[i], vector - vector, point - vector or point - point
+template <typename L, typename R>
+void subtractArrays(const L *a, const R *b, typename vp_difference_result<L, R>::type *out, std::size_t count)
+{
+    transformArrays(a, b, out, count, [](const L &lhs, const R &rhs) {
+        return typename vp_difference_result<L, R>::type{lhs - rhs};
+    });
+}
+
+template <typename T, int size>
+void scaleArray(const Vector<T, size> *in, T scalar, Vector<T, size> *out, std::size_t count)
+{
+    transformArray(in, out, count, [scalar](const Vector<T, size> &vector) {
+        return Vector<T, size>{vector * scalar};
+    });
+}
+
+template <typename T, int size>
+void normalizeArray(const Vector<T, size> *in, Vector<T, size> *out, std::size_t count)
+{
+    transformArray(in, out, count, [](const Vector<T, size> &vector) { return normalize(vector); });
+}
+
+// out[i] = dot(a[i], b[i])
+template <typename T, int size>
+void dotArrays(const Vector<T, size> *a, const Vector<T, size> *b, T *out, std::size_t count)
+{
+    transformArrays(a, b, out, count, [](const Vector<T, size> &v1, const Vector<T, size> &v2) { return dot(v1, v2); });
+}
+
+// out[i] = cross(a[i], b[i])
+template <typename T>
+void crossArrays(const Vector<T, 3> *a, const Vector<T, 3> *b, Vector<T, 3> *out, std::size_t count)
+{
+    transformArrays(a, b, out, count, [](const Vector<T, 3> &v1, const Vector<T, 3> &v2) { return cross(v1, v2); });
+}
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,491 @@
+#ifndef MATHLIB_CORE_VECTOR_VECTOR_EXPRESSION_TEMPLATE
+#define MATHLIB_CORE_VECTOR_VECTOR_EXPRESSION_TEMPLATE
+
+#include "../../util/type_traits.h"
+#include "../../util/util.h"
+#include "./vectorPointBase.h"
+#include <cassert>
+#include <iostream>
+#include <limits>
+#include <math.h>
+#include <type_traits>
+
+/**
+ * Lazily evaluated element-wise expressions over vectors and points.
+ *
+ * The arithmetic operators on Vector and Point do not compute their result right away but return a light-weight
+ * expression object that only stores its operands. The elements are computed when the expression is assigned to a
+ * Vector or Point (or evaluated with eval()), so a chain like a + 2 * dot(v, n) * n - b runs as a single loop over
+ * the elements without any intermediate vectors.
+ *
+ * Vector and Point operands are stored by reference and nested expressions by value, so an expression must not
+ * outlive the vectors it was built from (e.g. avoid "auto sum = a + b;" with temporary operands).
+ **/
+
+namespace MathLib
+{
+template <typename T, int size, typename>
+class Vector;
+
+template <typename T, int size, typename>
+class Point;
+
+// base class of all vector and point expressions, Result is the Vector or Point type the expression evaluates to
+template <typename Derived, typename Result>
+class VectorPointExpression;
+
+std::false_type is_vp_expression_impl(...);
+template <typename Derived, typename Result>
+std::true_type is_vp_expression_impl(VectorPointExpression<Derived, Result> const volatile &);
+
+template <typename T>
+using is_vp_expression = decltype(is_vp_expression_impl(std::declval<T &>()));
+
+// true for vectors, points and expressions over them
+template <typename T>
+using is_vp_operand = std::integral_constant<bool, is_point_or_vector<T>::value || is_vp_expression<T>::value>;
+
+// element type and number of elements of a concrete Vector or Point type
+template <typename U>
+struct vp_traits
+{
+};
+
+template <template <typename, int, typename> class VP, typename T, int numElements, typename E>
+struct vp_traits<VP<T, numElements, E>>
+{
+    using value_type = T;
+    static constexpr int size = numElements;
+};
+
+// the concrete Vector or Point type an operand evaluates to
+template <typename U, typename = void>
+struct vp_result
+{
+};
+
+template <typename U>
+struct vp_result<U, typename std::enable_if<is_point_or_vector<U>::value>::type>
+{
+    using type = U;
+};
+
+template <typename U>
+struct vp_result<U, typename std::enable_if<is_vp_expression<U>::value>::type>
+{
+    using type = typename U::result_type;
+};
+
+template <typename U>
+using vp_value_type = typename vp_traits<typename vp_result<U>::type>::value_type;
+
+// vectors and points are held by reference inside an expression, nested expressions by value
+template <typename U>
+using vp_operand_storage = typename std::conditional<is_vp_expression<U>::value, const U, const U &>::type;
+
+// result of adding two operands: vector + vector = vector, point + vector = vector + point = point
+template <typename L, typename R>
+struct vp_sum_result
+{
+};
+
+template <typename T, int size, typename E>
+struct vp_sum_result<Vector<T, size, E>, Vector<T, size, E>>
+{
+    using type = Vector<T, size, E>;
+};
+
+template <typename T, int size, typename E>
+struct vp_sum_result<Point<T, size, E>, Vector<T, size, E>>
+{
+    using type = Point<T, size, E>;
+};
+
+template <typename T, int size, typename E>
+struct vp_sum_result<Vector<T, size, E>, Point<T, size, E>>
+{
+    using type = Point<T, size, E>;
+};
+
+// result of subtracting two operands: vector - vector = point - point = vector, point - vector = point
+template <typename L, typename R>
+struct vp_difference_result
+{
+};
+
+template <typename T, int size, typename E>
+struct vp_difference_result<Vector<T, size, E>, Vector<T, size, E>>
+{
+    using type = Vector<T, size, E>;
+};
+
+template <typename T, int size, typename E>
+struct vp_difference_result<Point<T, size, E>, Vector<T, size, E>>
+{
+    using type = Point<T, size, E>;
+};
+
+template <typename T, int size, typename E>
+struct vp_difference_result<Point<T, size, E>, Point<T, size, E>>
+{
+    using type = Vector<T, size, E>;
+};
+
+// the element-wise product is only defined for operands of the same type
+template <typename L, typename R>
+struct vp_product_result
+{
+};
+
+template <typename U>
+struct vp_product_result<U, U>
+{
+    using type = U;
+};
+
+template <typename Derived, typename Result>
+class VectorPointExpression
+{
+public:
+    using result_type = Result;
+    using value_type = typename vp_traits<Result>::value_type;
+
+    constexpr const Derived &derived() const { return static_cast<const Derived &>(*this); }
+
+    constexpr int size() const { return vp_traits<Result>::size; }
+
+    constexpr value_type at(int index) const
+    {
+        assert("Accessing out of bounds index" && index >= 0 && index < vp_traits<Result>::size);
+
+        return derived()(index);
+    }
+
+    // computes all elements of the expression
+    constexpr Result eval() const { return Result{derived()}; }
+
+    template <typename U = value_type>
+    U norm() const
+    {
+        return sqrt(norm_squared<U>());
+    }
+
+    template <typename U = value_type>
+    U norm_squared() const
+    {
+        U sum{0};
+
+        for (int i = 0; i < vp_traits<Result>::size; ++i)
+        {
+            const value_type element{derived()(i)};
+            sum += element * element;
+        }
+
+        return sum;
+    }
+};
+
+namespace detail
+{
+struct vp_add_op
+{
+    template <typename A, typename B>
+    static constexpr auto apply(A a, B b) -> decltype(a + b)
+    {
+        return a + b;
+    }
+};
+
+struct vp_subtract_op
+{
+    template <typename A, typename B>
+    static constexpr auto apply(A a, B b) -> decltype(a - b)
+    {
+        return a - b;
+    }
+};
+
+struct vp_multiply_op
+{
+    template <typename A, typename B>
+    static constexpr auto apply(A a, B b) -> decltype(a * b)
+    {
+        return a * b;
+    }
+};
+
+struct vp_divide_op
+{
+    template <typename A, typename B>
+    static constexpr auto apply(A a, B b) -> decltype(a / b)
+    {
+        return a / b;
+    }
+};
+
+// divides the scalar by the element (scalar / vector)
+struct vp_divide_scalar_op
+{
+    template <typename A, typename B>
+    static constexpr auto apply(A a, B b) -> decltype(b / a)
+    {
+        return b / a;
+    }
+};
+
+struct vp_negate_op
+{
+    template <typename A>
+    static constexpr A apply(A a)
+    {
+        return -a;
+    }
+};
+
+struct vp_sqrt_op
+{
+    template <typename A>
+    static auto apply(A a) -> decltype(std::sqrt(a))
+    {
+        return std::sqrt(a);
+    }
+};
+} // namespace detail
+
+// element-wise combination of two vector or point operands
+template <typename Op, typename L, typename R, typename Result>
+class VectorPointBinaryExpression : public VectorPointExpression<VectorPointBinaryExpression<Op, L, R, Result>, Result>
+{
+private:
+    vp_operand_storage<L> m_lhs;
+    vp_operand_storage<R> m_rhs;
+
+public:
+    using value_type = typename vp_traits<Result>::value_type;
+
+    constexpr VectorPointBinaryExpression(const L &lhs, const R &rhs) : m_lhs(lhs), m_rhs(rhs) {}
+
+    constexpr value_type operator()(int index) const
+    {
+        return static_cast<value_type>(Op::apply(m_lhs(index), m_rhs(index)));
+    }
+};
+
+// element-wise combination of a vector or point operand with a scalar
+template <typename Op, typename E, typename S>
+class VectorPointScalarExpression
+    : public VectorPointExpression<VectorPointScalarExpression<Op, E, S>, typename vp_result<E>::type>
+{
+private:
+    vp_operand_storage<E> m_expression;
+    S m_scalar;
+
+public:
+    using value_type = vp_value_type<E>;
+
+    constexpr VectorPointScalarExpression(const E &expression, S scalar) : m_expression(expression), m_scalar(scalar) {}
+
+    constexpr value_type operator()(int index) const
+    {
+        return static_cast<value_type>(Op::apply(m_expression(index), m_scalar));
+    }
+};
+
+// element-wise function applied to a vector or point operand
+template <typename Op, typename E>
+class VectorPointUnaryExpression
+    : public VectorPointExpression<VectorPointUnaryExpression<Op, E>, typename vp_result<E>::type>
+{
+private:
+    vp_operand_storage<E> m_expression;
+
+public:
+    using value_type = vp_value_type<E>;
+
+    constexpr explicit VectorPointUnaryExpression(const E &expression) : m_expression(expression) {}
+
+    constexpr value_type operator()(int index) const { return static_cast<value_type>(Op::apply(m_expression(index))); }
+};
+
+template <typename L, typename R>
+constexpr VectorPointBinaryExpression<
+    detail::vp_add_op,
+    L,
+    R,
+    typename vp_sum_result<typename vp_result<L>::type, typename vp_result<R>::type>::type>
+operator+(const L &lhs, const R &rhs)
+{
+    return {lhs, rhs};
+}
+
+template <typename L, typename R>
+constexpr VectorPointBinaryExpression<
+    detail::vp_subtract_op,
+    L,
+    R,
+    typename vp_difference_result<typename vp_result<L>::type, typename vp_result<R>::type>::type>
+operator-(const L &lhs, const R &rhs)
+{
+    return {lhs, rhs};
+}
+
+// element-wise product
+template <typename L, typename R>
+constexpr VectorPointBinaryExpression<
+    detail::vp_multiply_op,
+    L,
+    R,
+    typename vp_product_result<typename vp_result<L>::type, typename vp_result<R>::type>::type>
+operator*(const L &lhs, const R &rhs)
+{
+    return {lhs, rhs};
+}
+
+template <typename E, typename V>
+constexpr typename std::enable_if<is_vp_operand<E>::value && std::is_arithmetic<V>::value,
+                                  VectorPointScalarExpression<detail::vp_multiply_op, E, V>>::type
+operator*(V val, const E &vp)
+{
+    return {vp, val};
+}
+
+template <typename E, typename V>
+constexpr typename std::enable_if<is_vp_operand<E>::value && std::is_arithmetic<V>::value,
+                                  VectorPointScalarExpression<detail::vp_multiply_op, E, V>>::type
+operator*(const E &vp, V val)
+{
+    return {vp, val};
+}
+
+template <typename E, typename V>
+constexpr typename std::enable_if<is_vp_operand<E>::value && std::is_arithmetic<V>::value,
+                                  VectorPointScalarExpression<detail::vp_divide_op, E, V>>::type
+operator/(const E &vp, V val)
+{
+    return {vp, val};
+}
+
+template <typename E, typename V>
+constexpr typename std::enable_if<is_vp_operand<E>::value && std::is_arithmetic<V>::value,
+                                  VectorPointScalarExpression<detail::vp_divide_scalar_op, E, V>>::type
+operator/(V val, const E &vp)
+{
+    return {vp, val};
+}
+
+template <typename E>
+constexpr typename std::enable_if<is_vp_operand<E>::value, VectorPointUnaryExpression<detail::vp_negate_op, E>>::type
+operator-(const E &vp)
+{
+    return VectorPointUnaryExpression<detail::vp_negate_op, E>{vp};
+}
+
+template <typename E>
+typename std::enable_if<is_vp_operand<E>::value, VectorPointUnaryExpression<detail::vp_sqrt_op, E>>::type
+sqrtVP(const E &vp)
+{
+    return VectorPointUnaryExpression<detail::vp_sqrt_op, E>{vp};
+}
+
+// compound assignment with an expression on the right hand side
+template <typename U, typename E>
+constexpr typename std::enable_if<is_point_or_vector<U>::value && is_vp_expression<E>::value &&
+                                      std::is_same<typename vp_sum_result<U, typename E::result_type>::type, U>::value,
+                                  U>::type &
+operator+=(U &vp, const E &expression)
+{
+    for (int i = 0; i < vp.size(); ++i)
+    {
+        vp(i) += expression(i);
+    }
+
+    return vp;
+}
+
+template <typename U, typename E>
+constexpr typename std::enable_if<
+    is_point_or_vector<U>::value && is_vp_expression<E>::value &&
+        std::is_same<typename vp_difference_result<U, typename E::result_type>::type, U>::value,
+    U>::type &
+operator-=(U &vp, const E &expression)
+{
+    for (int i = 0; i < vp.size(); ++i)
+    {
+        vp(i) -= expression(i);
+    }
+
+    return vp;
+}
+
+template <typename U, typename E>
+constexpr typename std::enable_if<is_point_or_vector<U>::value && is_vp_expression<E>::value &&
+                                      std::is_same<typename E::result_type, U>::value,
+                                  U>::type &
+operator*=(U &vp, const E &expression)
+{
+    for (int i = 0; i < vp.size(); ++i)
+    {
+        vp(i) *= expression(i);
+    }
+
+    return vp;
+}
+
+// comparisons where at least one side is an expression
+template <typename L, typename R>
+constexpr typename std::enable_if<(is_vp_expression<L>::value || is_vp_expression<R>::value) &&
+                                      is_vp_operand<L>::value && is_vp_operand<R>::value,
+                                  bool>::type
+operator==(const L &v1, const R &v2)
+{
+    static_assert(vp_traits<typename vp_result<L>::type>::size == vp_traits<typename vp_result<R>::type>::size,
+                  "Comparing vectors or points of different size");
+
+    for (int i = 0; i < vp_traits<typename vp_result<L>::type>::size; ++i)
+    {
+        if (v1(i) != v2(i))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename L, typename R>
+constexpr typename std::enable_if<(is_vp_expression<L>::value || is_vp_expression<R>::value) &&
+                                      is_vp_operand<L>::value && is_vp_operand<R>::value,
+                                  bool>::type
+operator!=(const L &v1, const R &v2)
+{
+    return !(v1 == v2);
+}
+
+template <typename L, typename R>
+typename std::enable_if<(is_vp_expression<L>::value || is_vp_expression<R>::value) && is_vp_operand<R>::value &&
+                            std::is_floating_point<vp_value_type<L>>::value,
+                        bool>::type
+allClose(const L &v1,
+         const R &v2,
+         vp_value_type<L> maxDiff = std::numeric_limits<vp_value_type<L>>::epsilon(),
+         vp_value_type<L> maxRelDiff = std::numeric_limits<vp_value_type<L>>::epsilon())
+{
+    for (int i = 0; i < vp_traits<typename vp_result<L>::type>::size; ++i)
+    {
+        if (!Util::isClose(v1(i), v2(i), maxDiff, maxRelDiff))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename Derived, typename Result>
+std::ostream &operator<<(std::ostream &out, const VectorPointExpression<Derived, Result> &expression)
+{
+    return out << expression.eval();
+}
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,211 @@
+#ifndef MATHLIB_CORE_VECTOR_VECTOR_PACKET_TEMPLATE
+#define MATHLIB_CORE_VECTOR_VECTOR_PACKET_TEMPLATE
+
+#include "../../util/fastMath.h"
+#include "../../util/packet.h"
+#include "../../util/util.h"
+#include "./vector.h"
+#include <cassert>
+#include <limits>
+
+namespace MathLib
+{
+// width three component vectors stored as structure of arrays (one Packet per component) so that the operations
+// process all of them at once, lane i of x, y and z together form the i-th vector
+template <typename T, int width>
+class Vector3Packet
+{
+public:
+    using packet_type = Packet<T, width>;
+    using mask_type = typename packet_type::mask_type;
+
+    packet_type x;
+    packet_type y;
+    packet_type z;
+
+    Vector3Packet() = default;
+
+    Vector3Packet(const packet_type &x, const packet_type &y, const packet_type &z) : x{x}, y{y}, z{z} {}
+
+    // the same vector in all lanes
+    explicit Vector3Packet(const Vector<T, 3> &vector) : x{vector(0)}, y{vector(1)}, z{vector(2)} {}
+
+    static constexpr int size() { return width; }
+
+    // gathers width consecutive vectors
+    static Vector3Packet load(const Vector<T, 3> *vectors)
+    {
+        T components[3][width];
+        for (int lane = 0; lane < width; ++lane)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                components[i][lane] = vectors[lane](i);
+            }
+        }
+
+        return Vector3Packet{packet_type::load(components[0]),
+                             packet_type::load(components[1]),
+                             packet_type::load(components[2])};
+    }
+
+    // scatters the lanes into width consecutive vectors
+    void store(Vector<T, 3> *vectors) const
+    {
+        T components[3][width];
+        x.store(components[0]);
+        y.store(components[1]);
+        z.store(components[2]);
+
+        for (int lane = 0; lane < width; ++lane)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                vectors[lane](i) = components[i][lane];
+            }
+        }
+    }
+
+    Vector<T, 3> get(int lane) const
+    {
+        assert("Accessing out of bounds lane" && lane >= 0 && lane < width);
+
+        return Vector<T, 3>{x[lane], y[lane], z[lane]};
+    }
+
+    void set(int lane, const Vector<T, 3> &vector)
+    {
+        assert("Accessing out of bounds lane" && lane >= 0 && lane < width);
+
+        x.set(lane, vector(0));
+        y.set(lane, vector(1));
+        z.set(lane, vector(2));
+    }
+
+    packet_type norm() const { return sqrt(norm_squared()); }
+
+    packet_type norm_squared() const { return x * x + y * y + z * z; }
+
+    // uses Fast::rsqrt for float if MATHLIB_FAST_MATH is defined
+    Vector3Packet &normalize()
+    {
+        packet_type inverseNorm;
+        if constexpr (Fast::enabled<T>)
+        {
+            inverseNorm = Fast::rsqrt(norm_squared());
+        }
+        else
+        {
+            inverseNorm = packet_type{1} / norm();
+        }
+        x = x * inverseNorm;
+        y = y * inverseNorm;
+        z = z * inverseNorm;
+
+        return *this;
+    }
+
+    // set for all lanes whose vector is close to zero in every component
+    mask_type nearZero() const
+    {
+        const packet_type s{10 * std::numeric_limits<T>::epsilon()};
+
+        return (abs(x) < s) & (abs(y) < s) & (abs(z) < s);
+    }
+
+    friend Vector3Packet operator+(const Vector3Packet &v1, const Vector3Packet &v2)
+    {
+        return Vector3Packet{v1.x + v2.x, v1.y + v2.y, v1.z + v2.z};
+    }
+
+    friend Vector3Packet operator-(const Vector3Packet &v1, const Vector3Packet &v2)
+    {
+        return Vector3Packet{v1.x - v2.x, v1.y - v2.y, v1.z - v2.z};
+    }
+
+    friend Vector3Packet operator-(const Vector3Packet &v) { return Vector3Packet{-v.x, -v.y, -v.z}; }
+
+    // lane-wise scaling, a scalar is broadcast to all lanes
+    friend Vector3Packet operator*(const packet_type &s, const Vector3Packet &v)
+    {
+        return Vector3Packet{s * v.x, s * v.y, s * v.z};
+    }
+
+    friend Vector3Packet operator*(const Vector3Packet &v, const packet_type &s) { return s * v; }
+
+    friend Vector3Packet operator/(const Vector3Packet &v, const packet_type &s)
+    {
+        return Vector3Packet{v.x / s, v.y / s, v.z / s};
+    }
+
+    // lane-wise mask ? v1 : v2
+    friend Vector3Packet select(const mask_type &mask, const Vector3Packet &v1, const Vector3Packet &v2)
+    {
+        return Vector3Packet{select(mask, v1.x, v2.x), select(mask, v1.y, v2.y), select(mask, v1.z, v2.z)};
+    }
+};
+
+template <typename T>
+using Vector3x4 = Vector3Packet<T, 4>;
+
+template <typename T>
+using Vector3x8 = Vector3Packet<T, 8>;
+
+template <typename T, int width>
+Packet<T, width> dot(const Vector3Packet<T, width> &v1, const Vector3Packet<T, width> &v2)
+{
+    return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
+}
+
+template <typename T, int width>
+Vector3Packet<T, width> cross(const Vector3Packet<T, width> &v1, const Vector3Packet<T, width> &v2)
+{
+    return Vector3Packet<T, width>{v1.y * v2.z - v1.z * v2.y, v1.z * v2.x - v1.x * v2.z, v1.x * v2.y - v1.y * v2.x};
+}
+
+template <typename T, int width>
+Vector3Packet<T, width> normalize(const Vector3Packet<T, width> &vector)
+{
+    Vector3Packet<T, width> newVector{vector};
+
+    return newVector.normalize();
+}
+
+template <typename T, int width>
+Vector3Packet<T, width> reflect(const Vector3Packet<T, width> &vector, const Vector3Packet<T, width> &normal)
+{
+    return vector - (Packet<T, width>{2} * dot(vector, normal)) * normal;
+}
+
+/**
+ * Lane-wise version of refract(). Lanes in which the ray is totally internally reflected are flagged in
+ * totalInternalReflection, their result is computed like the scalar version does and should be replaced by the
+ * reflected direction (e.g. with select(totalInternalReflection, reflect(vector, normal), refracted)).
+ **/
+template <typename T, int width>
+Vector3Packet<T, width> refract(const Vector3Packet<T, width> &vector,
+                                const Vector3Packet<T, width> &normal,
+                                const Packet<T, width> &etaiOverEtat,
+                                typename Packet<T, width>::mask_type &totalInternalReflection)
+{
+    const Packet<T, width> cosTheta{min(dot(-vector, normal), Packet<T, width>{1})};
+    const Vector3Packet<T, width> rOutPerp{etaiOverEtat * (vector + cosTheta * normal)};
+    const Packet<T, width> k{Packet<T, width>{1} - rOutPerp.norm_squared()};
+
+    totalInternalReflection = k < Packet<T, width>{0};
+
+    return rOutPerp - sqrt(abs(k)) * normal;
+}
+
+template <typename T, int width>
+Vector3Packet<T, width> refract(const Vector3Packet<T, width> &vector,
+                                const Vector3Packet<T, width> &normal,
+                                const Packet<T, width> &etaiOverEtat)
+{
+    typename Packet<T, width>::mask_type totalInternalReflection;
+
+    return refract(vector, normal, etaiOverEtat, totalInternalReflection);
+}
+} // namespace MathLib
+
+#endif
@@ -16,104 +16,86 @@ template <typename T, int numElements, typename = typename std::enable_if<std::i
 class VectorPointBase
 {
 protected:
-    T *m_data = nullptr;
+    // elements are stored inline which makes vectors and points trivially copyable and free of heap allocations
+    alignas(Util::storage_alignment<T, numElements>::value) T m_data[numElements];
     friend class VectorPointBase<T, numElements - 1>;
     friend class VectorPointBase<T, numElements + 1>;
 
 public:
-    VectorPointBase() { m_data = new T[numElements]; }
-
-    ~VectorPointBase()
-    {
-        if (m_data != nullptr)
-        {
-            delete[] m_data;
-        }
-
-        m_data = nullptr;
-    }
+    // elements are left uninitialized unless the object is value initialized (e.g. Vector<T, size>{})
+    VectorPointBase() = default;
 
     // provide constructor that is only callable with correct number of parameters
     template <typename... Tail>
-    VectorPointBase(
+    constexpr VectorPointBase(
         typename std::enable_if<sizeof...(Tail) + 1 == numElements && are_arithmetic<Tail...>{}, T>::type head,
         Tail... tail)
-        : m_data{new T[numElements]{head, T(tail)...}}
+        : m_data{head, T(tail)...}
     {
     }
 
-    VectorPointBase(const VectorPointBase &other) : VectorPointBase() { *this = other; }
+    // copies and moves are memberwise copies of the inline storage
+    VectorPointBase(const VectorPointBase &other) = default;
+    VectorPointBase(VectorPointBase &&other) = default;
+    VectorPointBase &operator=(const VectorPointBase &other) = default;
+    VectorPointBase &operator=(VectorPointBase &&other) = default;
+    ~VectorPointBase() = default;
 
     // copy construction and assignment with conversion
     template <typename U>
-    VectorPointBase(const VectorPointBase<U, numElements> &other) : VectorPointBase()
+    constexpr VectorPointBase(const VectorPointBase<U, numElements> &other)
     {
         *this = other;
     }
 
-    // move construction
-    VectorPointBase(VectorPointBase &&other) { *this = std::move(other); }
-
-    // create vector with size: numElements + 1 by providing a vector with size: numElements and an additional number
-    VectorPointBase(const VectorPointBase<T, numElements - 1> &other, T val) : VectorPointBase()
+    template <typename U>
+    constexpr VectorPointBase<T, numElements> &operator=(const VectorPointBase<U, numElements> &other)
     {
+        const U *raw = other.data();
         for (int i = 0; i < numElements; ++i)
         {
-            m_data[i] = other.m_data[i];
+            m_data[i] = raw[i];
         }
 
-        m_data[numElements - 1] = val;
+        return *this;
     }
 
-    // create vector with size: numElements - 1 from a vector which will remove the last entry
-    VectorPointBase(const VectorPointBase<T, numElements + 1> &other) : VectorPointBase()
+    // create vector with size: numElements + 1 by providing a vector with size: numElements and an additional number
+    constexpr VectorPointBase(const VectorPointBase<T, numElements - 1> &other, T val)
     {
-        for (int i = 0; i < numElements; ++i)
+        for (int i = 0; i < numElements - 1; ++i)
         {
             m_data[i] = other.m_data[i];
         }
+
+        m_data[numElements - 1] = val;
     }
 
-    VectorPointBase<T, numElements> &operator=(const VectorPointBase<T, numElements> &other)
+    // create vector with size: numElements - 1 from a vector which will remove the last entry
+    constexpr VectorPointBase(const VectorPointBase<T, numElements + 1> &other)
     {
-        if (this == &other)
-        {
-            return *this;
-        }
-
         for (int i = 0; i < numElements; ++i)
         {
             m_data[i] = other.m_data[i];
         }
-
-        return *this;
-    }
-
-    VectorPointBase &operator=(VectorPointBase &&other)
-    {
-        delete this->m_data;
-        this->m_data = other.m_data;
-        other.m_data = nullptr;
-
-        return *this;
     }
 
     constexpr int size() const { return numElements; };
 
     // using () operator for subscript to have same API as matrix ([] can't take two arguments)
-    T operator()(int index) const { return m_data[index]; }
+    constexpr T operator()(int index) const { return m_data[index]; }
 
-    T &operator()(int index) { return m_data[index]; }
+    constexpr T &operator()(int index) { return m_data[index]; }
 
     // access to index which out of bounds check
-    T at(int index) const
+    constexpr T at(int index) const
     {
         assert("Accessing out of bounds index" && index >= 0 && index < numElements);
 
         return m_data[index];
     }
 
-    T &at(int index)
+    constexpr T &at(int index)
     {
         assert("Accessing out of bounds index" && index >= 0 && index < numElements);
 
@@ -121,14 +103,14 @@ public:
     }
 
     // update of value at index with out of bound check
-    void set(int index, T val)
+    constexpr void set(int index, T val)
     {
         assert("Accessing out of bounds index" && index >= 0 && index < numElements);
 
         m_data[index] = val;
     }
 
-    bool nearZero() const
+    constexpr bool nearZero() const
     {
         const auto s = 10 * std::numeric_limits<T>::epsilon();
 
@@ -144,7 +126,9 @@ public:
     }
 
     // return a pointer to the internal data array
-    T *data() const { return m_data; }
+    constexpr const T *data() const { return m_data; }
+
+    constexpr T *data() { return m_data; }
 };
 
 std::false_type is_point_or_vector_impl(...);
@@ -155,7 +139,8 @@ template <typename T>
 using is_point_or_vector = decltype(is_point_or_vector_impl(std::declval<T &>()));
 
 template <typename U, typename T>
-typename std::enable_if<is_point_or_vector<U>::value && std::is_arithmetic<T>::value, U>::type &operator+=(U &vp, T val)
+constexpr typename std::enable_if<is_point_or_vector<U>::value && std::is_arithmetic<T>::value, U>::type &
+operator+=(U &vp, T val)
 {
     for (int i = 0; i < vp.size(); ++i)
     {
@@ -166,7 +151,8 @@ typename std::enable_if<is_point_or_vector<U>::value && std::is_arithmetic<T>::v
 }
 
 template <typename U, typename T>
-typename std::enable_if<is_point_or_vector<U>::value, U>::type &operator-=(U &vp, T val)
+constexpr typename std::enable_if<is_point_or_vector<U>::value && std::is_arithmetic<T>::value, U>::type &
+operator-=(U &vp, T val)
 {
     for (int i = 0; i < vp.size(); ++i)
     {
@@ -177,7 +163,7 @@ typename std::enable_if<is_point_or_vector<U>::value, U>::type &operator-=(U &vp
 }
 
 template <typename U>
-typename std::enable_if<is_point_or_vector<U>::value, U>::type &operator*=(U &vp1, const U &vp2)
+constexpr typename std::enable_if<is_point_or_vector<U>::value, U>::type &operator*=(U &vp1, const U &vp2)
 {
     for (int i = 0; i < vp1.size(); ++i)
     {
@@ -188,7 +174,8 @@ typename std::enable_if<is_point_or_vector<U>::value, U>::type &operator*=(U &vp
 }
 
 template <typename U, typename T>
-typename std::enable_if<is_point_or_vector<U>::value && std::is_arithmetic<T>::value, U>::type &operator*=(U &vp, T val)
+constexpr typename std::enable_if<is_point_or_vector<U>::value && std::is_arithmetic<T>::value, U>::type &
+operator*=(U &vp, T val)
 {
     for (int i = 0; i < vp.size(); ++i)
     {
@@ -199,7 +186,8 @@ typename std::enable_if<is_point_or_vector<U>::value && std::is_arithmetic<T>::v
 }
 
 template <typename U, typename T>
-typename std::enable_if<is_point_or_vector<U>::value, U>::type &operator/=(U &vp, T val)
+constexpr typename std::enable_if<is_point_or_vector<U>::value && std::is_arithmetic<T>::value, U>::type &
+operator/=(U &vp, T val)
 {
     for (int i = 0; i < vp.size(); ++i)
     {
@@ -209,67 +197,8 @@ typename std::enable_if<is_point_or_vector<U>::value, U>::type &operator/=(U &vp
     return vp;
 }
 
-template <typename U, typename V>
-typename std::enable_if<is_point_or_vector<U>::value && std::is_arithmetic<V>::value, U>::type operator*(V val,
-                                                                                                         const U &vp)
-{
-    U product{vp};
-
-    return product *= val;
-}
-
-template <typename U, typename V>
-typename std::enable_if<is_point_or_vector<U>::value, U>::type operator*(const U &vp, V val)
-{
-    U product{vp};
-
-    return product *= val;
-}
-
-template <typename U, typename V>
-typename std::enable_if<is_point_or_vector<U>::value, U>::type operator/(const U &vp, V val)
-{
-    U product{vp};
-
-    return product /= val;
-}
-
-template <typename U, typename V>
-typename std::enable_if<is_point_or_vector<U>::value, U>::type operator/(V val, const U &vp)
-{
-    U product{};
-
-    for (int i = 0; i < vp.size(); ++i)
-    {
-        product(i) = val / vp(i);
-    }
-
-    return product;
-}
-
-template <typename U>
-typename std::enable_if<is_point_or_vector<U>::value, U>::type sqrtVP(const U &vp)
-{
-    U res{vp};
-
-    for (int i{0}; i < vp.size(); ++i)
-    {
-        res.at(i) = std::sqrt(vp.at(i));
-    }
-
-    return res;
-}
-
-template <typename U>
-typename std::enable_if<is_point_or_vector<U>::value, U>::type operator-(const U &vp)
-{
-    U negation{vp};
-
-    return negate(negation);
-}
-
 template <typename U>
-typename std::enable_if<is_point_or_vector<U>::value, U>::type &negate(U &vp)
+constexpr typename std::enable_if<is_point_or_vector<U>::value, U>::type &negate(U &vp)
 {
     for (int i = 0; i < vp.size(); ++i)
     {
@@ -292,13 +221,13 @@ typename std::enable_if<is_point_or_vector<U>::value, U>::type &clamp(U &vp, con
 }
 
 template <typename T>
-float param_sum_impl(float param, const T &vp)
+float param_sum_impl(float param, const T &)
 {
     return param;
 }
 
 template <typename T, typename... Args>
-float param_sum_impl(float param, const T &vp, const Args &...args)
+float param_sum_impl(float param, const T &, const Args &...args)
 {
     return param + param_sum_impl(args...);
 }
@@ -329,7 +258,7 @@ T affineCombination(float param, const T &vp, const Args &...args)
     static_assert("Called affineCombination with uneven number of arguments. Should be called with"
                   "(Parameter, Point/Vector, Parameter, ...)" &&
                   sizeof...(Args) % 2 == 0);
-    float paramSum{param_sum_impl(param, vp, args...)};
+    [[maybe_unused]] float paramSum{param_sum_impl(param, vp, args...)};
     assert("Parameters are not summing up to 1." && Util::isClose(paramSum, 1.0f));
 
     T combination{vp};
@@ -341,7 +270,7 @@ T affineCombination(float param, const T &vp, const Args &...args)
 }
 
 template <typename T, int size>
-bool operator==(const VectorPointBase<T, size> &v1, const VectorPointBase<T, size> &v2)
+constexpr bool operator==(const VectorPointBase<T, size> &v1, const VectorPointBase<T, size> &v2)
 {
     for (int i = 0; i < size; ++i)
     {
@@ -372,7 +301,7 @@ bool allClose(const VectorPointBase<T, size> &v1,
 }
 
 template <typename T, int size>
-bool operator!=(const VectorPointBase<T, size> &v1, const VectorPointBase<T, size> &v2)
+constexpr bool operator!=(const VectorPointBase<T, size> &v1, const VectorPointBase<T, size> &v2)
 {
     return !(v1 == v2);
 }
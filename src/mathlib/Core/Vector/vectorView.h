@@ -0,0 +1,124 @@
+#ifndef MATHLIB_CORE_VECTOR_VECTOR_VIEW_TEMPLATE
+#define MATHLIB_CORE_VECTOR_VECTOR_VIEW_TEMPLATE
+
+#include "./point.h"
+#include "./vector.h"
+#include "./vectorExpression.h"
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace MathLib
+{
+/**
+ * Non-owning view of size elements which lie stride elements apart in memory, e.g. a row or column of a Matrix or a
+ * vector inside a foreign buffer (a mapped file, GPU staging memory). Views take part in vector and point expressions
+ * like the Vector or Point type Result they stand for (a + view, dot(view, n), mat * view) without copying, a view of
+ * const T is read only.
+ *
+ * Like a reference the view does not own its elements: it must not outlive the memory it was created from, copies of
+ * a view refer to the same memory and assigning to a view overwrites the viewed elements.
+ **/
+template <typename T, int size, typename Result>
+class VectorPointView : public VectorPointExpression<VectorPointView<T, size, Result>, Result>
+{
+private:
+    T *m_data;
+    std::ptrdiff_t m_stride;
+
+public:
+    using value_type = typename std::remove_const<T>::type;
+
+    constexpr explicit VectorPointView(T *data, std::ptrdiff_t stride = 1) : m_data{data}, m_stride{stride} {}
+
+    // read only view of the elements of a writable one
+    template <typename U, typename = typename std::enable_if<std::is_same<const U, T>::value>::type>
+    constexpr VectorPointView(const VectorPointView<U, size, Result> &other)
+        : m_data{other.data()}, m_stride{other.stride()}
+    {
+    }
+
+    VectorPointView(const VectorPointView &other) = default;
+
+    // copies the elements of the other view (not the view itself)
+    constexpr VectorPointView &operator=(const VectorPointView &other) { return *this = Result{other}; }
+
+    // overwrites the viewed elements with a vector (point) or the result of an expression
+    template <typename E,
+              typename = typename std::enable_if<(is_point_or_vector<E>::value || is_vp_expression<E>::value) &&
+                                                 std::is_same<typename vp_result<E>::type, Result>::value>::type>
+    constexpr VectorPointView &operator=(const E &other)
+    {
+        static_assert(!std::is_const<T>::value, "Assigning to a read only view");
+
+        // evaluated first, the expression may read the viewed elements at other positions (e.g. row(0) = col(0))
+        const Result values{other};
+        for (int i{0}; i < size; ++i)
+        {
+            (*this)(i) = values(i);
+        }
+
+        return *this;
+    }
+
+    constexpr T &operator()(int index) const { return m_data[index * m_stride]; }
+
+    constexpr T &at(int index) const
+    {
+        assert("Accessing vector with index out of its bounds" && index >= 0 && index < size);
+
+        return m_data[index * m_stride];
+    }
+
+    // the first element, the others follow stride elements apart
+    constexpr T *data() const { return m_data; }
+
+    constexpr std::ptrdiff_t stride() const { return m_stride; }
+
+    template <typename E>
+    constexpr VectorPointView &operator+=(const E &other)
+    {
+        return *this = *this + other;
+    }
+
+    template <typename E>
+    constexpr VectorPointView &operator-=(const E &other)
+    {
+        return *this = *this - other;
+    }
+
+    template <typename V, typename = typename std::enable_if<std::is_arithmetic<V>::value>::type>
+    constexpr VectorPointView &operator*=(V scalar)
+    {
+        return *this = *this * scalar;
+    }
+
+    template <typename V, typename = typename std::enable_if<std::is_arithmetic<V>::value>::type>
+    constexpr VectorPointView &operator/=(V scalar)
+    {
+        assert("Division by zero" && scalar != 0);
+
+        return *this = *this / scalar;
+    }
+
+    // swaps the viewed elements (the views are the references of array view iterators, see std::iter_swap)
+    friend constexpr void swap(VectorPointView view1, VectorPointView view2)
+    {
+        static_assert(!std::is_const<T>::value, "Assigning to a read only view");
+
+        for (int i{0}; i < size; ++i)
+        {
+            std::swap(view1(i), view2(i));
+        }
+    }
+};
+
+template <typename T, int size>
+using VectorView = VectorPointView<T, size, Vector<typename std::remove_const<T>::type, size>>;
+
+template <typename T, int size>
+using PointView = VectorPointView<T, size, Point<typename std::remove_const<T>::type, size>>;
+} // namespace MathLib
+
+#endif
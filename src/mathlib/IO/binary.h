@@ -0,0 +1,533 @@
+#ifndef MATHLIB_IO_BINARY_H
+#define MATHLIB_IO_BINARY_H
+
+#include "../Core/Matrix/matrix.h"
+#include "../Core/Quaternion/quaternion.h"
+#include "../Core/Vector/point.h"
+#include "../Core/Vector/vector.h"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MATHLIB_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace MathLib
+{
+/**
+ * Binary files of arrays of matrices, vectors, points or quaternions: a 64 byte BinaryHeader followed by the elements
+ * exactly like they lie in memory (components in the order of operator(), matrices column major), so a file can be
+ * used in place after mapping it into memory (see MappedArray). The header is written in the byte order of the
+ * writing machine, readers recognize files of the other byte order by the byte order mark.
+ *
+ * Unlike the text output of operator<< the values are stored exactly.
+ **/
+
+enum class BinaryElementKind : std::uint8_t
+{
+    matrix = 1,
+    vector = 2,
+    point = 3,
+    quaternion = 4
+};
+
+enum class BinaryScalarType : std::uint8_t
+{
+    float32 = 1,
+    float64 = 2,
+    int8 = 3,
+    int16 = 4,
+    int32 = 5,
+    int64 = 6,
+    uint8 = 7,
+    uint16 = 8,
+    uint32 = 9,
+    uint64 = 10
+};
+
+struct BinaryHeader
+{
+    static constexpr char file_magic[4]{'M', 'L', 'I', 'B'};
+    static constexpr std::uint16_t current_version{1};
+    // reads as 0xFFFE on a machine with the other byte order
+    static constexpr std::uint16_t byte_order_mark{0xFEFF};
+
+    char magic[4];
+    std::uint16_t version;
+    std::uint16_t byteOrder;
+    BinaryElementKind kind;
+    BinaryScalarType scalarType;
+    // size of one element in bytes
+    std::uint16_t elementSize;
+    // vectors, points and quaternions are columns (cols = 1)
+    std::uint32_t rows;
+    std::uint32_t cols;
+    // always 0, keeps count at offset 24 also where std::uint64_t is only 4 byte aligned (32 bit x86)
+    std::uint32_t padding;
+    // number of elements following the header
+    std::uint64_t count;
+    std::uint8_t reserved[32];
+};
+
+// the file format is fixed by these offsets, not by the alignment rules of the compiler
+static_assert(sizeof(BinaryHeader) == 64, "The binary header has to be 64 bytes");
+static_assert(offsetof(BinaryHeader, count) == 24, "The element count has to be at offset 24 of the binary header");
+
+static_assert(sizeof(BinaryHeader) == 64, "The elements have to start 64 bytes into the file");
+
+namespace detail
+{
+template <typename T>
+constexpr BinaryScalarType binary_scalar_type()
+{
+    static_assert(std::is_integral<T>::value ||
+                      (std::is_floating_point<T>::value && (sizeof(T) == 4 || sizeof(T) == 8)),
+                  "No binary format for this scalar type");
+
+    if constexpr (std::is_floating_point<T>::value)
+    {
+        return sizeof(T) == 4 ? BinaryScalarType::float32 : BinaryScalarType::float64;
+    }
+    else
+    {
+        constexpr int index{sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 1 : sizeof(T) == 4 ? 2 : 3};
+        return static_cast<BinaryScalarType>((std::is_signed<T>::value ? 3 : 7) + index);
+    }
+}
+
+template <typename Element>
+struct binary_traits;
+
+template <typename T, int rows, int cols, typename V>
+struct binary_traits<Matrix<T, rows, cols, V>>
+{
+    using scalar_type = T;
+    static constexpr BinaryElementKind kind{BinaryElementKind::matrix};
+    static constexpr std::uint32_t row_count{rows};
+    static constexpr std::uint32_t col_count{cols};
+};
+
+template <typename T, int size, typename V>
+struct binary_traits<Vector<T, size, V>>
+{
+    using scalar_type = T;
+    static constexpr BinaryElementKind kind{BinaryElementKind::vector};
+    static constexpr std::uint32_t row_count{size};
+    static constexpr std::uint32_t col_count{1};
+};
+
+template <typename T, int size, typename V>
+struct binary_traits<Point<T, size, V>>
+{
+    using scalar_type = T;
+    static constexpr BinaryElementKind kind{BinaryElementKind::point};
+    static constexpr std::uint32_t row_count{size};
+    static constexpr std::uint32_t col_count{1};
+};
+
+template <typename T, typename V>
+struct binary_traits<Quaternion<T, V>>
+{
+    using scalar_type = T;
+    static constexpr BinaryElementKind kind{BinaryElementKind::quaternion};
+    static constexpr std::uint32_t row_count{4};
+    static constexpr std::uint32_t col_count{1};
+};
+
+template <typename Element>
+constexpr BinaryHeader binaryHeader(std::uint64_t count)
+{
+    using traits = binary_traits<Element>;
+    using T = typename traits::scalar_type;
+    static_assert(std::is_trivially_copyable<Element>::value, "Binary elements are copied byte by byte");
+    // the elements are arrays of scalars without padding, which allows swapping their byte order scalar by scalar
+    static_assert(sizeof(Element) == sizeof(T) * traits::row_count * traits::col_count,
+                  "Binary elements may not contain padding");
+    static_assert(sizeof(Element) <= std::numeric_limits<std::uint16_t>::max(),
+                  "Binary elements have to be smaller than 64 KiB, their size is stored in 16 bits");
+
+    BinaryHeader header{};
+    for (int i{0}; i < 4; ++i)
+    {
+        header.magic[i] = BinaryHeader::file_magic[i];
+    }
+    header.version = BinaryHeader::current_version;
+    header.byteOrder = BinaryHeader::byte_order_mark;
+    header.kind = traits::kind;
+    header.scalarType = binary_scalar_type<T>();
+    header.elementSize = sizeof(Element);
+    header.rows = traits::row_count;
+    header.cols = traits::col_count;
+    header.padding = 0;
+    header.count = count;
+
+    return header;
+}
+
+template <typename U>
+U byteSwap(U value)
+{
+    unsigned char bytes[sizeof(U)];
+    std::memcpy(bytes, &value, sizeof(U));
+    for (std::size_t i{0}; i < sizeof(U) / 2; ++i)
+    {
+        const unsigned char byte{bytes[i]};
+        bytes[i] = bytes[sizeof(U) - 1 - i];
+        bytes[sizeof(U) - 1 - i] = byte;
+    }
+    std::memcpy(&value, bytes, sizeof(U));
+
+    return value;
+}
+
+// reverses the bytes of each of the count scalars of size scalarSize in data
+inline void byteSwapScalars(void *data, std::size_t scalarSize, std::size_t count)
+{
+    unsigned char *bytes{static_cast<unsigned char *>(data)};
+    for (std::size_t i{0}; i < count; ++i, bytes += scalarSize)
+    {
+        for (std::size_t j{0}; j < scalarSize / 2; ++j)
+        {
+            const unsigned char byte{bytes[j]};
+            bytes[j] = bytes[scalarSize - 1 - j];
+            bytes[scalarSize - 1 - j] = byte;
+        }
+    }
+}
+
+// brings a header in the byte order of the reading machine, false if it is no valid header
+inline bool normalizeBinaryHeader(BinaryHeader &header, bool &swapped)
+{
+    if (std::memcmp(header.magic, BinaryHeader::file_magic, 4) != 0)
+    {
+        return false;
+    }
+
+    swapped = header.byteOrder != BinaryHeader::byte_order_mark;
+    if (swapped)
+    {
+        header.version = byteSwap(header.version);
+        header.byteOrder = byteSwap(header.byteOrder);
+        header.elementSize = byteSwap(header.elementSize);
+        header.rows = byteSwap(header.rows);
+        header.cols = byteSwap(header.cols);
+        header.count = byteSwap(header.count);
+    }
+
+    return header.byteOrder == BinaryHeader::byte_order_mark && header.version == BinaryHeader::current_version;
+}
+
+// true if the (normalized) header describes an array of Element
+template <typename Element>
+bool matchesBinaryHeader(const BinaryHeader &header)
+{
+    const BinaryHeader expected{binaryHeader<Element>(0)};
+
+    return header.kind == expected.kind && header.scalarType == expected.scalarType &&
+           header.elementSize == expected.elementSize && header.rows == expected.rows && header.cols == expected.cols;
+}
+
+// bytes read at once from streams whose length is unknown, so a corrupt count does not allocate more than the data
+constexpr std::size_t binary_read_chunk{1 << 20};
+
+// number of bytes after the current position, -1 if the stream can not seek
+inline std::streamoff remainingBytes(std::istream &in)
+{
+    const std::istream::pos_type position{in.tellg()};
+    if (position == std::istream::pos_type(-1) || !in.seekg(0, std::ios::end))
+    {
+        in.clear();
+        return -1;
+    }
+
+    const std::istream::pos_type end{in.tellg()};
+    in.seekg(position);
+    if (end == std::istream::pos_type(-1) || !in)
+    {
+        in.clear();
+        in.seekg(position);
+        return -1;
+    }
+
+    return end - position;
+}
+} // namespace detail
+
+/**
+ * Streams elements into a binary file: the header is written on construction and the element count patched into it
+ * by finish() (or the destructor), which needs a seekable stream (e.g. std::ofstream opened with std::ios::binary).
+ * Elements are written directly from the memory they are passed in.
+ **/
+template <typename Element>
+class BinaryArrayWriter
+{
+private:
+    std::ostream &m_out;
+    std::ostream::pos_type m_start;
+    std::uint64_t m_count{0};
+    bool m_finished{false};
+
+public:
+    explicit BinaryArrayWriter(std::ostream &out) : m_out{out}, m_start{out.tellp()}
+    {
+        const BinaryHeader header{detail::binaryHeader<Element>(0)};
+        m_out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    }
+
+    BinaryArrayWriter(const BinaryArrayWriter &other) = delete;
+    BinaryArrayWriter &operator=(const BinaryArrayWriter &other) = delete;
+
+    ~BinaryArrayWriter() { finish(); }
+
+    bool write(const Element *elements, std::size_t count)
+    {
+        assert("Writing to a finished binary array" && !m_finished);
+
+        m_out.write(reinterpret_cast<const char *>(elements), static_cast<std::streamsize>(count * sizeof(Element)));
+        m_count += count;
+
+        return m_out.good();
+    }
+
+    bool write(const Element &element) { return write(&element, 1); }
+
+    std::uint64_t count() const { return m_count; }
+
+    // writes the final count into the header, returns false if any write failed
+    bool finish()
+    {
+        if (m_finished)
+        {
+            return m_out.good();
+        }
+        m_finished = true;
+
+        const std::ostream::pos_type end{m_out.tellp()};
+        if (m_start == std::ostream::pos_type(-1) || end == std::ostream::pos_type(-1))
+        {
+            m_out.setstate(std::ios::failbit);
+            return false;
+        }
+
+        m_out.seekp(m_start + static_cast<std::streamoff>(offsetof(BinaryHeader, count)));
+        m_out.write(reinterpret_cast<const char *>(&m_count), sizeof(m_count));
+        m_out.seekp(end);
+
+        return m_out.good();
+    }
+};
+
+// writes count elements with their header, unlike BinaryArrayWriter this works with any stream
+template <typename Element>
+bool writeBinary(std::ostream &out, const Element *elements, std::size_t count)
+{
+    const BinaryHeader header{detail::binaryHeader<Element>(count)};
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(elements), static_cast<std::streamsize>(count * sizeof(Element)));
+
+    return out.good();
+}
+
+// reads the header at the current position (in the byte order of this machine), e.g. to find out the element type
+inline bool readBinaryHeader(std::istream &in, BinaryHeader &header)
+{
+    bool swapped{false};
+
+    return in.read(reinterpret_cast<char *>(&header), sizeof(header)) && detail::normalizeBinaryHeader(header, swapped);
+}
+
+/**
+ * Reads a binary array of Element (also one written on a machine with the other byte order) into elements, returns
+ * false if the stream does not hold a valid array of Element.
+ **/
+template <typename Element>
+bool readBinary(std::istream &in, std::vector<Element> &elements)
+{
+    BinaryHeader header;
+    bool swapped{false};
+    if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+        !detail::normalizeBinaryHeader(header, swapped) || !detail::matchesBinaryHeader<Element>(header))
+    {
+        return false;
+    }
+
+    // the count comes from the file, it must neither overflow the size in bytes nor exceed the rest of the stream
+    elements.clear();
+    if (header.count > std::numeric_limits<std::size_t>::max() / sizeof(Element))
+    {
+        return false;
+    }
+    const std::size_t count{static_cast<std::size_t>(header.count)};
+    const std::streamoff remaining{detail::remainingBytes(in)};
+    if (remaining >= 0 && static_cast<std::uint64_t>(remaining) / sizeof(Element) < count)
+    {
+        return false;
+    }
+
+    // without a known length the elements are read in chunks, a truncated stream then fails before allocating count
+    const std::size_t chunk{remaining >= 0 ? count
+                                           : std::max<std::size_t>(detail::binary_read_chunk / sizeof(Element), 1)};
+    for (std::size_t first{0}; first < count; first += chunk)
+    {
+        const std::size_t chunkCount{std::min(chunk, count - first)};
+        elements.resize(first + chunkCount);
+        if (!in.read(reinterpret_cast<char *>(elements.data() + first),
+                     static_cast<std::streamsize>(chunkCount * sizeof(Element))))
+        {
+            elements.clear();
+            return false;
+        }
+    }
+
+    if (swapped)
+    {
+        using T = typename detail::binary_traits<Element>::scalar_type;
+        detail::byteSwapScalars(elements.data(), sizeof(T), count * sizeof(Element) / sizeof(T));
+    }
+
+    return true;
+}
+
+#if defined(MATHLIB_HAS_MMAP)
+/**
+ * Read only array of Element mapped from a binary file without copying it, the elements are loaded by the operating
+ * system on first access. Files in the other byte order can not be used in place, open() rejects them like files of
+ * other element types (readBinary converts them).
+ **/
+template <typename Element>
+class MappedArray
+{
+private:
+    void *m_mapping{nullptr};
+    std::size_t m_mappingSize{0};
+    const Element *m_data{nullptr};
+    std::size_t m_count{0};
+
+public:
+    MappedArray() = default;
+
+    MappedArray(const MappedArray &other) = delete;
+    MappedArray &operator=(const MappedArray &other) = delete;
+
+    MappedArray(MappedArray &&other) noexcept
+        : m_mapping{other.m_mapping}, m_mappingSize{other.m_mappingSize}, m_data{other.m_data}, m_count{other.m_count}
+    {
+        other.m_mapping = nullptr;
+        other.m_mappingSize = 0;
+        other.m_data = nullptr;
+        other.m_count = 0;
+    }
+
+    MappedArray &operator=(MappedArray &&other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            std::swap(m_mapping, other.m_mapping);
+            std::swap(m_mappingSize, other.m_mappingSize);
+            std::swap(m_data, other.m_data);
+            std::swap(m_count, other.m_count);
+        }
+
+        return *this;
+    }
+
+    ~MappedArray() { close(); }
+
+    // maps the file at path, returns false if it can not be mapped or holds no valid array of Element
+    bool open(const char *path)
+    {
+        close();
+
+        const int file{::open(path, O_RDONLY)};
+        if (file < 0)
+        {
+            return false;
+        }
+
+        struct stat status;
+        void *mapping{MAP_FAILED};
+        std::size_t size{0};
+        if (::fstat(file, &status) == 0 && status.st_size >= static_cast<off_t>(sizeof(BinaryHeader)))
+        {
+            size = static_cast<std::size_t>(status.st_size);
+            mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        }
+        // the mapping stays valid after closing the file
+        ::close(file);
+
+        if (mapping == MAP_FAILED)
+        {
+            return false;
+        }
+
+        BinaryHeader header;
+        std::memcpy(&header, mapping, sizeof(header));
+        bool swapped{false};
+        if (!detail::normalizeBinaryHeader(header, swapped) || swapped ||
+            !detail::matchesBinaryHeader<Element>(header) ||
+            header.count > (size - sizeof(BinaryHeader)) / sizeof(Element))
+        {
+            ::munmap(mapping, size);
+            return false;
+        }
+
+        // mappings start at a page boundary, so the elements 64 bytes further are aligned for any Element
+        m_mapping = mapping;
+        m_mappingSize = size;
+        m_data = reinterpret_cast<const Element *>(static_cast<const unsigned char *>(mapping) + sizeof(BinaryHeader));
+        m_count = static_cast<std::size_t>(header.count);
+
+        return true;
+    }
+
+    void close()
+    {
+        if (m_mapping)
+        {
+            ::munmap(m_mapping, m_mappingSize);
+        }
+        m_mapping = nullptr;
+        m_mappingSize = 0;
+        m_data = nullptr;
+        m_count = 0;
+    }
+
+    bool isOpen() const { return m_mapping != nullptr; }
+
+    const Element *data() const { return m_data; }
+
+    std::size_t size() const { return m_count; }
+
+    bool empty() const { return m_count == 0; }
+
+    const Element &operator[](std::size_t index) const { return m_data[index]; }
+
+    const Element &at(std::size_t index) const
+    {
+        assert("Accessing array with index out of its bounds" && index < m_count);
+
+        return m_data[index];
+    }
+
+    const Element *begin() const { return m_data; }
+
+    const Element *end() const { return m_data + m_count; }
+};
+#endif
+} // namespace MathLib
+
+#endif
@@ -1,10 +1,34 @@
 #ifndef MATHLIB_MAIN_INCLUDE_H
 #define MATHLIB_MAIN_INCLUDE_H
 
+#include "./Core/Geometry/aabb.h"
+#include "./Core/Geometry/bvh.h"
+#include "./Core/Geometry/geometryPacket.h"
+#include "./Core/Geometry/hashGrid.h"
+#include "./Core/Geometry/kdTree.h"
+#include "./Core/Geometry/neighbors.h"
+#include "./Core/Geometry/ray.h"
+#include "./Core/Geometry/triangle.h"
+#include "./Core/Matrix/decomposition.h"
+#include "./Core/Matrix/denseMatrix.h"
 #include "./Core/Matrix/matrix.h"
+#include "./Core/Matrix/matrixView.h"
+#include "./Core/Matrix/transform.h"
+#include "./Core/Quaternion/quaternion.h"
+#include "./Core/Quaternion/quaternionPacket.h"
+#include "./Core/Vector/arrayView.h"
+#include "./Core/Vector/denseVector.h"
 #include "./Core/Vector/point.h"
 #include "./Core/Vector/vector.h"
+#include "./Core/Vector/vectorArray.h"
+#include "./Core/Vector/vectorPacket.h"
+#include "./Core/Vector/vectorView.h"
 
+#include "./IO/binary.h"
+
+#include "./util/fastMath.h"
+#include "./util/random.h"
+#include "./util/threadPool.h"
 #include "./util/util.h"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,96 @@
+#ifndef MATHLIB_UTIL_ALIGNED_BUFFER_H
+#define MATHLIB_UTIL_ALIGNED_BUFFER_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace MathLib
+{
+namespace Util
+{
+// alignment of the heap storage of the runtime sized types, one cache line (which covers all SIMD registers up to
+// AVX-512)
+constexpr std::size_t buffer_alignment{64};
+
+/**
+ * Owning, cache line aligned array of count elements on the heap. Ownership can only be moved, copying a buffer is
+ * always an explicit clone(). The elements are left uninitialized, so only trivial types are allowed.
+ **/
+template <typename T>
+class AlignedBuffer
+{
+    static_assert(std::is_trivially_copyable<T>::value && std::is_trivially_destructible<T>::value,
+                  "AlignedBuffer only holds trivial types");
+
+private:
+    T *m_data{nullptr};
+    std::size_t m_size{0};
+
+public:
+    AlignedBuffer() = default;
+
+    explicit AlignedBuffer(std::size_t size)
+        : m_data{size ? static_cast<T *>(::operator new(size * sizeof(T), std::align_val_t{buffer_alignment}))
+                      : nullptr},
+          m_size{size}
+    {
+    }
+
+    AlignedBuffer(const AlignedBuffer &other) = delete;
+    AlignedBuffer &operator=(const AlignedBuffer &other) = delete;
+
+    AlignedBuffer(AlignedBuffer &&other) noexcept
+        : m_data{std::exchange(other.m_data, nullptr)}, m_size{std::exchange(other.m_size, 0)}
+    {
+    }
+
+    AlignedBuffer &operator=(AlignedBuffer &&other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+        }
+
+        return *this;
+    }
+
+    ~AlignedBuffer() { release(); }
+
+    AlignedBuffer clone() const
+    {
+        AlignedBuffer copy{m_size};
+        for (std::size_t i{0}; i < m_size; ++i)
+        {
+            copy.m_data[i] = m_data[i];
+        }
+
+        return copy;
+    }
+
+    std::size_t size() const { return m_size; }
+
+    T *data() { return m_data; }
+
+    const T *data() const { return m_data; }
+
+    T &operator[](std::size_t index) { return m_data[index]; }
+
+    const T &operator[](std::size_t index) const { return m_data[index]; }
+
+private:
+    void release()
+    {
+        if (m_data)
+        {
+            ::operator delete(m_data, std::align_val_t{buffer_alignment});
+        }
+    }
+};
+} // namespace Util
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,333 @@
+#ifndef MATHLIB_UTIL_FAST_MATH_H
+#define MATHLIB_UTIL_FAST_MATH_H
+
+#include "./packet.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace MathLib
+{
+/**
+ * Polynomial approximations of elementary functions. They are branch free and built only from +, -, *, / and sqrt
+ * (rsqrt and exp additionally need an estimate instruction or exponent bit manipulation), so the same code works for
+ * a single float or double and lane-wise for a Packet. The documented error bounds are the maximum errors of the
+ * approximations themselves, evaluating them in float adds the usual rounding errors (a few ulp).
+ *
+ * Defining MATHLIB_FAST_MATH (or configuring with the CMake option of the same name) switches normalize, angleTo and
+ * the rotation builders (getRotateX/Y/Z) of float vectors, Vector3Packets and matrices from the exact functions of
+ * <cmath> to these approximations. Their errors are within a few float ulp but far above the precision of double, so
+ * double keeps the exact functions (see type_policy). The macro has to be defined the same way in every translation
+ * unit of a program.
+ **/
+namespace Fast
+{
+enum class Policy
+{
+    exact,
+    fast
+};
+
+#if defined(MATHLIB_FAST_MATH)
+constexpr Policy policy{Policy::fast};
+#else
+constexpr Policy policy{Policy::exact};
+#endif
+
+// the policy of the library functions of T, only float is accurate enough with the approximations
+template <typename T>
+constexpr Policy type_policy{std::is_same<T, float>::value ? policy : Policy::exact};
+
+// true if the library functions of T use the approximations
+template <typename T>
+constexpr bool enabled{type_policy<T> == Policy::fast};
+
+namespace detail
+{
+template <typename V>
+struct scalar_type
+{
+    using type = V;
+};
+
+template <typename T, int width>
+struct scalar_type<Packet<T, width>>
+{
+    using type = T;
+};
+
+// lane-wise mask ? a : b for scalars, Packets use their own select()
+template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+T select(bool mask, T a, T b)
+{
+    return mask ? a : b;
+}
+
+// evaluates c[i] + c[i + 1] x + ... + c[n - 1] x^(n - 1 - i) with Horner's scheme, unrolled at compile time so that
+// loops calling it stay free of control flow and vectorize
+template <int i = 0, typename V, int n>
+V polynomial(const V &x, const double (&c)[n])
+{
+    using T = typename scalar_type<V>::type;
+
+    if constexpr (i == n - 1)
+    {
+        return V{static_cast<T>(c[i])};
+    }
+    else
+    {
+        return polynomial<i + 1>(x, c) * x + V{static_cast<T>(c[i])};
+    }
+}
+
+// x rounded to the nearest integer (ties to even) for |x| < 2^22 (float) or 2^51 (double): adding 1.5 * 2^23 pushes
+// the fraction bits out of the mantissa
+template <typename V>
+V round(const V &x)
+{
+    using T = typename scalar_type<V>::type;
+
+    const V shift{std::is_same<T, float>::value ? T(12582912.0) : T(6755399441055744.0)};
+
+    return (x + shift) - shift;
+}
+
+template <typename T>
+T newtonRsqrt(T x, T y)
+{
+    return y * (T(1.5) - T(0.5) * x * y * y);
+}
+
+// initial estimate of 1 / sqrt(x) with a relative error below 1.8e-3: the rsqrtss instruction or the integer trick with
+// Lomont's constant (see "Fast inverse square root") and one Newton-Raphson step
+inline float rsqrtEstimate(float x)
+{
+#if defined(MATHLIB_SSE2)
+    return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+#else
+    float y;
+    std::uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    bits = 0x5F375A86u - (bits >> 1);
+    std::memcpy(&y, &bits, sizeof(bits));
+
+    return newtonRsqrt(x, y);
+#endif
+}
+
+// the same for double with two Newton-Raphson steps, relative error below 4.7e-6
+inline double rsqrtEstimate(double x)
+{
+    double y;
+    std::uint64_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    bits = 0x5FE6EB50C7B537A9ull - (bits >> 1);
+    std::memcpy(&y, &bits, sizeof(bits));
+
+    return newtonRsqrt(x, newtonRsqrt(x, y));
+}
+
+template <typename T, int width>
+Packet<T, width> rsqrtEstimate(const Packet<T, width> &x)
+{
+    Packet<T, width> res;
+    for (int i{0}; i < width; ++i)
+    {
+        res.set(i, rsqrtEstimate(x[i]));
+    }
+
+    return res;
+}
+
+// 2^n for integral n in [-126, 127] (float) or [-1022, 1023] (double), the biased exponent is written directly
+inline float pow2(float n)
+{
+    const std::uint32_t bits{static_cast<std::uint32_t>(static_cast<std::int32_t>(n) + 127) << 23};
+    float res;
+    std::memcpy(&res, &bits, sizeof(res));
+
+    return res;
+}
+
+inline double pow2(double n)
+{
+    const std::uint64_t bits{static_cast<std::uint64_t>(static_cast<std::int64_t>(n) + 1023) << 52};
+    double res;
+    std::memcpy(&res, &bits, sizeof(res));
+
+    return res;
+}
+
+template <typename T, int width>
+Packet<T, width> pow2(const Packet<T, width> &n)
+{
+    Packet<T, width> res;
+    for (int i{0}; i < width; ++i)
+    {
+        res.set(i, pow2(n[i]));
+    }
+
+    return res;
+}
+
+#if defined(MATHLIB_SSE2)
+// the rsqrtps estimate has a relative error below 1.5 * 2^-12
+inline Packet<float, 4> rsqrtEstimate(const Packet<float, 4> &x) { return Packet<float, 4>{_mm_rsqrt_ps(x.value())}; }
+
+// builds the exponent field directly
+inline __m128 pow2(__m128 n)
+{
+    return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127)), 23));
+}
+
+inline Packet<float, 4> pow2(const Packet<float, 4> &n) { return Packet<float, 4>{pow2(n.value())}; }
+#endif
+
+#if defined(MATHLIB_AVX)
+inline Packet<float, 8> rsqrtEstimate(const Packet<float, 8> &x)
+{
+    return Packet<float, 8>{_mm256_rsqrt_ps(x.value())};
+}
+
+inline Packet<float, 8> pow2(const Packet<float, 8> &n)
+{
+#if defined(MATHLIB_AVX2)
+    const __m256i exponent{_mm256_add_epi32(_mm256_cvtps_epi32(n.value()), _mm256_set1_epi32(127))};
+
+    return Packet<float, 8>{_mm256_castsi256_ps(_mm256_slli_epi32(exponent, 23))};
+#else
+    // AVX has no 256 bit integer shifts
+    const __m256 low{_mm256_castps128_ps256(pow2(_mm256_castps256_ps128(n.value())))};
+
+    return Packet<float, 8>{_mm256_insertf128_ps(low, pow2(_mm256_extractf128_ps(n.value(), 1)), 1)};
+#endif
+}
+#endif
+} // namespace detail
+
+/**
+ * 1 / sqrt(x) for x > 0, an estimate refined with one Newton-Raphson step
+ * maximum relative error 2.6e-7 for float with SSE or AVX (rsqrtss / rsqrtps estimate), 4.7e-6 for float with
+ * MATHLIB_NO_SIMD and 3.3e-11 for double
+ **/
+template <typename V>
+V rsqrt(const V &x)
+{
+    using T = typename detail::scalar_type<V>::type;
+
+    const V y{detail::rsqrtEstimate(x)};
+
+    return y * (V{T(1.5)} - V{T(0.5)} * x * y * y);
+}
+
+/**
+ * sin(x) for x in [-pi / 2, pi / 2], odd minimax polynomial of degree 9
+ * maximum absolute error 3.4e-9
+ **/
+template <typename V>
+V sin(const V &x)
+{
+    static constexpr double coefficients[5]{0.999999976589883,
+                                            -0.1666664763464029,
+                                            0.008332899823360418,
+                                            -0.00019800897763281068,
+                                            2.590488501433902e-06};
+
+    return x * detail::polynomial(x * x, coefficients);
+}
+
+/**
+ * sin(x) and cos(x) for |x| <= 1e4, x is reduced to [-pi / 4, pi / 4] with a three part Cody-Waite reduction, where
+ * minimax polynomials of degree 7 (sin) and 8 (cos) are evaluated, both results share the reduction
+ * maximum absolute error 2.7e-9 (9e-8 when evaluated in float)
+ **/
+template <typename V>
+void sincos(const V &x, V &sin, V &cos)
+{
+    using T = typename detail::scalar_type<V>::type;
+    using detail::select;
+
+    static constexpr double sinCoefficients[4]{1.0, -0.16666654611, 0.0083321608736, -0.00019515295891};
+    static constexpr double cosCoefficients[5]{1.0, -0.5, 0.04166664568298827, -0.001388731625493765,
+                                               2.443315711809948e-05};
+
+    // x = n * pi / 2 + r, the parts of pi / 2 have few enough mantissa bits to make n * part exact
+    const V n{detail::round(x * V{static_cast<T>(M_2_PI)})};
+    const V r{((x - n * V{T(1.5703125)}) - n * V{T(4.837512969970703125e-4)}) - n * V{T(7.54978995489188216e-8)}};
+
+    const V r2{r * r};
+    const V s{r * detail::polynomial(r2, sinCoefficients)};
+    const V c{detail::polynomial(r2, cosCoefficients)};
+
+    // quadrant q = n mod 4 without integer arithmetic, floor(n / 4) = round(n / 4 - 3 / 8) for integral n
+    const V q{n - V{T(4)} * detail::round(n * V{T(0.25)} - V{T(0.375)})};
+    const auto odd = ((q > V{T(0.5)}) & (q < V{T(1.5)})) | (q > V{T(2.5)});
+    const V swappedSin{select(odd, c, s)};
+    const V swappedCos{select(odd, s, c)};
+    sin = select(q > V{T(1.5)}, -swappedSin, swappedSin);
+    cos = select((q > V{T(0.5)}) & (q < V{T(2.5)}), -swappedCos, swappedCos);
+}
+
+/**
+ * e^x, x = n * ln(2) + r with |r| <= ln(2) / 2, e^r is a polynomial of degree 7 and 2^n is written into the exponent
+ * x is clamped to [-87.3, 88.3] for float and [-708, 709] for double, so the result is always a normal number
+ * maximum relative error 1.1e-9 (1e-7 when evaluated in float)
+ **/
+template <typename V>
+V exp(const V &x)
+{
+    using T = typename detail::scalar_type<V>::type;
+    using detail::select;
+
+    static constexpr double coefficients[8]{1.0,
+                                            1.0,
+                                            0.50000001201,
+                                            0.16666665459,
+                                            0.041665795894,
+                                            0.0083334519073,
+                                            0.0013981999507,
+                                            0.00019875691500};
+
+    const V low{std::is_same<T, float>::value ? T(-87.3) : T(-708)};
+    const V high{std::is_same<T, float>::value ? T(88.3) : T(709)};
+    V clamped{select(x < low, low, x)};
+    clamped = select(clamped > high, high, clamped);
+
+    const V n{detail::round(clamped * V{static_cast<T>(M_LOG2E)})};
+    const V r{(clamped - n * V{T(0.693359375)}) + n * V{T(2.121944400546905827679e-4)}};
+
+    return detail::polynomial(r, coefficients) * detail::pow2(n);
+}
+
+/**
+ * acos(x) for x in [-1, 1], sqrt(1 - |x|) times a polynomial of degree 7 in |x| (Abramowitz and Stegun 4.4.46)
+ * maximum absolute error 2.2e-8
+ **/
+template <typename V>
+V acos(const V &x)
+{
+    using std::abs;
+    using std::sqrt;
+    using T = typename detail::scalar_type<V>::type;
+    using detail::select;
+
+    static constexpr double coefficients[8]{1.5707963050,
+                                            -0.2145988016,
+                                            0.0889789874,
+                                            -0.0501743046,
+                                            0.0308918810,
+                                            -0.0170881256,
+                                            0.0066700901,
+                                            -0.0012624911};
+
+    const V absX{abs(x)};
+    const V res{sqrt(V{T{1}} - absX) * detail::polynomial(absX, coefficients)};
+
+    // acos(-x) = pi - acos(x)
+    return select(x < V{T{0}}, V{static_cast<T>(M_PI)} - res, res);
+}
+} // namespace Fast
+} // namespace MathLib
+
+#endif
@@ -0,0 +1,533 @@
+#ifndef MATHLIB_UTIL_PACKET_H
+#define MATHLIB_UTIL_PACKET_H
+
+#include "./simd.h"
+#include "./util.h"
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+
+namespace MathLib
+{
+/**
+ * A Packet holds width values of type T that are processed together (one value per SIMD lane). Comparisons yield a
+ * PacketMask with one flag per lane which can be used to blend packets with select(). The generic versions are plain
+ * loops over the lanes, Packet<float, 4> and Packet<float, 8> are specialized with SSE and AVX intrinsics if the
+ * instruction sets are enabled (see simd.h).
+ **/
+template <typename T, int width>
+class PacketMask
+{
+private:
+    bool m_lanes[width];
+
+public:
+    PacketMask() = default;
+
+    explicit PacketMask(bool val)
+    {
+        for (int i = 0; i < width; ++i)
+        {
+            m_lanes[i] = val;
+        }
+    }
+
+    bool operator[](int lane) const
+    {
+        assert("Accessing out of bounds lane" && lane >= 0 && lane < width);
+
+        return m_lanes[lane];
+    }
+
+    void set(int lane, bool val)
+    {
+        assert("Accessing out of bounds lane" && lane >= 0 && lane < width);
+
+        m_lanes[lane] = val;
+    }
+
+    // bit i is set if lane i is set
+    int bits() const
+    {
+        int res{0};
+        for (int i = 0; i < width; ++i)
+        {
+            res |= m_lanes[i] ? (1 << i) : 0;
+        }
+
+        return res;
+    }
+
+    bool any() const { return bits() != 0; }
+
+    bool all() const { return bits() == (1 << width) - 1; }
+
+    bool none() const { return bits() == 0; }
+
+    friend PacketMask operator&(const PacketMask &m1, const PacketMask &m2)
+    {
+        PacketMask res;
+        for (int i = 0; i < width; ++i)
+        {
+            res.m_lanes[i] = m1.m_lanes[i] && m2.m_lanes[i];
+        }
+
+        return res;
+    }
+
+    friend PacketMask operator|(const PacketMask &m1, const PacketMask &m2)
+    {
+        PacketMask res;
+        for (int i = 0; i < width; ++i)
+        {
+            res.m_lanes[i] = m1.m_lanes[i] || m2.m_lanes[i];
+        }
+
+        return res;
+    }
+
+    friend PacketMask operator!(const PacketMask &mask)
+    {
+        PacketMask res;
+        for (int i = 0; i < width; ++i)
+        {
+            res.m_lanes[i] = !mask.m_lanes[i];
+        }
+
+        return res;
+    }
+};
+
+template <typename T, int width>
+class Packet
+{
+    static_assert(std::is_arithmetic<T>::value, "Packets can only hold arithmetic types");
+
+private:
+    alignas(Util::storage_alignment<T, width>::value) T m_lanes[width];
+
+    template <typename Op>
+    static Packet apply(const Packet &p1, const Packet &p2, Op op)
+    {
+        Packet res;
+        for (int i = 0; i < width; ++i)
+        {
+            res.m_lanes[i] = op(p1.m_lanes[i], p2.m_lanes[i]);
+        }
+
+        return res;
+    }
+
+    template <typename Op>
+    static PacketMask<T, width> compare(const Packet &p1, const Packet &p2, Op op)
+    {
+        PacketMask<T, width> res;
+        for (int i = 0; i < width; ++i)
+        {
+            res.set(i, op(p1.m_lanes[i], p2.m_lanes[i]));
+        }
+
+        return res;
+    }
+
+public:
+    using value_type = T;
+    using mask_type = PacketMask<T, width>;
+
+    Packet() = default;
+
+    // broadcast of a single value into all lanes
+    Packet(T val)
+    {
+        for (int i = 0; i < width; ++i)
+        {
+            m_lanes[i] = val;
+        }
+    }
+
+    static constexpr int size() { return width; }
+
+    // loads width consecutive values
+    static Packet load(const T *data)
+    {
+        Packet res;
+        for (int i = 0; i < width; ++i)
+        {
+            res.m_lanes[i] = data[i];
+        }
+
+        return res;
+    }
+
+    // stores the lanes into width consecutive values
+    void store(T *data) const
+    {
+        for (int i = 0; i < width; ++i)
+        {
+            data[i] = m_lanes[i];
+        }
+    }
+
+    T operator[](int lane) const
+    {
+        assert("Accessing out of bounds lane" && lane >= 0 && lane < width);
+
+        return m_lanes[lane];
+    }
+
+    void set(int lane, T val)
+    {
+        assert("Accessing out of bounds lane" && lane >= 0 && lane < width);
+
+        m_lanes[lane] = val;
+    }
+
+    friend Packet operator+(const Packet &p1, const Packet &p2)
+    {
+        return apply(p1, p2, [](T a, T b) { return a + b; });
+    }
+
+    friend Packet operator-(const Packet &p1, const Packet &p2)
+    {
+        return apply(p1, p2, [](T a, T b) { return a - b; });
+    }
+
+    friend Packet operator*(const Packet &p1, const Packet &p2)
+    {
+        return apply(p1, p2, [](T a, T b) { return a * b; });
+    }
+
+    friend Packet operator/(const Packet &p1, const Packet &p2)
+    {
+        return apply(p1, p2, [](T a, T b) { return a / b; });
+    }
+
+    friend Packet operator-(const Packet &p) { return Packet{0} - p; }
+
+    friend mask_type operator<(const Packet &p1, const Packet &p2)
+    {
+        return compare(p1, p2, [](T a, T b) { return a < b; });
+    }
+
+    friend mask_type operator<=(const Packet &p1, const Packet &p2)
+    {
+        return compare(p1, p2, [](T a, T b) { return a <= b; });
+    }
+
+    friend mask_type operator>(const Packet &p1, const Packet &p2)
+    {
+        return compare(p1, p2, [](T a, T b) { return a > b; });
+    }
+
+    friend mask_type operator>=(const Packet &p1, const Packet &p2)
+    {
+        return compare(p1, p2, [](T a, T b) { return a >= b; });
+    }
+
+    friend Packet min(const Packet &p1, const Packet &p2)
+    {
+        return apply(p1, p2, [](T a, T b) { return b < a ? b : a; });
+    }
+
+    friend Packet max(const Packet &p1, const Packet &p2)
+    {
+        return apply(p1, p2, [](T a, T b) { return a < b ? b : a; });
+    }
+
+    friend Packet sqrt(const Packet &p)
+    {
+        return apply(p, p, [](T a, T) { return static_cast<T>(std::sqrt(a)); });
+    }
+
+    friend Packet abs(const Packet &p)
+    {
+        return apply(p, p, [](T a, T) { return a < 0 ? -a : a; });
+    }
+
+    // lane-wise mask ? p1 : p2
+    friend Packet select(const mask_type &mask, const Packet &p1, const Packet &p2)
+    {
+        Packet res;
+        for (int i = 0; i < width; ++i)
+        {
+            res.m_lanes[i] = mask[i] ? p1.m_lanes[i] : p2.m_lanes[i];
+        }
+
+        return res;
+    }
+};
+
+#if defined(MATHLIB_SSE2)
+template <>
+class PacketMask<float, 4>
+{
+private:
+    __m128 m_value;
+
+public:
+    PacketMask() = default;
+
+    explicit PacketMask(__m128 value) : m_value{value} {}
+
+    explicit PacketMask(bool val) : m_value{_mm_castsi128_ps(_mm_set1_epi32(val ? -1 : 0))} {}
+
+    __m128 value() const { return m_value; }
+
+    bool operator[](int lane) const
+    {
+        assert("Accessing out of bounds lane" && lane >= 0 && lane < 4);
+
+        return (bits() >> lane) & 1;
+    }
+
+    int bits() const { return _mm_movemask_ps(m_value); }
+
+    bool any() const { return bits() != 0; }
+
+    bool all() const { return bits() == 0xF; }
+
+    bool none() const { return bits() == 0; }
+
+    friend PacketMask operator&(const PacketMask &m1, const PacketMask &m2)
+    {
+        return PacketMask{_mm_and_ps(m1.m_value, m2.m_value)};
+    }
+
+    friend PacketMask operator|(const PacketMask &m1, const PacketMask &m2)
+    {
+        return PacketMask{_mm_or_ps(m1.m_value, m2.m_value)};
+    }
+
+    friend PacketMask operator!(const PacketMask &mask)
+    {
+        return PacketMask{_mm_xor_ps(mask.m_value, _mm_castsi128_ps(_mm_set1_epi32(-1)))};
+    }
+};
+
+template <>
+class Packet<float, 4>
+{
+private:
+    __m128 m_value;
+
+public:
+    using value_type = float;
+    using mask_type = PacketMask<float, 4>;
+
+    Packet() = default;
+
+    Packet(float val) : m_value{_mm_set1_ps(val)} {}
+
+    explicit Packet(__m128 value) : m_value{value} {}
+
+    __m128 value() const { return m_value; }
+
+    static constexpr int size() { return 4; }
+
+    static Packet load(const float *data) { return Packet{_mm_loadu_ps(data)}; }
+
+    void store(float *data) const { _mm_storeu_ps(data, m_value); }
+
+    float operator[](int lane) const
+    {
+        assert("Accessing out of bounds lane" && lane >= 0 && lane < 4);
+
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, m_value);
+
+        return lanes[lane];
+    }
+
+    void set(int lane, float val)
+    {
+        assert("Accessing out of bounds lane" && lane >= 0 && lane < 4);
+
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, m_value);
+        lanes[lane] = val;
+        m_value = _mm_load_ps(lanes);
+    }
+
+    friend Packet operator+(const Packet &p1, const Packet &p2) { return Packet{_mm_add_ps(p1.m_value, p2.m_value)}; }
+
+    friend Packet operator-(const Packet &p1, const Packet &p2) { return Packet{_mm_sub_ps(p1.m_value, p2.m_value)}; }
+
+    friend Packet operator*(const Packet &p1, const Packet &p2) { return Packet{_mm_mul_ps(p1.m_value, p2.m_value)}; }
+
+    friend Packet operator/(const Packet &p1, const Packet &p2) { return Packet{_mm_div_ps(p1.m_value, p2.m_value)}; }
+
+    friend Packet operator-(const Packet &p) { return Packet{_mm_xor_ps(p.m_value, _mm_set1_ps(-0.0f))}; }
+
+    friend mask_type operator<(const Packet &p1, const Packet &p2)
+    {
+        return mask_type{_mm_cmplt_ps(p1.m_value, p2.m_value)};
+    }
+
+    friend mask_type operator<=(const Packet &p1, const Packet &p2)
+    {
+        return mask_type{_mm_cmple_ps(p1.m_value, p2.m_value)};
+    }
+
+    friend mask_type operator>(const Packet &p1, const Packet &p2)
+    {
+        return mask_type{_mm_cmpgt_ps(p1.m_value, p2.m_value)};
+    }
+
+    friend mask_type operator>=(const Packet &p1, const Packet &p2)
+    {
+        return mask_type{_mm_cmpge_ps(p1.m_value, p2.m_value)};
+    }
+
+    friend Packet min(const Packet &p1, const Packet &p2) { return Packet{_mm_min_ps(p1.m_value, p2.m_value)}; }
+
+    friend Packet max(const Packet &p1, const Packet &p2) { return Packet{_mm_max_ps(p1.m_value, p2.m_value)}; }
+
+    friend Packet sqrt(const Packet &p) { return Packet{_mm_sqrt_ps(p.m_value)}; }
+
+    friend Packet abs(const Packet &p) { return Packet{_mm_andnot_ps(_mm_set1_ps(-0.0f), p.m_value)}; }
+
+    friend Packet select(const mask_type &mask, const Packet &p1, const Packet &p2)
+    {
+        return Packet{_mm_or_ps(_mm_and_ps(mask.value(), p1.m_value), _mm_andnot_ps(mask.value(), p2.m_value))};
+    }
+};
+#endif
+
+#if defined(MATHLIB_AVX)
+template <>
+class PacketMask<float, 8>
+{
+private:
+    __m256 m_value;
+
+public:
+    PacketMask() = default;
+
+    explicit PacketMask(__m256 value) : m_value{value} {}
+
+    explicit PacketMask(bool val) : m_value{_mm256_castsi256_ps(_mm256_set1_epi32(val ? -1 : 0))} {}
+
+    __m256 value() const { return m_value; }
+
+    bool operator[](int lane) const
+    {
+        assert("Accessing out of bounds lane" && lane >= 0 && lane < 8);
+
+        return (bits() >> lane) & 1;
+    }
+
+    int bits() const { return _mm256_movemask_ps(m_value); }
+
+    bool any() const { return bits() != 0; }
+
+    bool all() const { return bits() == 0xFF; }
+
+    bool none() const { return bits() == 0; }
+
+    friend PacketMask operator&(const PacketMask &m1, const PacketMask &m2)
+    {
+        return PacketMask{_mm256_and_ps(m1.m_value, m2.m_value)};
+    }
+
+    friend PacketMask operator|(const PacketMask &m1, const PacketMask &m2)
+    {
+        return PacketMask{_mm256_or_ps(m1.m_value, m2.m_value)};
+    }
+
+    friend PacketMask operator!(const PacketMask &mask)
+    {
+        return PacketMask{_mm256_xor_ps(mask.m_value, _mm256_castsi256_ps(_mm256_set1_epi32(-1)))};
+    }
+};
+
+template <>
+class Packet<float, 8>
+{
+private:
+    __m256 m_value;
+
+public:
+    using value_type = float;
+    using mask_type = PacketMask<float, 8>;
+
+    Packet() = default;
+
+    Packet(float val) : m_value{_mm256_set1_ps(val)} {}
+
+    explicit Packet(__m256 value) : m_value{value} {}
+
+    __m256 value() const { return m_value; }
+
+    static constexpr int size() { return 8; }
+
+    static Packet load(const float *data) { return Packet{_mm256_loadu_ps(data)}; }
+
+    void store(float *data) const { _mm256_storeu_ps(data, m_value); }
+
+    float operator[](int lane) const
+    {
+        assert("Accessing out of bounds lane" && lane >= 0 && lane < 8);
+
+        alignas(32) float lanes[8];
+        _mm256_store_ps(lanes, m_value);
+
+        return lanes[lane];
+    }
+
+    void set(int lane, float val)
+    {
+        assert("Accessing out of bounds lane" && lane >= 0 && lane < 8);
+
+        alignas(32) float lanes[8];
+        _mm256_store_ps(lanes, m_value);
+        lanes[lane] = val;
+        m_value = _mm256_load_ps(lanes);
+    }
+
+    friend Packet operator+(const Packet &p1, const Packet &p2) { return Packet{_mm256_add_ps(p1.m_value, p2.m_value)}; }
+
+    friend Packet operator-(const Packet &p1, const Packet &p2) { return Packet{_mm256_sub_ps(p1.m_value, p2.m_value)}; }
+
+    friend Packet operator*(const Packet &p1, const Packet &p2) { return Packet{_mm256_mul_ps(p1.m_value, p2.m_value)}; }
+
+    friend Packet operator/(const Packet &p1, const Packet &p2) { return Packet{_mm256_div_ps(p1.m_value, p2.m_value)}; }
+
+    friend Packet operator-(const Packet &p) { return Packet{_mm256_xor_ps(p.m_value, _mm256_set1_ps(-0.0f))}; }
+
+    friend mask_type operator<(const Packet &p1, const Packet &p2)
+    {
+        return mask_type{_mm256_cmp_ps(p1.m_value, p2.m_value, _CMP_LT_OQ)};
+    }
+
+    friend mask_type operator<=(const Packet &p1, const Packet &p2)
+    {
+        return mask_type{_mm256_cmp_ps(p1.m_value, p2.m_value, _CMP_LE_OQ)};
+    }
+
+    friend mask_type operator>(const Packet &p1, const Packet &p2)
+    {
+        return mask_type{_mm256_cmp_ps(p1.m_value, p2.m_value, _CMP_GT_OQ)};
+    }
+
+    friend mask_type operator>=(const Packet &p1, const Packet &p2)
+    {
+        return mask_type{_mm256_cmp_ps(p1.m_value, p2.m_value, _CMP_GE_OQ)};
+    }
+
+    friend Packet min(const Packet &p1, const Packet &p2) { return Packet{_mm256_min_ps(p1.m_value, p2.m_value)}; }
+
+    friend Packet max(const Packet &p1, const Packet &p2) { return Packet{_mm256_max_ps(p1.m_value, p2.m_value)}; }
+
+    friend Packet sqrt(const Packet &p) { return Packet{_mm256_sqrt_ps(p.m_value)}; }
+
+    friend Packet abs(const Packet &p) { return Packet{_mm256_andnot_ps(_mm256_set1_ps(-0.0f), p.m_value)}; }
+
+    friend Packet select(const mask_type &mask, const Packet &p1, const Packet &p2)
+    {
+        return Packet{_mm256_blendv_ps(p2.m_value, p1.m_value, mask.value())};
+    }
+};
+#endif
+} // namespace MathLib
+
+#endif
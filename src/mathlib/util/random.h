@@ -0,0 +1,193 @@
+#ifndef MATHLIB_UTIL_RANDOM_H
+#define MATHLIB_UTIL_RANDOM_H
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+namespace MathLib
+{
+namespace Util
+{
+/**
+ * PCG32 (XSH-RR variant) random number generator by Melissa O'Neill: https://www.pcg-random.org
+ * 64 bits of state, 32 bit output and 2^63 independent streams selected by the second seed parameter.
+ * Satisfies UniformRandomBitGenerator, so it can also be used with the distributions from <random>.
+ **/
+class Pcg32
+{
+private:
+    std::uint64_t m_state{0};
+    std::uint64_t m_increment{0};
+
+public:
+    using result_type = std::uint32_t;
+
+    static constexpr std::uint64_t default_seed{0x853c49e6748fea9bULL};
+    static constexpr std::uint64_t default_stream{0xda3e39cb94b95bdbULL};
+
+    constexpr Pcg32() : Pcg32{default_seed, default_stream} {}
+
+    constexpr explicit Pcg32(std::uint64_t seed, std::uint64_t stream = default_stream) { this->seed(seed, stream); }
+
+    constexpr void seed(std::uint64_t seed, std::uint64_t stream)
+    {
+        m_state = 0;
+        m_increment = (stream << 1) | 1;
+        (*this)();
+        m_state += seed;
+        (*this)();
+    }
+
+    // reseeds the generator but keeps its stream
+    constexpr void seed(std::uint64_t seed) { this->seed(seed, m_increment >> 1); }
+
+    static constexpr result_type min() { return 0; }
+
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    constexpr result_type operator()()
+    {
+        const std::uint64_t oldState{m_state};
+        m_state = oldState * 6364136223846793005ULL + m_increment;
+
+        const std::uint32_t xorShifted = static_cast<std::uint32_t>(((oldState >> 18) ^ oldState) >> 27);
+        const std::uint32_t rotation = static_cast<std::uint32_t>(oldState >> 59);
+
+        return (xorShifted >> rotation) | (xorShifted << ((~rotation + 1) & 31));
+    }
+
+    // skips the next count numbers
+    constexpr void discard(std::uint64_t count)
+    {
+        for (std::uint64_t i{0}; i < count; ++i)
+        {
+            (*this)();
+        }
+    }
+
+    friend constexpr bool operator==(const Pcg32 &a, const Pcg32 &b)
+    {
+        return a.m_state == b.m_state && a.m_increment == b.m_increment;
+    }
+
+    friend constexpr bool operator!=(const Pcg32 &a, const Pcg32 &b) { return !(a == b); }
+};
+
+namespace detail
+{
+// stream handed to the engine of the next thread that draws a random number
+inline std::atomic<std::uint64_t> &nextThreadStream()
+{
+    static std::atomic<std::uint64_t> stream{Pcg32::default_stream};
+    return stream;
+}
+} // namespace detail
+
+/**
+ * The engine used by the random number functions that do not take an engine. Every thread has its own engine (so
+ * there is no shared state between threads), all of them start with the same seed but use different streams.
+ **/
+inline Pcg32 &threadEngine()
+{
+    thread_local Pcg32 engine{Pcg32::default_seed, detail::nextThreadStream().fetch_add(1)};
+    return engine;
+}
+
+// reseeds the engine of the calling thread, its sequence of random numbers is reproducible afterwards
+inline void seedRandom(std::uint64_t seed) { threadEngine().seed(seed); }
+
+/**
+ * returns a random floating point number in [0, 1) drawn from the given engine
+ * the 32 bit output of Pcg32 is turned into a float (24 bits) or double (53 bits from two outputs) directly, other
+ * engines go through std::uniform_real_distribution
+ **/
+template <
+    typename T,
+    typename Engine,
+    typename = typename std::enable_if<std::is_floating_point<T>::value && !std::is_arithmetic<Engine>::value>::type>
+T random_number(Engine &engine)
+{
+    if constexpr (std::is_same<Engine, Pcg32>::value && std::is_same<T, float>::value)
+    {
+        return static_cast<float>(engine() >> 8) * 0x1.0p-24f;
+    }
+    else if constexpr (std::is_same<Engine, Pcg32>::value && std::is_same<T, double>::value)
+    {
+        const std::uint64_t high{engine()};
+        const std::uint64_t low{engine()};
+        return static_cast<double>(((high << 32) | low) >> 11) * 0x1.0p-53;
+    }
+    else
+    {
+        return std::uniform_real_distribution<T>{0, 1}(engine);
+    }
+}
+
+// returns a random floating point number in [min, max) drawn from the given engine
+template <
+    typename T,
+    typename Engine,
+    typename = typename std::enable_if<std::is_floating_point<T>::value && !std::is_arithmetic<Engine>::value>::type>
+T random_number(T min, T max, Engine &engine)
+{
+    // min + (max - min) * u rounds up to max for u close to 1 (e.g. in float for [1, 2)), the result is clamped to the
+    // largest value below max
+    const T value{min + (max - min) * random_number<T>(engine)};
+    const T last{std::nextafter(max, min)};
+
+    return value < last ? value : last;
+}
+
+// returns a random floating point number in [0, 1) drawn from the engine of the calling thread
+template <typename T>
+T random_number()
+{
+    return random_number<T>(threadEngine());
+}
+
+// returns a random floating point number in [min, max) drawn from the engine of the calling thread
+template <typename T>
+T random_number(T min, T max)
+{
+    return random_number<T>(min, max, threadEngine());
+}
+
+// fills count elements starting at out with random numbers in [min, max), e.g. to generate the samples for a batch
+template <typename T, typename Engine>
+void fillRandom(T *out, std::size_t count, T min, T max, Engine &engine)
+{
+    const T range{max - min};
+    const T last{std::nextafter(max, min)};
+    for (std::size_t i{0}; i < count; ++i)
+    {
+        const T value{min + range * random_number<T>(engine)};
+        out[i] = value < last ? value : last;
+    }
+}
+
+template <typename T, typename Engine>
+void fillRandom(T *out, std::size_t count, Engine &engine)
+{
+    fillRandom(out, count, T{0}, T{1}, engine);
+}
+
+template <typename T>
+void fillRandom(T *out, std::size_t count, T min, T max)
+{
+    fillRandom(out, count, min, max, threadEngine());
+}
+
+template <typename T>
+void fillRandom(T *out, std::size_t count)
+{
+    fillRandom(out, count, T{0}, T{1}, threadEngine());
+}
+} // namespace Util
+} // namespace MathLib
+
+#endif
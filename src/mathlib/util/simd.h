@@ -0,0 +1,31 @@
+#ifndef MATHLIB_UTIL_SIMD_H
+#define MATHLIB_UTIL_SIMD_H
+
+// Detection of the SIMD instruction sets the compiler is allowed to use. The kernels built on top of these macros
+// are selected at compile time, so the instruction sets have to be enabled with compiler flags (e.g. -mavx2 -mfma or
+// -march=native). Define MATHLIB_NO_SIMD to always use the portable scalar code.
+#if !defined(MATHLIB_NO_SIMD)
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATHLIB_SSE2 1
+#endif
+
+#if defined(__AVX__)
+#define MATHLIB_AVX 1
+#endif
+
+#if defined(__AVX2__)
+#define MATHLIB_AVX2 1
+#endif
+
+#if defined(__FMA__)
+#define MATHLIB_FMA 1
+#endif
+
+#endif
+
+#if defined(MATHLIB_SSE2)
+#include <immintrin.h>
+#endif
+
+#endif
@@ -0,0 +1,383 @@
+#ifndef MATHLIB_UTIL_THREAD_POOL_H
+#define MATHLIB_UTIL_THREAD_POOL_H
+
+#include <algorithm>
+#include <cstddef>
+
+#if !defined(MATHLIB_NO_THREADS)
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+namespace MathLib
+{
+namespace Util
+{
+// The big batch operations (matrix products, point transforms, element-wise array operations) split their work into
+// blocks with parallelFor, which runs them on a global pool of threads. The number of threads defaults to the value
+// of the environment variable MATHLIB_THREADS or the number of hardware threads and can be changed at runtime with
+// setThreadCount. Defining MATHLIB_NO_THREADS removes the pool, everything then runs on the calling thread.
+
+#if !defined(MATHLIB_NO_THREADS)
+/**
+ * Work stealing thread pool: every worker has its own queue of tasks, it takes tasks from the back of its queue and
+ * when that is empty steals from the front of the queues of the other workers. A thread waiting in parallelFor helps
+ * with the queued tasks, which makes nested parallelFor calls (from inside a task) safe.
+ **/
+class ThreadPool
+{
+private:
+    // the blocks of one parallelFor call
+    struct TaskGroup
+    {
+        std::atomic<std::size_t> remaining{0};
+        std::mutex mutex;
+        std::condition_variable done;
+        std::exception_ptr exception;
+    };
+
+    struct Task
+    {
+        void (*run)(const void *body, std::size_t begin, std::size_t end);
+        const void *body;
+        std::size_t begin;
+        std::size_t end;
+        TaskGroup *group;
+    };
+
+    struct WorkQueue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    // blocks per thread, more than one so that threads which finish early can steal from the others
+    static constexpr std::size_t blocks_per_thread{4};
+
+    std::vector<std::unique_ptr<WorkQueue>> m_queues;
+    std::vector<std::thread> m_workers;
+    // number of tasks in all queues, only changed while holding the lock of the queue
+    std::atomic<std::size_t> m_queued{0};
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+    bool m_stop{false};
+
+    // the pool a worker thread belongs to and the index of its queue, nullptr for all other threads
+    static inline thread_local ThreadPool *t_pool{nullptr};
+    static inline thread_local std::size_t t_queue{0};
+
+public:
+    // threadCount includes the thread calling parallelFor, so threadCount - 1 workers are started
+    explicit ThreadPool(std::size_t threadCount)
+    {
+        const std::size_t workers{threadCount > 1 ? threadCount - 1 : 0};
+        m_queues.reserve(workers);
+        for (std::size_t i{0}; i < workers; ++i)
+        {
+            m_queues.push_back(std::make_unique<WorkQueue>());
+        }
+
+        m_workers.reserve(workers);
+        for (std::size_t i{0}; i < workers; ++i)
+        {
+            m_workers.emplace_back([this, i] { work(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool &other) = delete;
+    ThreadPool &operator=(const ThreadPool &other) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock{m_wakeMutex};
+            m_stop = true;
+        }
+        m_wake.notify_all();
+
+        for (std::thread &worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    std::size_t threadCount() const { return m_workers.size() + 1; }
+
+    /**
+     * Calls body(blockBegin, blockEnd) for blocks which cover [begin, end) and returns after all of them finished.
+     * Blocks hold at least grain indices (except for the last one), ranges with at most grain indices run directly on
+     * the calling thread. The first exception thrown by body is rethrown after all blocks finished.
+     **/
+    template <typename Body>
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, const Body &body)
+    {
+        if (end <= begin)
+        {
+            return;
+        }
+
+        const std::size_t count{end - begin};
+        grain = std::max(grain, std::size_t{1});
+        const std::size_t blocks{std::min((count + grain - 1) / grain, threadCount() * blocks_per_thread)};
+        if (blocks <= 1 || m_workers.empty())
+        {
+            body(begin, end);
+            return;
+        }
+
+        const std::size_t blockSize{(count + blocks - 1) / blocks};
+        TaskGroup group;
+        group.remaining.store((count + blockSize - 1) / blockSize, std::memory_order_relaxed);
+
+        // the workers of this pool queue their blocks locally (the others steal them), other threads distribute them
+        const bool isWorker{t_pool == this};
+        std::size_t index{0};
+        for (std::size_t blockBegin{begin}; blockBegin < end; blockBegin += blockSize, ++index)
+        {
+            push(isWorker ? t_queue : index % m_queues.size(),
+                 Task{&invoke<Body>, &body, blockBegin, std::min(end, blockBegin + blockSize), &group});
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{m_wakeMutex};
+        }
+        m_wake.notify_all();
+
+        wait(group);
+
+        if (group.exception)
+        {
+            std::rethrow_exception(group.exception);
+        }
+    }
+
+private:
+    template <typename Body>
+    static void invoke(const void *body, std::size_t begin, std::size_t end)
+    {
+        (*static_cast<const Body *>(body))(begin, end);
+    }
+
+    void push(std::size_t queue, const Task &task)
+    {
+        std::lock_guard<std::mutex> lock{m_queues[queue]->mutex};
+        m_queues[queue]->tasks.push_back(task);
+        m_queued.fetch_add(1, std::memory_order_release);
+    }
+
+    // takes a task from the back of the own queue (if the calling thread is a worker) or from the front of another one
+    bool tryPop(Task &task)
+    {
+        if (m_queued.load(std::memory_order_acquire) == 0)
+        {
+            return false;
+        }
+
+        const bool isWorker{t_pool == this};
+        const std::size_t own{isWorker ? t_queue : 0};
+        for (std::size_t i{0}; i < m_queues.size(); ++i)
+        {
+            const std::size_t index{(own + i) % m_queues.size()};
+            const bool back{isWorker && i == 0};
+
+            WorkQueue &queue{*m_queues[index]};
+            std::lock_guard<std::mutex> lock{queue.mutex};
+            if (!queue.tasks.empty())
+            {
+                task = back ? queue.tasks.back() : queue.tasks.front();
+                if (back)
+                {
+                    queue.tasks.pop_back();
+                }
+                else
+                {
+                    queue.tasks.pop_front();
+                }
+                m_queued.fetch_sub(1, std::memory_order_relaxed);
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void execute(const Task &task)
+    {
+        std::exception_ptr exception;
+        try
+        {
+            task.run(task.body, task.begin, task.end);
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        // the waiting thread only returns after acquiring the lock, so the group stays alive until it is released
+        TaskGroup &group{*task.group};
+        std::lock_guard<std::mutex> lock{group.mutex};
+        if (exception && !group.exception)
+        {
+            group.exception = exception;
+        }
+        if (group.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            group.done.notify_all();
+        }
+    }
+
+    void wait(TaskGroup &group)
+    {
+        // help with queued tasks (of any group) while there are some, then sleep until the running ones finished
+        Task task;
+        while (group.remaining.load(std::memory_order_acquire) != 0 && tryPop(task))
+        {
+            execute(task);
+        }
+
+        std::unique_lock<std::mutex> lock{group.mutex};
+        group.done.wait(lock, [&group] { return group.remaining.load(std::memory_order_acquire) == 0; });
+    }
+
+    void work(std::size_t queue)
+    {
+        t_pool = this;
+        t_queue = queue;
+
+        for (;;)
+        {
+            Task task;
+            if (tryPop(task))
+            {
+                execute(task);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock{m_wakeMutex};
+            m_wake.wait(lock, [this] { return m_stop || m_queued.load(std::memory_order_acquire) != 0; });
+            if (m_stop)
+            {
+                return;
+            }
+        }
+    }
+};
+
+namespace detail
+{
+inline std::size_t defaultThreadCount()
+{
+    if (const char *variable = std::getenv("MATHLIB_THREADS"))
+    {
+        const long count{std::strtol(variable, nullptr, 10)};
+        if (count > 0)
+        {
+            return static_cast<std::size_t>(count);
+        }
+    }
+
+    const unsigned int hardwareThreads{std::thread::hardware_concurrency()};
+    return hardwareThreads ? hardwareThreads : 1;
+}
+
+struct GlobalThreadPool
+{
+    std::mutex mutex;
+    std::size_t threadCount{defaultThreadCount()};
+    // started with the first parallelFor call that actually runs in parallel
+    std::unique_ptr<ThreadPool> pool;
+};
+
+inline GlobalThreadPool &globalThreadPool()
+{
+    static GlobalThreadPool global{};
+    return global;
+}
+} // namespace detail
+
+// number of threads (including the calling one) the batch operations use
+inline std::size_t threadCount()
+{
+    detail::GlobalThreadPool &global{detail::globalThreadPool()};
+    std::lock_guard<std::mutex> lock{global.mutex};
+
+    return global.threadCount;
+}
+
+/**
+ * Sets the number of threads the batch operations use, 1 runs everything on the calling thread and 0 restores the
+ * default. Must not be called while other threads use the pool.
+ **/
+inline void setThreadCount(std::size_t count)
+{
+    detail::GlobalThreadPool &global{detail::globalThreadPool()};
+    std::lock_guard<std::mutex> lock{global.mutex};
+
+    global.threadCount = count ? count : detail::defaultThreadCount();
+    if (global.pool && global.pool->threadCount() != global.threadCount)
+    {
+        global.pool.reset();
+    }
+}
+
+// ThreadPool::parallelFor on the global pool
+template <typename Body>
+void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, const Body &body)
+{
+    if (end <= begin)
+    {
+        return;
+    }
+
+    if (end - begin <= grain)
+    {
+        body(begin, end);
+        return;
+    }
+
+    detail::GlobalThreadPool &global{detail::globalThreadPool()};
+    ThreadPool *pool{nullptr};
+    {
+        std::lock_guard<std::mutex> lock{global.mutex};
+        if (global.threadCount > 1 && !global.pool)
+        {
+            global.pool = std::make_unique<ThreadPool>(global.threadCount);
+        }
+        pool = global.pool.get();
+    }
+
+    if (pool)
+    {
+        pool->parallelFor(begin, end, grain, body);
+    }
+    else
+    {
+        body(begin, end);
+    }
+}
+#else
+inline std::size_t threadCount() { return 1; }
+
+inline void setThreadCount(std::size_t) {}
+
+template <typename Body>
+void parallelFor(std::size_t begin, std::size_t end, std::size_t, const Body &body)
+{
+    if (begin < end)
+    {
+        body(begin, end);
+    }
+}
+#endif
+} // namespace Util
+} // namespace MathLib
+
+#endif
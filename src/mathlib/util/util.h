@@ -1,9 +1,10 @@
 #ifndef MATHLIB_UTIL_UTIL_H
 #define MATHLIB_UTIL_UTIL_H
 
+#include "./random.h"
+#include <cstddef>
 #include <limits>
 #include <math.h>
-#include <random>
 #include <type_traits>
 
 namespace MathLib
@@ -28,14 +29,27 @@ bool isClose(T a, T b, T maxDiff = std::numeric_limits<T>::epsilon(), T maxRelDi
     return diff <= (largest * maxRelDiff);
 }
 
+// alignment used for the inline element storage of Matrix, Vector and Point
+// blocks whose size is a power of two (e.g. float[4], double[4], float[16]) are aligned to their size (capped at 32
+// bytes) to allow aligned SIMD loads, all other sizes keep the natural alignment of T so that e.g. an array of
+// Vector<float, 3> stays a tightly packed array of floats
+template <typename T, int numElements>
+struct storage_alignment
+    : std::integral_constant<std::size_t,
+                             ((sizeof(T) * numElements) & (sizeof(T) * numElements - 1)) == 0
+                                 ? ((sizeof(T) * numElements) < 32 ? (sizeof(T) * numElements) : 32)
+                                 : alignof(T)>
+{
+};
+
 template <typename T>
-T degToRad(T deg)
+constexpr T degToRad(T deg)
 {
     return (deg * M_PI) / 180;
 }
 
 template <typename T>
-T radToDeg(T rad)
+constexpr T radToDeg(T rad)
 {
     return (rad * 180) / M_PI;
 }
@@ -49,25 +63,6 @@ T clamp(double x, double min, double max)
         return max;
     return x;
 }
-
-// Code from Ray Tracing in One Weekend, made into templates to support float as well as double:
-// https://raytracing.github.io/books/RayTracingInOneWeekend.html
-
-// returns a random floating point number in [0, 1)
-template <typename T>
-T random_number()
-{
-    static std::uniform_real_distribution<T> distribution(0, 1);
-    static std::mt19937 generator;
-    return distribution(generator);
-}
-
-// returns a random floating point number in [min, max)
-template <typename T>
-T random_number(T min, T max)
-{
-    return min + (max - min) * random_number<T>();
-}
 } // namespace Util
 } // namespace MathLib
 
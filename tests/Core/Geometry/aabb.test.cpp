@@ -0,0 +1,66 @@
+#include <Core/Geometry/aabb.h>
+#include <Core/Geometry/ray.h>
+#include <gtest/gtest.h>
+#include <limits>
+
+using namespace MathLib;
+
+TEST(AABB_TEST, bounds)
+{
+    AABB<float, 3> box;
+    EXPECT_TRUE(box.isEmpty());
+    EXPECT_EQ(box.surfaceArea(), 0);
+
+    box.extend(Point<float, 3>{ 1, 2, 3 }).extend(Point<float, 3>{ -1, 4, 3 });
+    EXPECT_FALSE(box.isEmpty());
+    EXPECT_EQ(box.min(), (Point<float, 3>{ -1, 2, 3 }));
+    EXPECT_EQ(box.max(), (Point<float, 3>{ 1, 4, 3 }));
+    EXPECT_EQ(box.center(), (Point<float, 3>{ 0, 3, 3 }));
+    EXPECT_EQ(box.largestAxis(), 0);
+    EXPECT_EQ(box.surfaceArea(), 8);
+
+    const AABB<float, 3> other{ Point<float, 3>{ 0, 0, 0 }, Point<float, 3>{ 0.5, 10, 0.5 } };
+    EXPECT_FALSE(box.overlaps(other));
+    const AABB<float, 3> merged{ merge(box, other) };
+    EXPECT_EQ(merged, (AABB<float, 3>{ Point<float, 3>{ -1, 0, 0 }, Point<float, 3>{ 1, 10, 3 } }));
+    EXPECT_EQ(merged.largestAxis(), 1);
+    EXPECT_TRUE(merged.contains(Point<float, 3>{ 0.25, 5, 1 }));
+    EXPECT_FALSE(merged.contains(Point<float, 3>{ 0.25, 5, 4 }));
+    EXPECT_TRUE(merged.overlaps(box));
+
+    // any dimension
+    AABB<int, 2> rect{ Point<int, 2>{ 0, 0 } };
+    rect.extend(Point<int, 2>{ 3, -2 });
+    EXPECT_EQ(rect.diagonal(), (Vector<int, 2>{ 3, 2 }));
+}
+
+TEST(AABB_TEST, ray_intersection)
+{
+    const AABB<float, 3> box{ Point<float, 3>{ -1, -1, -1 }, Point<float, 3>{ 1, 1, 1 } };
+    const float inf{ std::numeric_limits<float>::infinity() };
+
+    const Ray<float> ray{ Point<float, 3>{ -5, 0.5, 0 }, Vector<float, 3>{ 2, 0, 0 } };
+    EXPECT_EQ(ray.inverseDirection()(0), 0.5);
+    EXPECT_EQ(ray(1), (Point<float, 3>{ -3, 0.5, 0 }));
+
+    float tEnter;
+    EXPECT_TRUE(intersect(ray, box, 0.0f, inf, tEnter));
+    EXPECT_FLOAT_EQ(tEnter, 2);
+    // the box lies behind or beyond the interval
+    EXPECT_FALSE(intersect(ray, box, 0.0f, 1.9f));
+    EXPECT_FALSE(intersect(ray, box, 3.1f, inf));
+
+    // inside the box the ray enters at tMin
+    const Ray<float> inside{ Point<float, 3>{ 0, 0, 0 }, Vector<float, 3>{ -1, -1, 0 } };
+    EXPECT_TRUE(intersect(inside, box, 0.0f, inf, tEnter));
+    EXPECT_EQ(tEnter, 0);
+
+    const Ray<float> miss{ Point<float, 3>{ -5, 1.5, 0 }, Vector<float, 3>{ 1, 0, 0 } };
+    EXPECT_FALSE(intersect(miss, box, 0.0f, inf));
+
+    // rays in the plane of a face (0 * infinity) still hit, for both signs of zero
+    const Ray<float> alongFace{ Point<float, 3>{ -5, 1, 0 }, Vector<float, 3>{ 1, 0, 0 } };
+    EXPECT_TRUE(intersect(alongFace, box, 0.0f, inf));
+    const Ray<float> alongFaceNegative{ Point<float, 3>{ -5, 1, 0 }, Vector<float, 3>{ 1, -0.0f, 0 } };
+    EXPECT_TRUE(intersect(alongFaceNegative, box, 0.0f, inf));
+}
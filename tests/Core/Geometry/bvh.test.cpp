@@ -0,0 +1,224 @@
+#include <Core/Geometry/bvh.h>
+#include <Core/Matrix/matrix.h>
+#include <Core/Matrix/transform.h>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <limits>
+#include <util/random.h>
+#include <util/threadPool.h>
+#include <vector>
+
+using namespace MathLib;
+
+namespace
+{
+std::vector<Triangle<float>> randomTriangles(std::size_t count, Util::Pcg32 &engine)
+{
+    std::vector<Triangle<float>> triangles(count);
+    for (Triangle<float> &triangle : triangles)
+    {
+        const Point<float, 3> center{ Util::random_number(-10.0f, 10.0f, engine),
+                                      Util::random_number(-10.0f, 10.0f, engine),
+                                      Util::random_number(-10.0f, 10.0f, engine) };
+        Point<float, 3> vertices[3];
+        for (Point<float, 3> &vertex : vertices)
+        {
+            vertex = center + Vector<float, 3>{ Util::random_number(-1.5f, 1.5f, engine),
+                                                Util::random_number(-1.5f, 1.5f, engine),
+                                                Util::random_number(-1.5f, 1.5f, engine) };
+        }
+        triangle = Triangle<float>{ vertices[0], vertices[1], vertices[2] };
+    }
+
+    return triangles;
+}
+
+// every primitive is referenced by exactly one leaf whose bounds (and the ones of all ancestors) contain it
+template <int width>
+void checkStructure(const BVH<float, width> &bvh, const std::vector<Triangle<float>> &triangles)
+{
+    std::vector<int> references(triangles.size(), 0);
+    std::vector<std::uint32_t> stack{ 0 };
+    while (!stack.empty())
+    {
+        const auto &node = bvh.nodes()[stack.back()];
+        stack.pop_back();
+        for (int i{0}; i < width; ++i)
+        {
+            if (node.count[i] == 0)
+            {
+                if (!node.bounds.get(i).isEmpty())
+                {
+                    stack.push_back(node.child[i]);
+                }
+                continue;
+            }
+
+            for (std::uint32_t j{node.child[i]}; j < node.child[i] + node.count[i]; ++j)
+            {
+                const std::uint32_t primitive{ bvh.primitives()[j] };
+                ++references[primitive];
+                const AABB<float, 3> bounds{ triangles[primitive].bounds() };
+                EXPECT_EQ(merge(node.bounds.get(i), bounds), node.bounds.get(i));
+            }
+        }
+    }
+
+    EXPECT_TRUE(std::all_of(references.begin(), references.end(), [](int count) { return count == 1; }));
+}
+
+template <int width>
+void expectBruteForceResults(const BVH<float, width> &bvh,
+                             const std::vector<Triangle<float>> &triangles,
+                             Util::Pcg32 &engine,
+                             int minHits)
+{
+    const float inf{ std::numeric_limits<float>::infinity() };
+    int hits{ 0 };
+    for (int i{0}; i < 200; ++i)
+    {
+        const Ray<float> ray{ Point<float, 3>{ Util::random_number(-12.0f, 12.0f, engine),
+                                               Util::random_number(-12.0f, 12.0f, engine),
+                                               -15 },
+                              Vector<float, 3>{ Util::random_number(-0.3f, 0.3f, engine),
+                                                Util::random_number(-0.3f, 0.3f, engine),
+                                                1 } };
+
+        std::uint32_t expected{ BVH<float, width>::no_hit };
+        float closest{ inf };
+        for (std::size_t j{0}; j < triangles.size(); ++j)
+        {
+            TriangleHit<float> hit;
+            if (intersect(ray, triangles[j], 0.0f, closest, hit))
+            {
+                expected = static_cast<std::uint32_t>(j);
+                closest = hit.t;
+            }
+        }
+
+        TriangleHit<float> hit;
+        const std::uint32_t found{ intersectClosest(bvh, triangles.data(), ray, 0.0f, inf, hit) };
+        EXPECT_EQ(found, expected);
+        const bool anyExpected{ expected != BVH<float, width>::no_hit };
+        EXPECT_EQ(intersectAny(bvh, triangles.data(), ray, 0.0f, inf), anyExpected);
+        if (found != BVH<float, width>::no_hit)
+        {
+            EXPECT_EQ(hit.t, closest);
+            // nothing in front of the closest hit
+            EXPECT_FALSE(intersectAny(bvh, triangles.data(), ray, 0.0f, 0.999f * closest));
+            ++hits;
+        }
+    }
+    EXPECT_GE(hits, minHits);
+}
+
+template <int width>
+void compareWithBruteForce(std::size_t count, int minHits)
+{
+    Util::Pcg32 engine{ 7 };
+    const std::vector<Triangle<float>> triangles{ randomTriangles(count, engine) };
+    const BVH<float, width> bvh{ triangles.data(), triangles.size() };
+    checkStructure(bvh, triangles);
+    expectBruteForceResults(bvh, triangles, engine, minHits);
+}
+} // namespace
+
+TEST(BVH_TEST, closest_and_any_hit)
+{
+    compareWithBruteForce<4>(1000, 50);
+    compareWithBruteForce<8>(1000, 50);
+    compareWithBruteForce<2>(3, 0);
+}
+
+TEST(BVH_TEST, parallel_build)
+{
+    const std::size_t threads{ Util::threadCount() };
+    Util::setThreadCount(4);
+    compareWithBruteForce<4>(20000, 150);
+    Util::setThreadCount(threads);
+}
+
+TEST(BVH_TEST, degenerate_input)
+{
+    const BVH<float> empty{ static_cast<const Triangle<float> *>(nullptr), 0 };
+    EXPECT_TRUE(empty.empty());
+    TriangleHit<float> hit;
+    const Ray<float> ray{ Point<float, 3>{ 0.2, 0.2, -1 }, Vector<float, 3>{ 0, 0, 1 } };
+    EXPECT_EQ(intersectClosest(empty, static_cast<const Triangle<float> *>(nullptr), ray, 0.0f, 10.0f, hit),
+              BVH<float>::no_hit);
+
+    // identical triangles can not be separated by their centroids
+    const std::vector<Triangle<float>> stacked(
+        100, Triangle<float>{ Point<float, 3>{ 0, 0, 0 }, Point<float, 3>{ 1, 0, 0 }, Point<float, 3>{ 0, 1, 0 } });
+    const BVH8<float> bvh{ stacked.data(), stacked.size() };
+    checkStructure(bvh, stacked);
+    EXPECT_EQ(bvh.bounds(), stacked[0].bounds());
+    EXPECT_NE(intersectClosest(bvh, stacked.data(), ray, 0.0f, 10.0f, hit), BVH8<float>::no_hit);
+    EXPECT_FLOAT_EQ(hit.t, 1);
+}
+
+TEST(BVH_TEST, nearly_coincident_centroids)
+{
+    // the centroids are a few denormals apart, so the number of bins divided by their extent overflows
+    std::vector<Triangle<float>> triangles;
+    for (int i{0}; i < 100; ++i)
+    {
+        const float x{ i * 1e-43f };
+        triangles.push_back(
+            Triangle<float>{ Point<float, 3>{ x, 0, 0 }, Point<float, 3>{ x, 1, 0 }, Point<float, 3>{ x, 0, 1 } });
+    }
+
+    const BVH<float> bvh{ triangles.data(), triangles.size() };
+    checkStructure(bvh, triangles);
+    TriangleHit<float> hit;
+    const Ray<float> ray{ Point<float, 3>{ -1, 0.2, 0.2 }, Vector<float, 3>{ 1, 0, 0 } };
+    // all triangles are hit at the same distance in float
+    EXPECT_NE(intersectClosest(bvh, triangles.data(), ray, 0.0f, 10.0f, hit), BVH<float>::no_hit);
+    EXPECT_FLOAT_EQ(hit.t, 1);
+}
+
+TEST(BVH_TEST, refit)
+{
+    Util::Pcg32 engine{ 11 };
+    std::vector<Triangle<float>> triangles{ randomTriangles(3000, engine) };
+    BVH<float> bvh{ triangles.data(), triangles.size() };
+    EXPECT_GT(bvh.sahCost(), 0);
+    EXPECT_EQ(bvh.sahCost(), bvh.buildSahCost());
+
+    // a rigid motion keeps the quality of the tree
+    Matrix<float, 4, 4> transform{ getTranslation(Vector<float, 3>{ 3, -2, 1 }) };
+    const Matrix<float, 3, 3> rotation{ getRotateZ(0.5f) };
+    for (int row{0}; row < 3; ++row)
+    {
+        for (int col{0}; col < 3; ++col)
+        {
+            transform(row, col) = rotation(row, col);
+        }
+    }
+    float *vertices{ &triangles[0].at(0)(0) };
+    transformPoints(
+        transform, vertices, sizeof(Point<float, 3>), vertices, sizeof(Point<float, 3>), 3 * triangles.size());
+
+    EXPECT_FALSE(bvh.update(triangles.data(), triangles.size()));
+    checkStructure(bvh, triangles);
+    EXPECT_EQ(bvh.bounds(), merge(triangles[0].bounds(), bvh.bounds()));
+    EXPECT_NEAR(bvh.sahCost() / bvh.buildSahCost(), 1, 0.3);
+    expectBruteForceResults(bvh, triangles, engine, 0);
+
+    // scattering the triangles degrades the tree until update rebuilds it
+    std::vector<Triangle<float>> scattered{ triangles };
+    std::reverse(scattered.begin(), scattered.end());
+    bvh.refit(scattered.data());
+    checkStructure(bvh, scattered);
+    EXPECT_TRUE(bvh.needsRebuild());
+    expectBruteForceResults(bvh, scattered, engine, 0);
+
+    EXPECT_TRUE(bvh.update(scattered.data(), scattered.size()));
+    EXPECT_EQ(bvh.sahCost(), bvh.buildSahCost());
+    EXPECT_FALSE(bvh.needsRebuild());
+
+    // a different number of primitives always rebuilds
+    scattered.pop_back();
+    EXPECT_TRUE(bvh.update(scattered.data(), scattered.size()));
+    EXPECT_EQ(bvh.primitives().size(), scattered.size());
+}
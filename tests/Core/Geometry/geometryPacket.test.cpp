@@ -0,0 +1,105 @@
+#include <Core/Geometry/geometryPacket.h>
+#include <gtest/gtest.h>
+#include <limits>
+#include <util/random.h>
+
+using namespace MathLib;
+
+namespace
+{
+template <int width>
+void compareWithScalarTests()
+{
+    const float inf{ std::numeric_limits<float>::infinity() };
+    Util::Pcg32 engine{ 42 };
+    const auto randomPoint = [&engine](float range) {
+        return Point<float, 3>{ Util::random_number(-range, range, engine),
+                                Util::random_number(-range, range, engine),
+                                Util::random_number(-range, range, engine) };
+    };
+
+    for (int iteration{0}; iteration < 50; ++iteration)
+    {
+        Ray<float> rays[width];
+        AABB<float, 3> boxes[width];
+        Triangle<float> triangles[width];
+        for (int lane{0}; lane < width; ++lane)
+        {
+            rays[lane] = Ray<float>{ randomPoint(4), Vector<float, 3>{ Point<float, 3>{} - randomPoint(1) } };
+            boxes[lane] = AABB<float, 3>{ randomPoint(2) }.extend(randomPoint(2));
+            triangles[lane] = Triangle<float>{ randomPoint(2), randomPoint(2), randomPoint(2) };
+        }
+
+        const RayPacket<float, width> rayPacket{ RayPacket<float, width>::load(rays) };
+        AABBPacket<float, width> boxPacket;
+        for (int lane{0}; lane < width; ++lane)
+        {
+            boxPacket.set(lane, boxes[lane]);
+        }
+        const TrianglePacket<float, width> trianglePacket{ TrianglePacket<float, width>::load(triangles) };
+
+        Packet<float, width> tEnter;
+        const Packet<float, width> zero{ 0 };
+        const Packet<float, width> infinity{ inf };
+        const auto rayHits = intersect(rayPacket, boxes[0], zero, infinity, tEnter);
+        Packet<float, width> boxEnter;
+        const auto boxHits = intersect(rays[0], boxPacket, zero, infinity, boxEnter);
+
+        TriangleHitPacket<float, width> rayTriangleHit;
+        const auto rayTriangleHits = intersect(rayPacket, triangles[0], zero, infinity, rayTriangleHit);
+        TriangleHitPacket<float, width> triangleHit;
+        const auto triangleHits = intersect(rays[0], trianglePacket, zero, infinity, triangleHit);
+
+        for (int lane{0}; lane < width; ++lane)
+        {
+            float t;
+            EXPECT_EQ(rayHits[lane], intersect(rays[lane], boxes[0], 0.0f, inf, t));
+            if (rayHits[lane])
+            {
+                EXPECT_FLOAT_EQ(tEnter[lane], t);
+            }
+            EXPECT_EQ(boxHits[lane], intersect(rays[0], boxes[lane], 0.0f, inf, t));
+            if (boxHits[lane])
+            {
+                EXPECT_FLOAT_EQ(boxEnter[lane], t);
+            }
+
+            TriangleHit<float> hit;
+            EXPECT_EQ(rayTriangleHits[lane], intersect(rays[lane], triangles[0], 0.0f, inf, hit));
+            if (rayTriangleHits[lane])
+            {
+                EXPECT_NEAR(rayTriangleHit.t[lane], hit.t, 1e-4);
+            }
+            EXPECT_EQ(triangleHits[lane], intersect(rays[0], triangles[lane], 0.0f, inf, hit));
+            if (triangleHits[lane])
+            {
+                EXPECT_NEAR(triangleHit.u[lane], hit.u, 1e-4);
+                EXPECT_NEAR(triangleHit.v[lane], hit.v, 1e-4);
+            }
+        }
+    }
+}
+} // namespace
+
+TEST(GEOMETRY_PACKET_TEST, matches_scalar_tests)
+{
+    compareWithScalarTests<4>();
+    compareWithScalarTests<8>();
+}
+
+TEST(GEOMETRY_PACKET_TEST, empty_lanes)
+{
+    const float inf{ std::numeric_limits<float>::infinity() };
+    AABBPacket<float, 4> boxes;
+    boxes.set(2, AABB<float, 3>{ Point<float, 3>{ -1, -1, -1 }, Point<float, 3>{ 1, 1, 1 } });
+
+    const Ray<float> ray{ Point<float, 3>{ 0, 0, -5 }, Vector<float, 3>{ 0, 0, 1 } };
+    Packet<float, 4> tEnter;
+    EXPECT_EQ(intersect(ray, boxes, Packet<float, 4>{ 0 }, Packet<float, 4>{ inf }, tEnter).bits(), 0b0100);
+    EXPECT_EQ(tEnter[2], 4);
+    EXPECT_EQ(boxes.get(2), boxes.get(2));
+
+    TriangleHitPacket<float, 4> hit;
+    const TrianglePacket<float, 4> degenerate;
+    EXPECT_TRUE(intersect(ray, degenerate, Packet<float, 4>{ 0 }, Packet<float, 4>{ inf }, hit).none());
+}
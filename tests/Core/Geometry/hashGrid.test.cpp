@@ -0,0 +1,186 @@
+#include <Core/Geometry/hashGrid.h>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <util/random.h>
+#include <util/threadPool.h>
+#include <vector>
+
+using namespace MathLib;
+
+namespace
+{
+template <int size>
+std::vector<Point<float, size>> randomPoints(std::size_t count, Util::Pcg32 &engine)
+{
+    std::vector<Point<float, size>> points(count);
+    for (Point<float, size> &point : points)
+    {
+        for (int i{0}; i < size; ++i)
+        {
+            point(i) = Util::random_number(-10.0f, 10.0f, engine);
+        }
+    }
+
+    return points;
+}
+
+template <int size>
+std::vector<Neighbor<float>> bruteForce(const std::vector<Point<float, size>> &points, const Point<float, size> &query)
+{
+    std::vector<Neighbor<float>> neighbors;
+    for (std::size_t i{0}; i < points.size(); ++i)
+    {
+        const float distanceSquared{ detail::distanceSquared(query, points[i]) };
+        neighbors.push_back(Neighbor<float>{ static_cast<std::uint32_t>(i), distanceSquared });
+    }
+    std::sort(neighbors.begin(), neighbors.end(), detail::closer<float>);
+
+    return neighbors;
+}
+
+std::vector<std::uint32_t> sortedIndices(const std::vector<Neighbor<float>> &neighbors)
+{
+    std::vector<std::uint32_t> indices;
+    for (const Neighbor<float> &neighbor : neighbors)
+    {
+        indices.push_back(neighbor.index);
+    }
+    std::sort(indices.begin(), indices.end());
+
+    return indices;
+}
+
+template <int size>
+void checkQueries(std::size_t count, float cellSize, std::uint64_t seed)
+{
+    Util::Pcg32 engine{ seed };
+    const std::vector<Point<float, size>> points{ randomPoints<size>(count, engine) };
+    const std::vector<Point<float, size>> queries{ randomPoints<size>(50, engine) };
+    const HashGrid<float, size> grid{ points.data(), points.size(), cellSize };
+    EXPECT_EQ(grid.count(), count);
+
+    constexpr std::size_t k{10};
+    for (const Point<float, size> &query : queries)
+    {
+        const std::vector<Neighbor<float>> expected{ bruteForce(points, query) };
+
+        Neighbor<float> nearest[k];
+        const std::size_t found{ grid.nearest(query, k, nearest) };
+        ASSERT_EQ(found, std::min(k, count));
+        for (std::size_t i{0}; i < found; ++i)
+        {
+            EXPECT_EQ(nearest[i].index, expected[i].index);
+            EXPECT_EQ(nearest[i].distanceSquared, expected[i].distanceSquared);
+        }
+
+        const float radius{ 3.0f };
+        std::vector<Neighbor<float>> within;
+        grid.withinRadius(query, radius, within);
+        std::vector<Neighbor<float>> expectedWithin;
+        for (const Neighbor<float> &neighbor : expected)
+        {
+            if (neighbor.distanceSquared <= radius * radius)
+            {
+                expectedWithin.push_back(neighbor);
+            }
+        }
+        EXPECT_EQ(sortedIndices(within), sortedIndices(expectedWithin));
+    }
+}
+} // namespace
+
+TEST(HASH_GRID_TEST, empty)
+{
+    const HashGrid<float, 3> grid{};
+    EXPECT_TRUE(grid.empty());
+
+    Neighbor<float> nearest[4];
+    EXPECT_EQ(grid.nearest(Point<float, 3>{ 0.0f, 0.0f, 0.0f }, 4, nearest), 0u);
+
+    std::vector<Neighbor<float>> within{ Neighbor<float>{ 0, 0.0f } };
+    grid.withinRadius(Point<float, 3>{ 0.0f, 0.0f, 0.0f }, 1.0f, within);
+    EXPECT_TRUE(within.empty());
+}
+
+TEST(HASH_GRID_TEST, matches_brute_force)
+{
+    checkQueries<2>(5, 1.0f, 1);
+    checkQueries<2>(1000, 1.0f, 2);
+    checkQueries<3>(2000, 2.0f, 3);
+    checkQueries<5>(1000, 4.0f, 4);
+    // cells much smaller and much bigger than the spacing of the points
+    checkQueries<3>(500, 0.25f, 5);
+    checkQueries<3>(500, 50.0f, 6);
+}
+
+TEST(HASH_GRID_TEST, duplicate_points)
+{
+    const std::vector<Point<float, 2>> points(20, Point<float, 2>{ 1.0f, 1.0f });
+    const HashGrid<float, 2> grid{ points.data(), points.size(), 0.5f };
+
+    Neighbor<float> nearest[5];
+    ASSERT_EQ(grid.nearest(Point<float, 2>{ 0.0f, 0.0f }, 5, nearest), 5u);
+    for (std::uint32_t i{0}; i < 5; ++i)
+    {
+        EXPECT_EQ(nearest[i].index, i);
+        EXPECT_EQ(nearest[i].distanceSquared, 2.0f);
+    }
+}
+
+TEST(HASH_GRID_TEST, query_outside_of_grid)
+{
+    Util::Pcg32 engine{ 7 };
+    const std::vector<Point<float, 2>> points{ randomPoints<2>(300, engine) };
+    const HashGrid<float, 2> grid{ points.data(), points.size(), 1.0f };
+
+    const Point<float, 2> query{ 100.0f, -80.0f };
+    const std::vector<Neighbor<float>> expected{ bruteForce(points, query) };
+    Neighbor<float> nearest[3];
+    ASSERT_EQ(grid.nearest(query, 3, nearest), 3u);
+    for (std::size_t i{0}; i < 3; ++i)
+    {
+        EXPECT_EQ(nearest[i].index, expected[i].index);
+    }
+}
+
+TEST(HASH_GRID_TEST, batched_queries)
+{
+    const std::size_t threads{ Util::threadCount() };
+    Util::setThreadCount(4);
+
+    Util::Pcg32 engine{ 5 };
+    const std::vector<Point<float, 3>> points{ randomPoints<3>(20000, engine) };
+    const std::vector<Point<float, 3>> queries{ randomPoints<3>(100, engine) };
+    const HashGrid<float, 3> grid{ points.data(), points.size(), 0.5f };
+
+    constexpr std::size_t k{8};
+    std::vector<Neighbor<float>> nearest(queries.size() * k);
+    std::vector<std::size_t> found(queries.size());
+    grid.nearest(queries.data(), queries.size(), k, nearest.data(), found.data());
+
+    std::vector<std::vector<Neighbor<float>>> within;
+    grid.withinRadius(queries.data(), queries.size(), 0.5f, within);
+    ASSERT_EQ(within.size(), queries.size());
+
+    for (std::size_t i{0}; i < queries.size(); ++i)
+    {
+        const std::vector<Neighbor<float>> expected{ bruteForce(points, queries[i]) };
+        ASSERT_EQ(found[i], k);
+        for (std::size_t j{0}; j < k; ++j)
+        {
+            EXPECT_EQ(nearest[i * k + j].index, expected[j].index);
+        }
+
+        std::vector<Neighbor<float>> expectedWithin;
+        for (const Neighbor<float> &neighbor : expected)
+        {
+            if (neighbor.distanceSquared <= 0.25f)
+            {
+                expectedWithin.push_back(neighbor);
+            }
+        }
+        EXPECT_EQ(sortedIndices(within[i]), sortedIndices(expectedWithin));
+    }
+
+    Util::setThreadCount(threads);
+}
@@ -0,0 +1,53 @@
+#include <Core/Geometry/ray.h>
+#include <Core/Geometry/triangle.h>
+#include <gtest/gtest.h>
+#include <limits>
+
+using namespace MathLib;
+
+TEST(TRIANGLE_TEST, properties)
+{
+    const Triangle<double> triangle{ Point<double, 3>{ 0, 0, 0 },
+                                     Point<double, 3>{ 2, 0, 0 },
+                                     Point<double, 3>{ 0, 2, 0 } };
+
+    EXPECT_EQ(triangle.normal(), (Vector<double, 3>{ 0, 0, 4 }));
+    EXPECT_EQ(triangle.area(), 2);
+    EXPECT_EQ(triangle(0.5, 0.5), (Point<double, 3>{ 1, 1, 0 }));
+    EXPECT_EQ(triangle.bounds(), (AABB<double, 3>{ Point<double, 3>{ 0, 0, 0 }, Point<double, 3>{ 2, 2, 0 } }));
+    EXPECT_NEAR(triangle.centroid()(0), 2.0 / 3, 1e-15);
+}
+
+TEST(TRIANGLE_TEST, ray_intersection)
+{
+    const Triangle<float> triangle{ Point<float, 3>{ 0, 0, 0 },
+                                    Point<float, 3>{ 2, 0, 0 },
+                                    Point<float, 3>{ 0, 2, 0 } };
+    const float inf{ std::numeric_limits<float>::infinity() };
+
+    TriangleHit<float> hit;
+    const Ray<float> ray{ Point<float, 3>{ 0.5, 1, 3 }, Vector<float, 3>{ 0, 0, -2 } };
+    EXPECT_TRUE(intersect(ray, triangle, 0.0f, inf, hit));
+    EXPECT_FLOAT_EQ(hit.t, 1.5);
+    EXPECT_FLOAT_EQ(hit.u, 0.25);
+    EXPECT_FLOAT_EQ(hit.v, 0.5);
+    EXPECT_EQ(ray(hit.t), triangle(hit.u, hit.v));
+
+    // back side, outside of the interval, beside and parallel
+    EXPECT_TRUE(intersect(Ray<float>{ Point<float, 3>{ 0.5, 0.5, -1 }, Vector<float, 3>{ 0, 0, 1 } },
+                          triangle,
+                          0.0f,
+                          inf,
+                          hit));
+    EXPECT_FALSE(intersect(ray, triangle, 0.0f, 1.0f, hit));
+    EXPECT_FALSE(intersect(Ray<float>{ Point<float, 3>{ 1.5, 1.5, 3 }, Vector<float, 3>{ 0, 0, -1 } },
+                           triangle,
+                           0.0f,
+                           inf,
+                           hit));
+    EXPECT_FALSE(intersect(Ray<float>{ Point<float, 3>{ -1, 0.5, 0 }, Vector<float, 3>{ 1, 0, 0 } },
+                           triangle,
+                           0.0f,
+                           inf,
+                           hit));
+}
@@ -0,0 +1,140 @@
+#include <Core/Matrix/decomposition.h>
+#include <gtest/gtest.h>
+
+using namespace MathLib;
+
+namespace
+{
+template <typename T, int rows, int cols>
+Matrix<T, rows, cols> randomMatrix(Util::Pcg32 &engine)
+{
+    Matrix<T, rows, cols> mat{};
+    Util::fillRandom(mat.raw(), rows * cols, T{-1}, T{1}, engine);
+
+    return mat;
+}
+
+// A^T A + I is symmetric positive definite
+template <typename T, int n>
+Matrix<T, n, n> randomSPD(Util::Pcg32 &engine)
+{
+    const Matrix<T, n, n> a{randomMatrix<T, n, n>(engine)};
+    Matrix<T, n, n> identity{};
+
+    return Matrix<T, n, n>{transpose(a) * a} + identity.setIdentity();
+}
+} // namespace
+
+TEST(DECOMPOSITION_TEST, lu_solve)
+{
+    Util::Pcg32 engine{1};
+    const Matrix<double, 5, 5> a{randomMatrix<double, 5, 5>(engine)};
+    const LUDecomposition<double, 5> lu{a};
+    ASSERT_TRUE(lu.isInvertible());
+
+    // the factorization is reused for several right hand sides
+    for (int i = 0; i < 4; ++i)
+    {
+        const Vector<double, 5> b{Vector<double, 5>::random(-1.0, 1.0, engine)};
+        EXPECT_TRUE(allClose(Vector<double, 5>{a * lu.solve(b)}, b, 1e-12));
+    }
+
+    const Matrix<double, 5, 3> b{randomMatrix<double, 5, 3>(engine)};
+    EXPECT_TRUE(allClose(Matrix<double, 5, 3>{a * lu.solve(b)}, b, 1e-12));
+
+    EXPECT_TRUE(allClose(Matrix<double, 5, 5>{lu.getP() * a}, Matrix<double, 5, 5>{lu.getL() * lu.getU()}, 1e-12));
+    EXPECT_NEAR(lu.determinant(), a.determinant(), 1e-12);
+    EXPECT_TRUE(allClose(lu.inverse(), inverse(a), 1e-12));
+}
+
+TEST(DECOMPOSITION_TEST, lu_singular)
+{
+    const Matrix<double, 3, 3> a{1, 2, 3, 2, 4, 6, 1, 0, 1};
+    const LUDecomposition<double, 3> lu{a};
+
+    EXPECT_FALSE(lu.isInvertible());
+    EXPECT_EQ(lu.determinant(), 0);
+}
+
+TEST(DECOMPOSITION_TEST, lu_constexpr)
+{
+    constexpr LUDecomposition<double, 2> lu{Matrix<double, 2, 2>{0, 2, 4, 0}};
+    static_assert(lu.determinant() == -8);
+    static_assert(lu.solve(Vector<double, 2>{2, 8}) == Vector<double, 2>{2, 1});
+}
+
+TEST(DECOMPOSITION_TEST, cholesky_solve)
+{
+    Util::Pcg32 engine{2};
+    const Matrix<double, 6, 6> a{randomSPD<double, 6>(engine)};
+    const CholeskyDecomposition<double, 6> cholesky{a};
+    ASSERT_TRUE(cholesky.isPositiveDefinite());
+
+    const Matrix<double, 6, 6> l{cholesky.getL()};
+    EXPECT_TRUE(allClose(Matrix<double, 6, 6>{l * transpose(l)}, a, 1e-12));
+    EXPECT_NEAR(cholesky.determinant(), a.determinant(), 1e-9);
+
+    const Vector<double, 6> b{Vector<double, 6>::random(-1.0, 1.0, engine)};
+    EXPECT_TRUE(allClose(Vector<double, 6>{a * cholesky.solve(b)}, b, 1e-12));
+
+    const Matrix<double, 6, 2> bs{randomMatrix<double, 6, 2>(engine)};
+    EXPECT_TRUE(allClose(Matrix<double, 6, 2>{a * cholesky.solve(bs)}, bs, 1e-12));
+
+    const Matrix<float, 3, 3> af{randomSPD<float, 3>(engine)};
+    const Vector<float, 3> bf{1, 2, 3};
+    EXPECT_TRUE(allClose(Vector<float, 3>{af * CholeskyDecomposition<float, 3>{af}.solve(bf)}, bf, 1e-5f));
+}
+
+TEST(DECOMPOSITION_TEST, cholesky_not_positive_definite)
+{
+    EXPECT_FALSE((CholeskyDecomposition<double, 2>{Matrix<double, 2, 2>{1, 2, 2, 1}}.isPositiveDefinite()));
+    EXPECT_FALSE((CholeskyDecomposition<double, 2>{Matrix<double, 2, 2>{-1, 0, 0, 1}}.isPositiveDefinite()));
+}
+
+TEST(DECOMPOSITION_TEST, qr_factors)
+{
+    Util::Pcg32 engine{3};
+    const Matrix<double, 6, 4> a{randomMatrix<double, 6, 4>(engine)};
+    const QRDecomposition<double, 6, 4> qr{a};
+    ASSERT_TRUE(qr.isFullRank());
+
+    const Matrix<double, 6, 4> q{qr.getQ()};
+    const Matrix<double, 4, 4> r{qr.getR()};
+    Matrix<double, 4, 4> identity{};
+    identity.setIdentity();
+
+    EXPECT_TRUE(allClose(Matrix<double, 6, 4>{q * r}, a, 1e-12));
+    EXPECT_TRUE(allClose(Matrix<double, 4, 4>{transpose(q) * q}, identity, 1e-12));
+    for (int row = 1; row < 4; ++row)
+    {
+        for (int col = 0; col < row; ++col)
+        {
+            EXPECT_EQ(r(row, col), 0);
+        }
+    }
+}
+
+TEST(DECOMPOSITION_TEST, qr_least_squares)
+{
+    // fit a line y = m x + c through points that are not on a line
+    const Matrix<double, 4, 2> a{0, 1, 1, 1, 2, 1, 3, 1};
+    const Vector<double, 4> y{1, 3, 4, 4};
+    const QRDecomposition<double, 4, 2> qr{a};
+
+    // solution of the normal equations A^T A x = A^T y
+    const Vector<double, 2> expected{CholeskyDecomposition<double, 2>{transpose(a) * a}.solve(transpose(a) * y)};
+    EXPECT_TRUE(allClose(qr.solve(y), expected, 1e-12));
+    EXPECT_TRUE(allClose(qr.solve(y), Vector<double, 2>{1.0, 1.5}, 1e-12));
+
+    // square systems are solved exactly
+    Util::Pcg32 engine{4};
+    const Matrix<double, 3, 3> square{randomMatrix<double, 3, 3>(engine)};
+    const Matrix<double, 3, 2> b{randomMatrix<double, 3, 2>(engine)};
+    EXPECT_TRUE(allClose(Matrix<double, 3, 2>{square * QRDecomposition<double, 3, 3>{square}.solve(b)}, b, 1e-12));
+}
+
+TEST(DECOMPOSITION_TEST, qr_rank_deficient)
+{
+    const Matrix<double, 3, 2> a{1, 2, 2, 4, 3, 6};
+    EXPECT_FALSE((QRDecomposition<double, 3, 2>{a}.isFullRank()));
+}
@@ -0,0 +1,97 @@
+#include <Core/Matrix/denseMatrix.h>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <type_traits>
+
+using namespace MathLib;
+
+TEST(DENSE_MATRIX_TEST, construction)
+{
+    DenseMatrix<float> mat(3, 5);
+    EXPECT_EQ(mat.rows(), 3u);
+    EXPECT_EQ(mat.cols(), 5u);
+    EXPECT_EQ(mat(2, 4), 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mat.raw()) % Util::buffer_alignment, 0u);
+
+    // column major like Matrix
+    mat(1, 2) = 7;
+    EXPECT_EQ(mat.raw()[2 * 3 + 1], 7);
+    EXPECT_EQ(mat.column(2)[1], 7);
+
+    DenseMatrix<int> identity{ DenseMatrix<int>::identity(4) };
+    EXPECT_EQ(identity.trace(), 4);
+    EXPECT_EQ(identity(0, 1), 0);
+}
+
+TEST(DENSE_MATRIX_TEST, move_only)
+{
+    static_assert(!std::is_copy_constructible<DenseMatrix<double>>::value);
+    static_assert(std::is_nothrow_move_constructible<DenseMatrix<double>>::value);
+
+    DenseMatrix<double> mat(10, 20, 1.0);
+    const double *data = mat.raw();
+    DenseMatrix<double> moved{ std::move(mat) };
+    EXPECT_EQ(moved.raw(), data);
+    EXPECT_EQ(mat.rows(), 0u);
+
+    DenseMatrix<double> copy{ moved.clone() };
+    EXPECT_NE(copy.raw(), moved.raw());
+    EXPECT_EQ(copy, moved);
+}
+
+TEST(DENSE_MATRIX_TEST, fixed_size_interop)
+{
+    const Matrix<int, 2, 3> fixed{ 1, 2, 3, 4, 5, 6 };
+    DenseMatrix<int> mat{ fixed };
+    EXPECT_EQ((mat.block<2, 3>(0, 0)), fixed);
+
+    DenseMatrix<int> big(4, 5);
+    big.setBlock(1, 2, fixed);
+    EXPECT_EQ(big(1, 2), 1);
+    EXPECT_EQ(big(2, 4), 6);
+    EXPECT_EQ(big(0, 2), 0);
+    EXPECT_EQ((big.block<2, 2>(2, 3)), (Matrix<int, 2, 2>{ 5, 6, 0, 0 }));
+}
+
+TEST(DENSE_MATRIX_TEST, products_match_fixed_size)
+{
+    Util::Pcg32 engine{ 1 };
+    Matrix<double, 5, 7> a{};
+    Matrix<double, 7, 3> b{};
+    Util::fillRandom(a.raw(), 35, -1.0, 1.0, engine);
+    Util::fillRandom(b.raw(), 21, -1.0, 1.0, engine);
+    const Vector<double, 7> v{ Vector<double, 7>::random(-1.0, 1.0, engine) };
+
+    const DenseMatrix<double> product{ DenseMatrix<double>{ a } * DenseMatrix<double>{ b } };
+    EXPECT_TRUE(allClose(product, DenseMatrix<double>{ Matrix<double, 5, 3>{ a * b } }, 1e-14));
+
+    const DenseVector<double> transformed{ DenseMatrix<double>{ a } * DenseVector<double>{ v } };
+    EXPECT_TRUE(allClose(transformed, DenseVector<double>{ Vector<double, 5>{ a * v } }, 1e-14));
+
+    EXPECT_EQ(transpose(DenseMatrix<double>{ a }), (DenseMatrix<double>{ Matrix<double, 7, 5>{ transpose(a) } }));
+}
+
+TEST(DENSE_MATRIX_TEST, arithmetic)
+{
+    DenseMatrix<int> a{ Matrix<int, 2, 2>{ 1, 2, 3, 4 } };
+    DenseMatrix<int> b{ Matrix<int, 2, 2>{ 4, 3, 2, 1 } };
+
+    EXPECT_EQ(a + b, DenseMatrix<int>(2, 2, 5));
+    EXPECT_EQ(a - a, DenseMatrix<int>(2, 2));
+    EXPECT_EQ(-a, a * -1);
+    EXPECT_EQ(2 * a, (DenseMatrix<int>{ Matrix<int, 2, 2>{ 2, 4, 6, 8 } }));
+    EXPECT_EQ((a * 4) / 2, a + a);
+    EXPECT_NE(a, DenseMatrix<int>(2, 3));
+
+    // scalars of another arithmetic type
+    DenseMatrix<double> c{ Matrix<double, 2, 2>{ 1, 2, 3, 4 } };
+    EXPECT_EQ(c * 2, (DenseMatrix<double>{ Matrix<double, 2, 2>{ 2, 4, 6, 8 } }));
+    EXPECT_EQ(2 * c, c * 2.0);
+    EXPECT_EQ(c / 2, c * 0.5);
+    EXPECT_EQ(DenseMatrix<float>(2, 2, 3.0f) * 0.5, DenseMatrix<float>(2, 2, 1.5f));
+
+    std::stringstream out;
+    out << a;
+    EXPECT_EQ(out.str(), "[ [ 1, 2 ], [ 3, 4 ] ]");
+}
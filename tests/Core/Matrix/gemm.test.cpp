@@ -0,0 +1,118 @@
+#include <Core/Matrix/denseMatrix.h>
+#include <Core/Matrix/gemm.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace MathLib;
+
+namespace
+{
+// straightforward triple loop as the reference
+template <typename T>
+void referenceGemm(std::size_t m,
+                   std::size_t n,
+                   std::size_t k,
+                   T alpha,
+                   const T *a,
+                   std::size_t lda,
+                   const T *b,
+                   std::size_t ldb,
+                   T beta,
+                   T *c,
+                   std::size_t ldc)
+{
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        for (std::size_t i = 0; i < m; ++i)
+        {
+            T sum{ 0 };
+            for (std::size_t p = 0; p < k; ++p)
+            {
+                sum += a[p * lda + i] * b[j * ldb + p];
+            }
+            c[j * ldc + i] = alpha * sum + beta * c[j * ldc + i];
+        }
+    }
+}
+
+template <typename T>
+void expectMatchesReference(std::size_t m, std::size_t n, std::size_t k, T alpha, T beta, T tolerance)
+{
+    // the leading dimensions are bigger than the blocks to test sub-matrices
+    const std::size_t lda{ m + 3 }, ldb{ k + 1 }, ldc{ m + 2 };
+    Util::Pcg32 engine{ m * 1000 + n * 10 + k };
+    std::vector<T> a(lda * k), b(ldb * n), c(ldc * n);
+    Util::fillRandom(a.data(), a.size(), T{ -1 }, T{ 1 }, engine);
+    Util::fillRandom(b.data(), b.size(), T{ -1 }, T{ 1 }, engine);
+    Util::fillRandom(c.data(), c.size(), T{ -1 }, T{ 1 }, engine);
+    std::vector<T> expected{ c };
+
+    gemm(m, n, k, alpha, a.data(), lda, b.data(), ldb, beta, c.data(), ldc);
+    referenceGemm(m, n, k, alpha, a.data(), lda, b.data(), ldb, beta, expected.data(), ldc);
+
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        for (std::size_t i = 0; i < ldc; ++i)
+        {
+            // the padding between the columns must not be touched
+            const T tol{ i < m ? tolerance : T{ 0 } };
+            ASSERT_NEAR(c[j * ldc + i], expected[j * ldc + i], tol)
+                << m << "x" << n << "x" << k << " at " << i << ", " << j;
+        }
+    }
+}
+} // namespace
+
+TEST(GEMM_TEST, matches_reference)
+{
+    // sizes around the tile and block sizes of the kernels, including partial tiles in both directions
+    const std::size_t sizes[][3]{ { 1, 1, 1 },    { 7, 5, 3 },     { 16, 6, 1 },   { 17, 7, 9 },
+                                  { 33, 13, 300 }, { 130, 70, 90 }, { 200, 9, 400 } };
+
+    for (const auto &size : sizes)
+    {
+        expectMatchesReference<double>(size[0], size[1], size[2], 1.0, 0.0, 1e-12);
+        expectMatchesReference<double>(size[0], size[1], size[2], -0.5, 2.0, 1e-12);
+        expectMatchesReference<float>(size[0], size[1], size[2], 1.5f, 1.0f, 1e-3f);
+    }
+}
+
+TEST(GEMM_TEST, integer_and_zero_beta)
+{
+    std::vector<int> a{ 1, 2, 3, 4 }, b{ 5, 6, 7, 8 };
+    std::vector<int> c{ 1, 1, 1, 1 };
+    gemm<int>(2, 2, 2, 1, a.data(), 2, b.data(), 2, 0, c.data(), 2);
+    EXPECT_EQ(c, (std::vector<int>{ 23, 34, 31, 46 }));
+
+    // beta == 0 ignores whatever C holds
+    std::vector<double> nan(4, std::numeric_limits<double>::quiet_NaN());
+    std::vector<double> ad{ 1, 0, 0, 1 };
+    gemm<double>(2, 2, 2, 1, ad.data(), 2, ad.data(), 2, 0, nan.data(), 2);
+    EXPECT_EQ(nan, ad);
+}
+
+TEST(GEMM_TEST, dense_matrix_product)
+{
+    Util::Pcg32 engine{ 5 };
+    DenseMatrix<double> a(150, 90), b(90, 70);
+    Util::fillRandom(a.raw(), 150 * 90, -1.0, 1.0, engine);
+    Util::fillRandom(b.raw(), 90 * 70, -1.0, 1.0, engine);
+
+    DenseMatrix<double> expected(150, 70);
+    referenceGemm<double>(150, 70, 90, 1, a.raw(), 150, b.raw(), 90, 0, expected.raw(), 150);
+    EXPECT_TRUE(allClose(a * b, expected, 1e-12));
+
+    DenseMatrix<double> c{ expected.clone() };
+    gemm(2.0, a, b, -1.0, c);
+    EXPECT_TRUE(allClose(c, expected, 1e-12));
+}
+
+TEST(GEMM_TEST, parallel_tiles)
+{
+    // big enough to be split into tiles, with partial tiles at the borders
+    Util::setThreadCount(4);
+    expectMatchesReference<double>(300, 170, 150, -0.5, 2.0, 1e-12);
+    expectMatchesReference<float>(1000, 7, 400, 1.0f, 0.0f, 1e-3f);
+    expectMatchesReference<float>(129, 1000, 20, 1.5f, 1.0f, 1e-3f);
+    Util::setThreadCount(0);
+}
@@ -59,6 +59,23 @@ TEST_F(MatrixTest, instantiate_and_initialize_with_vectors)
     EXPECT_EQ(raw[5], 6);
 }
 
+TEST_F(MatrixTest, inline_storage)
+{
+    EXPECT_TRUE((std::is_trivially_copyable<Matrix<float, 4, 4>>::value));
+    EXPECT_TRUE((std::is_trivially_copyable<Matrix<int, 2, 3>>::value));
+    EXPECT_EQ(sizeof(Matrix<float, 4, 4>), 16 * sizeof(float));
+    EXPECT_EQ(sizeof(Matrix<double, 3, 3>), 9 * sizeof(double));
+    EXPECT_EQ(alignof(Matrix<float, 4, 4>), 32u);
+}
+
+TEST_F(MatrixTest, move_constructor)
+{
+    Matrix<int, 2, 3> copy{ testMat };
+    Matrix<int, 2, 3> moved{ std::move(copy) };
+
+    EXPECT_EQ(moved, testMat);
+}
+
 TEST_F(MatrixTest, const_subscript_operator)
 {
     EXPECT_EQ(testMat(0, 0), 1);
@@ -381,3 +398,191 @@ TEST_F(MatrixTest, getRotation)
 }
 
 
+TEST_F(MatrixTest, fused_expression)
+{
+    Matrix<int, 2, 2> a{ 1, 2, 3, 4 };
+    Matrix<int, 2, 2> b{ 5, 6, 7, 8 };
+    Matrix<int, 2, 2> c{ 1, 0, 2, 0 };
+
+    Matrix<int, 2, 2> res = a * 2 + b - transpose(c);
+    Matrix<int, 2, 2> expected{ 6, 8, 13, 16 };
+
+    EXPECT_EQ(res, expected);
+}
+
+TEST_F(MatrixTest, transpose_assignment_aliasing)
+{
+    Matrix<int, 3, 3> mat{
+        1, 2, 3,
+        4, 5, 6,
+        7, 8, 9
+    };
+
+    Matrix<int, 3, 3> expected{
+        1, 4, 7,
+        2, 5, 8,
+        3, 6, 9
+    };
+
+    mat = transpose(mat);
+    EXPECT_EQ(mat, expected);
+
+    mat += transpose(mat);
+    Matrix<int, 3, 3> symmetric{
+        2, 6, 10,
+        6, 10, 14,
+        10, 14, 18
+    };
+    EXPECT_EQ(mat, symmetric);
+}
+
+TEST_F(MatrixTest, product_inside_expression)
+{
+    Matrix<int, 3, 2> operand{
+         1, 2,
+         3, 4,
+         5, 6
+    };
+
+    Matrix<int, 2, 2> expected{
+        23, 28,
+        49, 65
+    };
+    Matrix<int, 2, 2> identity{ 1, 0, 0, 1 };
+
+    EXPECT_EQ(testMat * operand + identity, expected);
+    EXPECT_EQ((testMatX2 - testMat) * operand + identity, expected);
+}
+
+TEST_F(MatrixTest, matrix_matrix_product_4x4)
+{
+    Matrix<int, 4, 4> a{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+    Matrix<int, 4, 4> b{ 2, 0, 1, 3, 1, 4, 0, 2, 5, 1, 2, 0, 3, 3, 1, 1 };
+    Matrix<int, 4, 4> expected = a * b;
+
+    Matrix<float, 4, 4> af{ a };
+    Matrix<float, 4, 4> bf{ b };
+    Matrix<float, 4, 4> expectedF{ expected };
+    EXPECT_EQ(af * bf, expectedF);
+
+    Matrix<double, 4, 4> ad{ a };
+    Matrix<double, 4, 4> bd{ b };
+    Matrix<double, 4, 4> expectedD{ expected };
+    EXPECT_EQ(ad * bd, expectedD);
+}
+
+TEST_F(MatrixTest, matrix_vector_product_4x4)
+{
+    Matrix<float, 4, 4> af{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+    Vector<float, 4> vf{ 1, -1, 2, 0.5 };
+    Vector<float, 4> expectedF{ 7, 17, 27, 37 };
+    EXPECT_EQ(af * vf, expectedF);
+
+    Point<float, 4> pf{ 1, -1, 2, 0.5 };
+    Point<float, 4> expectedP{ 7, 17, 27, 37 };
+    EXPECT_EQ(af * pf, expectedP);
+
+    Matrix<double, 4, 4> ad{ af };
+    Vector<double, 4> vd{ vf };
+    Vector<double, 4> expectedD{ expectedF };
+    EXPECT_EQ(ad * vd, expectedD);
+}
+
+TEST_F(MatrixTest, constexpr_arithmetic)
+{
+    constexpr Matrix<int, 4, 4> translation{ getTranslation(Vector<int, 3>{ 1, 2, 3 }) };
+    constexpr Matrix<int, 4, 4> scaling{ getScaling(Vector<int, 3>{ 2, 2, 2 }) };
+    constexpr Matrix<int, 4, 4> transform = translation * scaling;
+    constexpr Point<int, 4> transformed = transform * Point<int, 4>{ 1, 1, 1, 1 };
+    static_assert(transformed == Point<int, 4>{ 3, 4, 5, 1 });
+
+    constexpr Matrix<int, 2, 2> a{ 1, 2, 3, 4 };
+    constexpr Matrix<int, 2, 2> b = transpose(a) * 2 - a;
+    static_assert(b == Matrix<int, 2, 2>{ 1, 4, 1, 4 });
+    static_assert(Matrix<int, 3, 3>{}.setIdentity().trace() == 3);
+    static_assert(Matrix<int, 2, 2>{ a }.transpose() == transpose(a));
+
+    constexpr Matrix<double, 4, 4> translationD{ getTranslation(Vector<double, 3>{ 1, 2, 3 }) };
+    constexpr Vector<double, 4> moved = translationD * Vector<double, 4>{ 1, 0, 0, 1 };
+    static_assert(moved == Vector<double, 4>{ 2, 2, 3, 1 });
+    EXPECT_EQ(transform, translation * scaling);
+}
+
+TEST_F(MatrixTest, determinant)
+{
+    EXPECT_EQ((Matrix<int, 2, 2>{ 1, 2, 3, 4 }.determinant()), -2);
+    EXPECT_EQ((Matrix<int, 3, 3>{ 2, 0, 1, 1, 3, 2, 1, 1, 2 }.determinant()), 6);
+    EXPECT_EQ((Matrix<int, 4, 4>{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 }.determinant()), 0);
+    EXPECT_EQ((Matrix<int, 4, 4>{ 2, 0, 1, 3, 1, 4, 0, 2, 5, 1, 2, 0, 3, 3, 1, 1 }.determinant()), 4);
+
+    // lower triangular, the determinant is the product of the diagonal (the LU decomposition has to pivot)
+    Matrix<double, 5, 5> lower{};
+    for (int i = 0; i < 5; ++i)
+    {
+        for (int j = 0; j <= i; ++j)
+        {
+            lower(i, j) = i + j + 1;
+        }
+    }
+    EXPECT_DOUBLE_EQ(lower.determinant(), 1.0 * 3 * 5 * 7 * 9);
+    EXPECT_EQ((Matrix<int, 5, 5>{ lower }.determinant()), 945);
+
+    static_assert(Matrix<int, 3, 3>{ 2, 0, 1, 1, 3, 2, 1, 1, 2 }.determinant() == 6);
+}
+
+template <typename T, int n>
+void expectInverse(const Matrix<T, n, n> &mat, T tolerance)
+{
+    Matrix<T, n, n> identity{};
+    identity.setIdentity();
+
+    const Matrix<T, n, n> inv{ inverse(mat) };
+    EXPECT_TRUE(allClose((Matrix<T, n, n>{ mat * inv }), identity, tolerance)) << mat * inv;
+    EXPECT_TRUE(allClose((Matrix<T, n, n>{ inv * mat }), identity, tolerance)) << inv * mat;
+}
+
+TEST_F(MatrixTest, inverse)
+{
+    Util::Pcg32 engine{ 11 };
+    for (int i = 0; i < 10; ++i)
+    {
+        Matrix<double, 2, 2> a2{};
+        Matrix<double, 3, 3> a3{};
+        Matrix<double, 4, 4> a4{};
+        Matrix<double, 7, 7> a7{};
+        Util::fillRandom(a2.raw(), 4, -1.0, 1.0, engine);
+        Util::fillRandom(a3.raw(), 9, -1.0, 1.0, engine);
+        Util::fillRandom(a4.raw(), 16, -1.0, 1.0, engine);
+        Util::fillRandom(a7.raw(), 49, -1.0, 1.0, engine);
+
+        expectInverse(a2, 1e-12);
+        expectInverse(a3, 1e-12);
+        expectInverse(a4, 1e-12);
+        expectInverse(a7, 1e-12);
+        expectInverse(Matrix<float, 4, 4>{ a4 }, 1e-4f);
+        expectInverse(Matrix<float, 7, 7>{ a7 }, 1e-4f);
+    }
+
+    // the inverse of a permutation is its transpose
+    Matrix<float, 4, 4> permutation{ 0, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0 };
+    EXPECT_EQ(inverse(permutation), transpose(permutation));
+    EXPECT_EQ((Matrix<float, 4, 4>{ permutation }.invert()), transpose(permutation));
+
+    static_assert(inverse(Matrix<double, 2, 2>{ 2, 0, 0, 4 }) == Matrix<double, 2, 2>{ 0.5, 0, 0, 0.25 });
+}
+
+TEST_F(MatrixTest, affineInverse)
+{
+    const Matrix<double, 4, 4> transform{ getTranslation(Vector<double, 3>{ 1, -2, 3 }) *
+                                          Matrix<double, 4, 4>{ getRotation(Vector<double, 3>{ 0.3, -1.2, 2 }) } *
+                                          Matrix<double, 4, 4>{ getScaling(Vector<double, 3>{ 2, 0.5, 4 }) } };
+
+    Matrix<double, 4, 4> identity{};
+    identity.setIdentity();
+
+    EXPECT_TRUE(allClose((Matrix<double, 4, 4>{ affineInverse(transform) * transform }), identity, 1e-12));
+    EXPECT_TRUE(allClose(affineInverse(transform), inverse(transform), 1e-12));
+
+    const Matrix<float, 4, 4> transformF{ transform };
+    EXPECT_TRUE(allClose(affineInverse(transformF), inverse(transformF), 1e-5f));
+}
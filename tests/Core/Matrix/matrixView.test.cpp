@@ -0,0 +1,83 @@
+#include <Core/Matrix/denseMatrix.h>
+#include <Core/Matrix/matrix.h>
+#include <Core/Matrix/matrixView.h>
+#include <gtest/gtest.h>
+
+using namespace MathLib;
+
+TEST(MATRIX_VIEW_TEST, rows_cols_and_blocks)
+{
+    Matrix<int, 3, 4> mat{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+
+    EXPECT_EQ(mat.row(1), (Vector<int, 4>{ 5, 6, 7, 8 }));
+    EXPECT_EQ(mat.col(2), (Vector<int, 3>{ 3, 7, 11 }));
+    EXPECT_EQ((mat.block<2, 2>(1, 2)), (Matrix<int, 2, 2>{ 7, 8, 11, 12 }));
+    EXPECT_EQ((mat.block<2, 3>(1, 1).row(1)), (Vector<int, 3>{ 10, 11, 12 }));
+    EXPECT_EQ((mat.block<2, 3>(1, 1).col(0)), (Vector<int, 2>{ 6, 10 }));
+
+    // writes go to the matrix
+    mat.row(0) = Vector<int, 4>{ 0, 0, 0, 0 };
+    mat.col(3) *= -1;
+    mat.block<2, 2>(1, 0)(1, 1) = 100;
+    EXPECT_EQ(mat, (Matrix<int, 3, 4>{ 0, 0, 0, 0, 5, 6, 7, -8, 9, 100, 11, -12 }));
+
+    const Matrix<int, 3, 4> &constMat{ mat };
+    VectorView<const int, 4> row{ constMat.row(2) };
+    EXPECT_EQ(row(1), 100);
+}
+
+TEST(MATRIX_VIEW_TEST, expressions)
+{
+    Matrix<double, 4, 4> mat{};
+    mat.setIdentity();
+    mat.col(3) = Vector<double, 4>{ 1, 2, 3, 1 };
+
+    const Matrix<double, 3, 3> other{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    const auto rotation{ mat.block<3, 3>(0, 0) };
+
+    EXPECT_EQ((Matrix<double, 3, 3>{ rotation + other }), (Matrix<double, 3, 3>{ 2, 2, 3, 4, 6, 6, 7, 8, 10 }));
+    EXPECT_EQ((Matrix<double, 3, 3>{ 2.0 * transpose(rotation) }), (Matrix<double, 3, 3>{ 2, 0, 0, 0, 2, 0, 0, 0, 2 }));
+    EXPECT_EQ(rotation * other, other);
+    EXPECT_EQ(other * rotation, other);
+    EXPECT_EQ((rotation * Vector<double, 3>{ 1, 2, 3 }), (Vector<double, 3>{ 1, 2, 3 }));
+    EXPECT_TRUE(allClose(rotation, other - other + rotation));
+
+    Matrix<double, 3, 3> sum{ other };
+    sum += rotation;
+    EXPECT_EQ(sum(1, 1), 6);
+}
+
+TEST(MATRIX_VIEW_TEST, aliasing_assignments)
+{
+    Matrix<int, 3, 3> mat{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+    // the block overlaps itself shifted by one column
+    mat.block<3, 2>(0, 1) = mat.block<3, 2>(0, 0);
+    EXPECT_EQ(mat, (Matrix<int, 3, 3>{ 1, 1, 2, 4, 4, 5, 7, 7, 8 }));
+
+    mat.row(0) = mat.col(0);
+    EXPECT_EQ(mat.row(0), (Vector<int, 3>{ 1, 4, 7 }));
+
+    // a matrix assigned from a view of its own elements
+    Matrix<int, 2, 2> small{ 1, 2, 3, 4 };
+    small = transpose(MatrixView<int, 2, 2>{ small.raw() });
+    EXPECT_EQ(small, (Matrix<int, 2, 2>{ 1, 3, 2, 4 }));
+    small = MatrixView<int, 2, 2>{ small.raw(), 2, 1 };
+    EXPECT_EQ(small, (Matrix<int, 2, 2>{ 1, 2, 3, 4 }));
+}
+
+TEST(MATRIX_VIEW_TEST, foreign_buffers)
+{
+    // a row major 2 x 3 matrix as it could come from a mapped file
+    const float rowMajor[]{ 1, 2, 3, 4, 5, 6 };
+    const MatrixView<const float, 2, 3> view{ rowMajor, 3, 1 };
+
+    EXPECT_EQ(view, (Matrix<float, 2, 3>{ 1, 2, 3, 4, 5, 6 }));
+    EXPECT_EQ(view.at(1, 0), 4);
+
+    // blocks of dense matrices
+    DenseMatrix<float> dense(5, 5);
+    dense.block<2, 3>(1, 1) = view;
+    EXPECT_EQ(dense(2, 1), 4);
+    EXPECT_EQ((dense.block<2, 3>(1, 1)), view);
+}
@@ -0,0 +1,113 @@
+#include <Core/Matrix/transform.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace MathLib;
+
+TEST(TRANSFORM_TEST, transform_points)
+{
+    Matrix<float, 4, 4> mat{ getTranslation(Vector<float, 3>{ 1, 2, 3 }) };
+    mat(0, 0) = 2;
+
+    std::vector<Point<float, 3>> points{ Point<float, 3>{ 1, 1, 1 }, Point<float, 3>{ -1, 0, 2 } };
+    std::vector<Point<float, 3>> transformed(points.size());
+
+    transformPoints(mat, points.data(), transformed.data(), points.size());
+
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        Point<float, 4> expected{ mat * Point<float, 4>{ points[i], 1 } };
+        EXPECT_EQ(transformed[i], (Point<float, 3>{ expected }));
+    }
+}
+
+TEST(TRANSFORM_TEST, transform_points_in_place_with_divide)
+{
+    Matrix<double, 4, 4> mat{
+        1, 0, 0, 0,
+        0, 1, 0, 0,
+        0, 0, 1, 0,
+        0, 0, 1, 0
+    };
+
+    std::vector<Point<double, 3>> points{ Point<double, 3>{ 2, 4, 2 }, Point<double, 3>{ 3, 6, 3 } };
+    Point<double, 3> expected{ 1, 2, 1 };
+
+    transformPoints(mat, points.data(), points.data(), points.size(), true);
+
+    EXPECT_EQ(points[0], expected);
+    EXPECT_EQ(points[1], expected);
+}
+
+TEST(TRANSFORM_TEST, transform_vectors)
+{
+    Matrix<float, 4, 4> mat{ getTranslation(Vector<float, 3>{ 1, 2, 3 }) };
+    mat(1, 0) = 1;
+
+    std::vector<Vector<float, 3>> vectors{ Vector<float, 3>{ 1, 0, 0 }, Vector<float, 3>{ 0, 2, 1 } };
+    transformVectors(mat, vectors.data(), vectors.data(), vectors.size());
+
+    Vector<float, 3> expectedFirst{ 1, 1, 0 };
+    Vector<float, 3> expectedSecond{ 0, 2, 1 };
+    EXPECT_EQ(vectors[0], expectedFirst);
+    EXPECT_EQ(vectors[1], expectedSecond);
+}
+
+TEST(TRANSFORM_TEST, transform_strided_buffer)
+{
+    // interleaved position (3 floats) and color (2 floats)
+    float vertices[]{ 1, 2, 3, 0.5, 0.5, 4, 5, 6, 0.25, 0.25 };
+    float positions[6];
+
+    Matrix<float, 4, 4> mat{ getTranslation(Vector<float, 3>{ 1, 1, 1 }) };
+    transformPoints(mat, vertices, 5 * sizeof(float), positions, 3 * sizeof(float), 2);
+
+    float expected[]{ 2, 3, 4, 5, 6, 7 };
+    for (int i = 0; i < 6; ++i)
+    {
+        EXPECT_FLOAT_EQ(positions[i], expected[i]);
+    }
+    EXPECT_FLOAT_EQ(vertices[3], 0.5);
+}
+
+TEST(TRANSFORM_TEST, transform_in_parallel)
+{
+    Util::setThreadCount(4);
+
+    Matrix<double, 4, 4> mat{ getTranslation(Vector<double, 3>{ 1, 2, 3 }) };
+    mat(0, 1) = 2;
+
+    const std::size_t count{ 50001 };
+    std::vector<Point<double, 3>> points(count);
+    std::vector<Vector<double, 3>> vectors(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        points[i] = Point<double, 3>{ double(i), 1, -1 };
+        vectors[i] = Vector<double, 3>{ 1, double(i), 0 };
+    }
+
+    transformPoints(mat, points.data(), points.data(), count);
+    transformVectors(mat, vectors.data(), vectors.data(), count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(points[i], (Point<double, 3>{ i + 3.0, 3, 2 })) << i;
+        ASSERT_EQ(vectors[i], (Vector<double, 3>{ 1 + 2.0 * i, double(i), 0 })) << i;
+    }
+
+    Util::setThreadCount(0);
+}
+
+TEST(TRANSFORM_TEST, strided_aliasing)
+{
+    float vertices[10]{};
+    float positions[6]{};
+
+    EXPECT_TRUE(detail::validStridedAliasing(vertices, 5 * sizeof(float), positions, 3 * sizeof(float), 2));
+    EXPECT_TRUE(detail::validStridedAliasing(vertices, 5 * sizeof(float), vertices, 5 * sizeof(float), 2));
+    // the output of the first position would overwrite the input of the second one
+    EXPECT_FALSE(detail::validStridedAliasing(vertices, 5 * sizeof(float), vertices, 3 * sizeof(float), 2));
+    EXPECT_FALSE(detail::validStridedAliasing(vertices, 5 * sizeof(float), vertices + 1, 5 * sizeof(float), 2));
+    // the color of an interleaved vertex buffer next to its positions
+    EXPECT_TRUE(detail::validStridedAliasing(vertices, 5 * sizeof(float), vertices + 3, 5 * sizeof(float), 1));
+}
@@ -131,11 +131,118 @@ TEST(QUATERNION_TEST, slerp)
   Quaternion<float> q{};
   Quaternion<float> r{};
   q.setRotation(Vector<float, 3>{1.0, 0.0, 0.0}, 0.0);
-  r.setRotation(Vector<float, 3>{1.0, 0.0, 0.0}, M_PI);
+  // not a rotation by pi, the two paths to it have the same length
+  r.setRotation(Vector<float, 3>{1.0, 0.0, 0.0}, 0.75 * M_PI);
 
-  Quaternion<float> interpolated{slerp(q, r, 0.25f)};
+  Quaternion<float> interpolated{slerp(q, r, 1.0f / 3)};
   Quaternion<float> expected{};
   expected.setRotation(Vector<float, 3>{1.0, 0.0, 0.0}, M_PI_4);
 
-  EXPECT_EQ(interpolated, expected);
-}
\ No newline at end of file
+  EXPECT_TRUE(allClose(interpolated, expected, 1e-6f));
+}
+
+TEST(QUATERNION_TEST, slerp_takes_shorter_path)
+{
+  Quaternion<double> q{};
+  Quaternion<double> r{};
+  q.setRotation(Vector<double, 3>{ 0.0, 0.0, 1.0 }, 0.2);
+  r.setRotation(Vector<double, 3>{ 0.0, 0.0, 1.0 }, 1.0);
+
+  // -r is the same rotation as r, so the interpolation has to stay the same
+  Quaternion<double> expected{};
+  expected.setRotation(Vector<double, 3>{ 0.0, 0.0, 1.0 }, 0.6);
+  EXPECT_TRUE(allClose(slerp(q, r * -1.0, 0.5), expected, 1e-12));
+  EXPECT_TRUE(allClose(nlerp(q, r * -1.0, 0.5), expected, 1e-12));
+
+  // obtuse: the long arc from q to r would pass through the rotation by pi
+  r.setRotation(Vector<double, 3>{ 0.0, 0.0, 1.0 }, 0.2 + 1.5 * M_PI);
+  ASSERT_LT(dot(q, r), 0.0);
+  expected.setRotation(Vector<double, 3>{ 0.0, 0.0, 1.0 }, 0.2 - 0.25 * M_PI);
+  Quaternion<double> halfway{ slerp(q, r, 0.5) };
+  EXPECT_TRUE(allClose(halfway, expected, 1e-12) || allClose(halfway, expected * -1.0, 1e-12));
+
+  // antipodal: the same rotation, the interpolation is constant
+  Quaternion<double> antipodal{ slerp(q, q * -1.0, 0.5) };
+  EXPECT_TRUE(allClose(antipodal, q, 1e-12) || allClose(antipodal, q * -1.0, 1e-12));
+  EXPECT_FLOAT_EQ(antipodal.norm(), 1.0);
+}
+
+TEST(QUATERNION_TEST, hamilton_product_of_units)
+{
+  Quaternion<float> i{ 1.0, 0.0, 0.0, 0.0 };
+  Quaternion<float> j{ 0.0, 1.0, 0.0, 0.0 };
+  Quaternion<float> k{ 0.0, 0.0, 1.0, 0.0 };
+  Quaternion<float> minusOne{ 0.0, 0.0, 0.0, -1.0 };
+
+  EXPECT_EQ(i * j, k);
+  EXPECT_EQ(j * i, -k);
+  EXPECT_EQ(i * i, minusOne);
+  EXPECT_EQ(i * j * k, minusOne);
+
+  Quaternion<double> a{ 1.0, 2.0, 3.0, 4.0 };
+  Quaternion<double> b{ -2.0, 0.5, 1.0, 3.0 };
+  Quaternion<double> expected{ -4.5, 1.0, 17.5, 10.0 };
+  EXPECT_EQ(a * b, expected);
+}
+
+TEST(QUATERNION_TEST, rotate_vector_and_point)
+{
+  Vector<double, 3> axis{ normalize(Vector<double, 3>{ 1.0, 2.0, -1.0 }) };
+  Quaternion<double> q{};
+  q.setRotation(axis, 0.7);
+
+  Matrix<double, 3, 3> rotation{ q.getRotationMatrix() };
+  Vector<double, 3> v{ 0.5, -1.0, 2.0 };
+  Point<double, 3> p{ 0.5, -1.0, 2.0 };
+
+  EXPECT_TRUE(allClose(q.rotate(v), Vector<double, 3>{ rotation * v }, 1e-12));
+  EXPECT_TRUE(allClose(Vector<double, 3>{ q.rotate(p) - Point<double, 3>{} }, q.rotate(v), 1e-12));
+  EXPECT_TRUE(allClose(q.rotate(v), (q * Quaternion<double>{ v, 0.0 } * q.getConjugate()).qv(), 1e-12));
+}
+
+TEST(QUATERNION_TEST, matrix_conversion)
+{
+  Vector<double, 3> angles{ 0.3, -1.2, 2.9 };
+  Matrix<double, 3, 3> rotation{ getRotation(angles) };
+
+  Quaternion<double> fromAngles{};
+  fromAngles.setRotation(angles);
+  EXPECT_TRUE(allClose(fromAngles.getRotationMatrix(), rotation, 1e-12));
+
+  // q and -q are the same rotation
+  Quaternion<double> fromMatrix{ rotation };
+  if (dot(fromMatrix, fromAngles) < 0)
+  {
+    fromMatrix = -fromMatrix;
+  }
+  EXPECT_TRUE(allClose(fromMatrix, fromAngles, 1e-12));
+
+  // rotations by almost pi take the other branches of the conversion
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    Vector<double, 3> rotationAxis{ 0.0, 0.0, 0.0 };
+    rotationAxis(axis) = 1.0;
+    rotationAxis(( axis + 1 ) % 3) = 0.1;
+    Quaternion<double> q{};
+    q.setRotation(normalize(rotationAxis), 3.0);
+
+    Quaternion<double> roundTrip{ q.getRotationMatrix() };
+    EXPECT_TRUE(allClose(roundTrip, q, 1e-12));
+  }
+}
+
+TEST(QUATERNION_TEST, nlerp)
+{
+  Quaternion<double> q{};
+  Quaternion<double> r{};
+  q.setRotation(Vector<double, 3>{ 0.0, 0.0, 1.0 }, 0.0);
+  r.setRotation(Vector<double, 3>{ 0.0, 0.0, 1.0 }, M_PI_2);
+
+  Quaternion<double> halfway{ nlerp(q, r, 0.5) };
+  Quaternion<double> expected{};
+  expected.setRotation(Vector<double, 3>{ 0.0, 0.0, 1.0 }, M_PI_4);
+
+  EXPECT_TRUE(allClose(halfway, expected, 1e-12));
+  EXPECT_TRUE(allClose(slerp(q, r, 0.5), expected, 1e-12));
+  EXPECT_FLOAT_EQ(nlerp(q, r, 0.3).norm(), 1.0);
+}
@@ -0,0 +1,122 @@
+#include <Core/Quaternion/quaternionPacket.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace MathLib;
+
+namespace
+{
+// with MATHLIB_FAST_MATH the axes of the random rotations are only unit up to the error of Fast::rsqrt
+constexpr float tolerance{Fast::enabled<float> ? 1e-5f : 1e-6f};
+
+Quaternion<float> randomRotation(Util::Pcg32 &engine)
+{
+    Quaternion<float> q{};
+    q.setRotation(normalize(Vector<float, 3>::random(-1.0f, 1.0f, engine)), Util::random_number(-3.0f, 3.0f, engine));
+
+    return q;
+}
+
+// structure of arrays storage for the batch functions
+struct QuaternionBuffer
+{
+    std::vector<float> x, y, z, w;
+
+    explicit QuaternionBuffer(std::size_t count) : x(count), y(count), z(count), w(count) {}
+
+    QuaternionSoA<float> view() { return QuaternionSoA<float>{x.data(), y.data(), z.data(), w.data()}; }
+
+    void set(std::size_t i, const Quaternion<float> &q)
+    {
+        x[i] = q(0);
+        y[i] = q(1);
+        z[i] = q(2);
+        w[i] = q(3);
+    }
+
+    Quaternion<float> get(std::size_t i) const { return Quaternion<float>{x[i], y[i], z[i], w[i]}; }
+};
+} // namespace
+
+TEST(QUATERNION_PACKET_TEST, batch_slerp_and_nlerp)
+{
+    // not a multiple of the packet width to cover the partial last block
+    const std::size_t count{37};
+    Util::Pcg32 engine{7};
+    QuaternionBuffer q{ count }, r{ count }, slerped{ count }, nlerped{ count };
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        q.set(i, randomRotation(engine));
+        r.set(i, i % 5 == 0 ? q.get(i) : randomRotation(engine));
+    }
+
+    slerp(q.view(), r.view(), 0.3f, slerped.view(), count);
+    nlerp(q.view(), r.view(), 0.3f, nlerped.view(), count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        // the single quaternion versions take the shorter path as well
+        EXPECT_TRUE(allClose(slerped.get(i), slerp(q.get(i), r.get(i), 0.3f), tolerance)) << i;
+        EXPECT_TRUE(allClose(nlerped.get(i), nlerp(q.get(i), r.get(i), 0.3f), tolerance)) << i;
+    }
+}
+
+TEST(QUATERNION_PACKET_TEST, batch_in_place)
+{
+    const std::size_t count{9};
+    Util::Pcg32 engine{3};
+    QuaternionBuffer q{ count }, r{ count };
+    std::vector<Quaternion<float>> expected;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        q.set(i, randomRotation(engine));
+        r.set(i, randomRotation(engine));
+        expected.push_back(slerp(q.get(i), r.get(i), 0.8f));
+    }
+
+    slerp(q.view(), r.view(), 0.8f, q.view(), count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        EXPECT_TRUE(allClose(q.get(i), expected[i], tolerance)) << i;
+    }
+}
+
+TEST(QUATERNION_PACKET_TEST, to_rotation_matrices)
+{
+    const std::size_t count{11};
+    Util::Pcg32 engine{5};
+    QuaternionBuffer q{ count };
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        q.set(i, randomRotation(engine));
+    }
+
+    std::vector<Matrix<float, 4, 4>> matrices(count);
+    toRotationMatrices(q.view(), matrices.data(), count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Matrix<float, 4, 4> expected{ q.get(i).getRotationMatrix() };
+        EXPECT_TRUE(allClose(matrices[i], expected, 1e-6f)) << i;
+    }
+}
+
+TEST(QUATERNION_PACKET_TEST, packet_product)
+{
+    Util::Pcg32 engine{9};
+    Quaternionx4<float> a{ Quaternion<float>{} }, b{ Quaternion<float>{} };
+    for (int lane = 0; lane < 4; ++lane)
+    {
+        a.set(lane, randomRotation(engine));
+        b.set(lane, randomRotation(engine));
+    }
+
+    Quaternionx4<float> product{ a * b };
+    for (int lane = 0; lane < 4; ++lane)
+    {
+        EXPECT_TRUE(allClose(product.get(lane), a.get(lane) * b.get(lane), 1e-6f));
+    }
+}
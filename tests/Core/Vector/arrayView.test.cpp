@@ -0,0 +1,95 @@
+#include <Core/Matrix/matrix.h>
+#include <Core/Vector/arrayView.h>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace MathLib;
+
+TEST(ARRAY_VIEW_TEST, interleaved_buffer)
+{
+    // position (3 floats), texture coordinates (2 floats)
+    float vertices[]{ 1, 2, 3, 0.5, 0.5, 4, 5, 6, 0.25, 0.25, 7, 8, 9, 0, 0 };
+    const PointArrayView<float, 3> positions{ PointArrayView<float, 3>::interleaved(vertices, 3, 5 * sizeof(float)) };
+    const VectorArrayView<const float, 2> uvs{
+        VectorArrayView<const float, 2>::interleaved(vertices, 3, 5 * sizeof(float), 3 * sizeof(float))
+    };
+
+    EXPECT_EQ(positions.count(), 3u);
+    EXPECT_EQ(positions[1], (Point<float, 3>{ 4, 5, 6 }));
+    EXPECT_EQ(uvs.at(1), (Vector<float, 2>{ 0.25, 0.25 }));
+
+    // point semantics: the difference of two points is a vector
+    const Vector<float, 3> edge{ positions[2] - positions[0] };
+    EXPECT_EQ(edge, (Vector<float, 3>{ 6, 6, 6 }));
+
+    // writes go to the buffer
+    positions[0] = positions[0] + Vector<float, 3>{ 1, 1, 1 };
+    EXPECT_EQ(vertices[0], 2);
+    EXPECT_EQ(vertices[3], 0.5);
+
+    Matrix<float, 3, 3> scale{ 2, 0, 0, 0, 2, 0, 0, 0, 2 };
+    for (auto position : positions)
+    {
+        position = scale * position;
+    }
+    EXPECT_EQ(positions[2], (Point<float, 3>{ 14, 16, 18 }));
+    EXPECT_EQ(vertices[13], 0);
+}
+
+TEST(ARRAY_VIEW_TEST, planar_buffer)
+{
+    // x, y and z arrays of four points each
+    double planes[]{ 0, 1, 2, 3, 10, 11, 12, 13, 20, 21, 22, 23 };
+    const PointArrayView<double, 3> points{ PointArrayView<double, 3>::planar(planes, 4) };
+
+    EXPECT_EQ(points[2], (Point<double, 3>{ 2, 12, 22 }));
+    EXPECT_EQ(points.componentStride(), static_cast<std::ptrdiff_t>(4 * sizeof(double)));
+
+    std::vector<Point<double, 3>> copies(4);
+    points.copyTo(copies.data());
+    EXPECT_EQ(copies[3], (Point<double, 3>{ 3, 13, 23 }));
+
+    copies[3] = Point<double, 3>{ -1, -1, -1 };
+    points.copyFrom(copies.data());
+    EXPECT_EQ(planes[11], -1);
+
+    // read only view with planes that are further apart than their length
+    const PointArrayView<const double, 3> firstTwo{ planes, 2, sizeof(double), 4 * sizeof(double) };
+    EXPECT_EQ(firstTwo[1], (Point<double, 3>{ 1, 11, 21 }));
+}
+
+TEST(ARRAY_VIEW_TEST, iterators)
+{
+    float data[]{ 1, 0, 2, 0, 3, 0 };
+    const VectorArrayView<float, 2> vectors{ VectorArrayView<float, 2>::interleaved(data, 3) };
+
+    auto it = vectors.begin();
+    EXPECT_EQ(vectors.end() - it, 3);
+    EXPECT_EQ(it[2], (Vector<float, 2>{ 3, 0 }));
+    EXPECT_EQ(*(it + 1), (Vector<float, 2>{ 2, 0 }));
+    EXPECT_TRUE(it < vectors.end());
+
+    std::reverse(vectors.begin(), vectors.end());
+    EXPECT_EQ(vectors[0], (Vector<float, 2>{ 3, 0 }));
+
+    const auto longest{ std::max_element(vectors.begin(), vectors.end(), [](const auto &v1, const auto &v2) {
+        return v1.norm() < v2.norm();
+    }) };
+    EXPECT_EQ(longest - vectors.begin(), 0);
+
+    const VectorArrayView<const float, 2> readOnly{ vectors };
+    float sum{ 0 };
+    for (const auto vector : readOnly)
+    {
+        sum += vector(0);
+    }
+    EXPECT_EQ(sum, 6);
+
+    // default constructed iterators (and the ones of an empty view) have no stride
+    const VectorArrayView<float, 2>::iterator none;
+    EXPECT_EQ(none - none, 0);
+    EXPECT_FALSE(none < none);
+    const VectorArrayView<float, 2> empty;
+    EXPECT_EQ(empty.end() - empty.begin(), 0);
+}
@@ -0,0 +1,76 @@
+#include <Core/Vector/denseVector.h>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <type_traits>
+
+using namespace MathLib;
+
+TEST(DENSE_VECTOR_TEST, construction)
+{
+    DenseVector<float> zeros(5);
+    EXPECT_EQ(zeros.size(), 5u);
+    for (float value : zeros)
+    {
+        EXPECT_EQ(value, 0);
+    }
+
+    DenseVector<double> v{ 1, 2, 3 };
+    EXPECT_EQ(v.size(), 3u);
+    EXPECT_EQ(v(1), 2);
+    EXPECT_EQ(v.at(2), 3);
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v.data()) % Util::buffer_alignment, 0u);
+    EXPECT_EQ(DenseVector<int>{}.size(), 0u);
+}
+
+TEST(DENSE_VECTOR_TEST, move_only)
+{
+    static_assert(!std::is_copy_constructible<DenseVector<float>>::value);
+    static_assert(std::is_nothrow_move_constructible<DenseVector<float>>::value);
+
+    DenseVector<float> v(100, 2.0f);
+    const float *data = v.data();
+
+    DenseVector<float> moved{ std::move(v) };
+    EXPECT_EQ(moved.data(), data);
+    EXPECT_EQ(moved.size(), 100u);
+
+    DenseVector<float> copy{ moved.clone() };
+    EXPECT_NE(copy.data(), moved.data());
+    EXPECT_EQ(copy, moved);
+}
+
+TEST(DENSE_VECTOR_TEST, fixed_size_interop)
+{
+    DenseVector<float> v{ Vector<float, 3>{ 1, 2, 3 } };
+    EXPECT_EQ(v, (DenseVector<float>{ 1, 2, 3 }));
+
+    DenseVector<float> big(6);
+    big.setSegment(2, Vector<float, 3>{ 4, 5, 6 });
+    EXPECT_EQ(big, (DenseVector<float>{ 0, 0, 4, 5, 6, 0 }));
+    EXPECT_EQ(big.segment<2>(3), (Vector<float, 2>{ 5, 6 }));
+}
+
+TEST(DENSE_VECTOR_TEST, arithmetic)
+{
+    DenseVector<double> a{ 1, 2, 3 };
+    DenseVector<double> b{ 4, 5, 6 };
+
+    EXPECT_EQ(a + b, (DenseVector<double>{ 5, 7, 9 }));
+    EXPECT_EQ(b - a, (DenseVector<double>{ 3, 3, 3 }));
+    EXPECT_EQ(-a, (DenseVector<double>{ -1, -2, -3 }));
+    EXPECT_EQ(2.0 * a, (DenseVector<double>{ 2, 4, 6 }));
+    EXPECT_EQ(b / 2.0, (DenseVector<double>{ 2, 2.5, 3 }));
+    EXPECT_EQ(b / 2, b / 2.0);
+    EXPECT_EQ(2 * a, 2.0 * a);
+    EXPECT_EQ(a * 2, 2.0 * a);
+    EXPECT_EQ(dot(a, b), 32);
+    EXPECT_DOUBLE_EQ((DenseVector<double>{ 3, 4 }.norm()), 5);
+    EXPECT_TRUE(allClose(a * 0.1, (DenseVector<double>{ 0.1, 0.2, 0.3 })));
+    EXPECT_NE(a, (DenseVector<double>{ 1, 2 }));
+
+    std::stringstream out;
+    out << a;
+    EXPECT_EQ(out.str(), "1, 2, 3");
+}
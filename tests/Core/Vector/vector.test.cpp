@@ -1,3 +1,4 @@
+#include <Core/Vector/point.h>
 #include <Core/Vector/vector.h>
 #include <gtest/gtest.h>
 
@@ -21,6 +22,23 @@ TEST(VECTOR_TEST, instantiate_and_initialize_vector)
     Vector<float, 3> a{ 1.0, 0.0, 0.0 };
 }
 
+TEST(VECTOR_TEST, inline_storage)
+{
+    EXPECT_TRUE((std::is_trivially_copyable<Vector<float, 3>>::value));
+    EXPECT_TRUE((std::is_trivially_copyable<Point<float, 3>>::value));
+    EXPECT_EQ(sizeof(Vector<float, 3>), 3 * sizeof(float));
+    EXPECT_EQ(sizeof(Point<double, 3>), 3 * sizeof(double));
+    EXPECT_EQ(alignof(Vector<float, 4>), 16u);
+}
+
+TEST_F(VectorTest, move_constructor)
+{
+    Vector<int, 3> copy{ TestVec };
+    Vector<int, 3> moved{ std::move(copy) };
+
+    EXPECT_EQ(moved, TestVec);
+}
+
 TEST_F(VectorTest, instantiate_and_initialize_with_smaller_vector)
 {
     Vector<int, 4> a{ TestVec, 4 };
@@ -209,3 +227,63 @@ TEST_F(VectorTest, angleTo)
     ASSERT_FLOAT_EQ(180*vec1.angleTo(vec1)/M_PI, 0.0);
     ASSERT_FLOAT_EQ(180*vec1.angleTo(vec2)/M_PI, 90.0);
 }
+
+TEST_F(VectorTest, chained_expression)
+{
+    Vector<float, 3> a{ 1.0, 2.0, 3.0 };
+    Vector<float, 3> n{ 0.0, 1.0, 0.0 };
+    Vector<float, 3> b{ 1.0, 1.0, 1.0 };
+
+    Vector<float, 3> res = a + 2 * dot(a, n) * n - b;
+    Vector<float, 3> expected{ 0.0, 5.0, 2.0 };
+
+    EXPECT_EQ(res, expected);
+}
+
+TEST_F(VectorTest, expression_assignment_aliasing)
+{
+    TestVec = TestVec + TestVec;
+
+    EXPECT_EQ(TestVec, TestVecX2);
+}
+
+TEST_F(VectorTest, expression_functions)
+{
+    Vector<int, 3> u{ 1, 0, 0 };
+    Vector<int, 3> v{ 0, 1, 0 };
+
+    EXPECT_EQ(dot(u + v, v), 1);
+    EXPECT_EQ(cross(u + u, v), (Vector<int, 3>{ 0, 0, 2 }));
+    EXPECT_FLOAT_EQ((TestVec - TestVec + u).norm(), 1.0);
+}
+
+TEST_F(VectorTest, constexpr_arithmetic)
+{
+    constexpr Vector<int, 3> u{ 1, 0, 0 };
+    constexpr Vector<int, 3> v{ 0, 1, 0 };
+    static_assert(dot(u, v) == 0);
+    static_assert(dot(u + v, v) == 1);
+    static_assert(cross(u, v) == Vector<int, 3>{ 0, 0, 1 });
+    static_assert(Vector<int, 3>{ 2 * u - v } == Vector<int, 3>{ 2, -1, 0 });
+    static_assert(Vector<int, 3>{ u }.negate() == -u);
+
+    constexpr Point<int, 3> p = Point<int, 3>{ 1, 1, 1 } + u;
+    static_assert(p - Point<int, 3>{ 1, 1, 1 } == u);
+    EXPECT_EQ(p, (Point<int, 3>{ 2, 1, 1 }));
+}
+
+TEST(POINT_TEST, point_vector_expressions)
+{
+    Point<int, 3> p{ 1, 1, 1 };
+    Point<int, 3> q{ 2, 3, 4 };
+    Vector<int, 3> v{ 1, 2, 3 };
+
+    Vector<int, 3> diff = q - p;
+    Point<int, 3> moved = p + v;
+    Point<int, 3> movedBack = q - v;
+
+    EXPECT_EQ(diff, v);
+    EXPECT_EQ(moved, q);
+    EXPECT_EQ(movedBack, p);
+    EXPECT_EQ(v + p, q);
+}
@@ -0,0 +1,69 @@
+#include <Core/Vector/vectorArray.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace MathLib;
+
+TEST(VECTOR_ARRAY_TEST, add_and_subtract)
+{
+    std::vector<Point<float, 3>> points{ Point<float, 3>{ 1, 2, 3 }, Point<float, 3>{ -1, 0, 1 } };
+    std::vector<Vector<float, 3>> offsets{ Vector<float, 3>{ 1, 1, 1 }, Vector<float, 3>{ 0, 2, 4 } };
+
+    std::vector<Point<float, 3>> moved(2);
+    addArrays(points.data(), offsets.data(), moved.data(), 2);
+    EXPECT_EQ(moved[0], (Point<float, 3>{ 2, 3, 4 }));
+    EXPECT_EQ(moved[1], (Point<float, 3>{ -1, 2, 5 }));
+
+    std::vector<Vector<float, 3>> differences(2);
+    subtractArrays(moved.data(), points.data(), differences.data(), 2);
+    EXPECT_EQ(differences, offsets);
+
+    // in place
+    subtractArrays(moved.data(), offsets.data(), moved.data(), 2);
+    EXPECT_EQ(moved, points);
+}
+
+TEST(VECTOR_ARRAY_TEST, products_and_normalize)
+{
+    std::vector<Vector<double, 3>> a{ Vector<double, 3>{ 1, 0, 0 }, Vector<double, 3>{ 0, 3, 4 } };
+    std::vector<Vector<double, 3>> b{ Vector<double, 3>{ 0, 1, 0 }, Vector<double, 3>{ 0, 1, 1 } };
+
+    std::vector<double> dots(2);
+    dotArrays(a.data(), b.data(), dots.data(), 2);
+    EXPECT_EQ(dots, (std::vector<double>{ 0, 7 }));
+
+    std::vector<Vector<double, 3>> crosses(2);
+    crossArrays(a.data(), b.data(), crosses.data(), 2);
+    EXPECT_EQ(crosses[0], (Vector<double, 3>{ 0, 0, 1 }));
+    EXPECT_EQ(crosses[1], (Vector<double, 3>{ -1, 0, 0 }));
+
+    scaleArray(a.data(), 2.0, a.data(), 2);
+    EXPECT_EQ(a[1], (Vector<double, 3>{ 0, 6, 8 }));
+
+    normalizeArray(a.data(), a.data(), 2);
+    EXPECT_TRUE(allClose(a[1], Vector<double, 3>{ 0, 0.6, 0.8 }));
+}
+
+TEST(VECTOR_ARRAY_TEST, big_arrays_in_parallel)
+{
+    Util::setThreadCount(4);
+
+    const std::size_t count{ 100003 };
+    std::vector<Vector<float, 4>> vectors(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        vectors[i] = Vector<float, 4>{ float(i), 1, 2, 3 };
+    }
+
+    addArrays(vectors.data(), vectors.data(), vectors.data(), count);
+    const Vector<float, 4> offset{ 0, 1, 1, 1 };
+    transformArray(vectors.data(), vectors.data(), count,
+                   [&offset](const Vector<float, 4> &vector) { return Vector<float, 4>{ vector - offset }; });
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(vectors[i], (Vector<float, 4>{ 2.0f * i, 1, 3, 5 })) << i;
+    }
+
+    Util::setThreadCount(0);
+}
@@ -0,0 +1,86 @@
+#include <Core/Vector/vectorPacket.h>
+#include <gtest/gtest.h>
+
+using namespace MathLib;
+
+class VectorPacketTest : public ::testing::Test
+{
+protected:
+    Vector<float, 3> vectors[4]{
+        Vector<float, 3>{ 1, 2, 3 },
+        Vector<float, 3>{ -1, 0, 2 },
+        Vector<float, 3>{ 0.5, 0.25, -4 },
+        Vector<float, 3>{ 0, 0, 0 },
+    };
+    Vector<float, 3> normals[4]{
+        Vector<float, 3>{ 0, 1, 0 },
+        Vector<float, 3>{ 1, 0, 0 },
+        Vector<float, 3>{ 0, 0, 1 },
+        Vector<float, 3>{ 0, 1, 0 },
+    };
+};
+
+TEST_F(VectorPacketTest, load_and_store)
+{
+    Vector3x4<float> packet{ Vector3x4<float>::load(vectors) };
+    Vector<float, 3> stored[4];
+    packet.store(stored);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(packet.get(i), vectors[i]);
+        EXPECT_EQ(stored[i], vectors[i]);
+    }
+}
+
+TEST_F(VectorPacketTest, matches_scalar_operations)
+{
+    Vector3x4<float> v{ Vector3x4<float>::load(vectors) };
+    Vector3x4<float> n{ Vector3x4<float>::load(normals) };
+
+    Packet<float, 4> dots{ dot(v, n) };
+    Vector3x4<float> crosses{ cross(v, n) };
+    Vector3x4<float> reflected{ reflect(v, n) };
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_FLOAT_EQ(dots[i], dot(vectors[i], normals[i]));
+        EXPECT_EQ(crosses.get(i), cross(vectors[i], normals[i]));
+        EXPECT_EQ(reflected.get(i), reflect(vectors[i], normals[i]));
+    }
+
+    Vector3x4<float> normalized{ normalize(n) };
+    if constexpr (Fast::enabled<float>)
+    {
+        // Fast::rsqrt has a relative error up to 4.7e-6 without SIMD
+        EXPECT_NEAR(normalized.norm()[0], 1.0, 5e-6);
+    }
+    else
+    {
+        EXPECT_FLOAT_EQ(normalized.norm()[0], 1.0);
+    }
+}
+
+TEST_F(VectorPacketTest, near_zero_mask)
+{
+    Vector3x4<float> v{ Vector3x4<float>::load(vectors) };
+
+    EXPECT_EQ(v.nearZero().bits(), 8);
+}
+
+TEST_F(VectorPacketTest, refract_total_internal_reflection)
+{
+    Vector<float, 3> steep{ normalize(Vector<float, 3>{ 0, -1, 0.1 }) };
+    Vector<float, 3> grazing{ normalize(Vector<float, 3>{ 0, -0.1, 1 }) };
+    Vector<float, 3> normal{ 0, 1, 0 };
+
+    Vector3x8<float> v{ Vector3x8<float>{ steep } };
+    v.set(1, grazing);
+    Vector3x8<float> n{ normal };
+
+    Packet<float, 8>::mask_type totalInternalReflection;
+    Vector3x8<float> refracted{ refract(v, n, Packet<float, 8>{ 1.5 }, totalInternalReflection) };
+
+    EXPECT_EQ(totalInternalReflection.bits(), 2);
+    EXPECT_TRUE(allClose(refracted.get(0), refract(steep, normal, 1.5), 1e-6f));
+}
@@ -0,0 +1,67 @@
+#include <Core/Matrix/matrix.h>
+#include <Core/Vector/vectorView.h>
+#include <gtest/gtest.h>
+
+using namespace MathLib;
+
+TEST(VECTOR_VIEW_TEST, strided_access)
+{
+    // interleaved x, y pairs, the view sees the y components
+    float buffer[]{ 1, 2, 3, 4, 5, 6 };
+    VectorView<float, 3> ys{ buffer + 1, 2 };
+
+    EXPECT_EQ(ys.size(), 3);
+    EXPECT_EQ(ys(0), 2);
+    EXPECT_EQ(ys.at(2), 6);
+
+    ys(1) = 10;
+    EXPECT_EQ(buffer[3], 10);
+
+    VectorView<const float, 3> readOnly{ ys };
+    EXPECT_EQ(readOnly.data(), buffer + 1);
+    EXPECT_EQ(readOnly.stride(), 2);
+}
+
+TEST(VECTOR_VIEW_TEST, expressions)
+{
+    double buffer[]{ 1, 0, 2, 0, 3 };
+    const VectorView<double, 3> view{ buffer, 2 };
+    const Vector<double, 3> v{ 1, 1, 1 };
+
+    EXPECT_EQ((Vector<double, 3>{ view + v }), (Vector<double, 3>{ 2, 3, 4 }));
+    EXPECT_EQ((Vector<double, 3>{ 2.0 * view - v }), (Vector<double, 3>{ 1, 3, 5 }));
+    EXPECT_EQ(dot(view, v), 6);
+    EXPECT_EQ(cross(view, v), cross(Vector<double, 3>{ 1, 2, 3 }, v));
+    EXPECT_DOUBLE_EQ(view.norm(), std::sqrt(14.0));
+    EXPECT_EQ(view, (Vector<double, 3>{ 1, 2, 3 }));
+
+    Matrix<double, 3, 3> scale{ 2, 0, 0, 0, 2, 0, 0, 0, 2 };
+    EXPECT_EQ(scale * view, (Vector<double, 3>{ 2, 4, 6 }));
+
+    Vector<double, 3> sum{ v };
+    sum += view;
+    EXPECT_EQ(sum, (Vector<double, 3>{ 2, 3, 4 }));
+}
+
+TEST(VECTOR_VIEW_TEST, assignment)
+{
+    int buffer[]{ 1, 2, 3, 4, 5, 6 };
+    VectorView<int, 3> first{ buffer };
+    VectorView<int, 3> second{ buffer + 3 };
+
+    // assigning a view copies the elements
+    first = second;
+    EXPECT_EQ(first, (Vector<int, 3>{ 4, 5, 6 }));
+    EXPECT_EQ(first.data(), buffer);
+
+    second = Vector<int, 3>{ 7, 8, 9 };
+    second += first;
+    second *= 2;
+    EXPECT_EQ(second, (Vector<int, 3>{ 22, 26, 30 }));
+
+    // overlapping views are read completely before they are written
+    VectorView<int, 3> shifted{ buffer + 1 };
+    shifted = first;
+    EXPECT_EQ(shifted, (Vector<int, 3>{ 4, 5, 6 }));
+    EXPECT_EQ(buffer[0], 4);
+}
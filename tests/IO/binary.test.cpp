@@ -0,0 +1,183 @@
+#include <Core/Matrix/matrix.h>
+#include <Core/Quaternion/quaternion.h>
+#include <Core/Vector/point.h>
+#include <Core/Vector/vector.h>
+#include <IO/binary.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace MathLib;
+
+TEST(BINARY_IO_TEST, round_trip)
+{
+    std::vector<Matrix<float, 4, 4>> transforms(3);
+    for (std::size_t i{0}; i < transforms.size(); ++i)
+    {
+        for (int j{0}; j < 16; ++j)
+        {
+            transforms[i](j % 4, j / 4) = 0.1f * j + i;
+        }
+    }
+
+    std::stringstream stream;
+    EXPECT_TRUE(writeBinary(stream, transforms.data(), transforms.size()));
+    EXPECT_EQ(stream.str().size(), sizeof(BinaryHeader) + 3 * sizeof(Matrix<float, 4, 4>));
+
+    BinaryHeader header;
+    EXPECT_TRUE(readBinaryHeader(stream, header));
+    EXPECT_EQ(header.kind, BinaryElementKind::matrix);
+    EXPECT_EQ(header.scalarType, BinaryScalarType::float32);
+    EXPECT_EQ(header.rows, 4u);
+    EXPECT_EQ(header.cols, 4u);
+    EXPECT_EQ(header.padding, 0u);
+    EXPECT_EQ(header.count, 3u);
+
+    stream.seekg(0);
+    std::vector<Matrix<float, 4, 4>> loaded;
+    EXPECT_TRUE(readBinary(stream, loaded));
+    EXPECT_EQ(loaded, transforms);
+
+    // other element types are rejected
+    stream.seekg(0);
+    std::vector<Matrix<double, 4, 4>> wrongType;
+    EXPECT_FALSE(readBinary(stream, wrongType));
+    stream.seekg(0);
+    std::vector<Vector<float, 16>> wrongKind;
+    EXPECT_FALSE(readBinary(stream, wrongKind));
+}
+
+TEST(BINARY_IO_TEST, other_byte_order)
+{
+    const Vector<double, 3> vectors[]{ { 1.5, -2, 3 }, { 4, 5, 6.25 } };
+    std::stringstream stream;
+    writeBinary(stream, vectors, 2);
+
+    // what a machine with the other byte order would have written
+    std::string bytes{ stream.str() };
+    const auto reverse = [&bytes](std::size_t offset, std::size_t size) {
+        for (std::size_t i{0}; i < size / 2; ++i)
+        {
+            std::swap(bytes[offset + i], bytes[offset + size - 1 - i]);
+        }
+    };
+    reverse(4, 2);
+    reverse(6, 2);
+    reverse(10, 2);
+    reverse(12, 4);
+    reverse(16, 4);
+    reverse(24, 8);
+    for (std::size_t i{0}; i < 6; ++i)
+    {
+        reverse(sizeof(BinaryHeader) + i * sizeof(double), sizeof(double));
+    }
+
+    std::istringstream swapped{ bytes };
+    std::vector<Vector<double, 3>> loaded;
+    EXPECT_TRUE(readBinary(swapped, loaded));
+    ASSERT_EQ(loaded.size(), 2u);
+    EXPECT_EQ(loaded[0], vectors[0]);
+    EXPECT_EQ(loaded[1], vectors[1]);
+}
+
+namespace
+{
+// a buffer that can not seek, like a pipe or a socket
+class UnseekableBuffer : public std::stringbuf
+{
+public:
+    explicit UnseekableBuffer(const std::string &data) : std::stringbuf{ data, std::ios::in } {}
+
+protected:
+    pos_type seekoff(off_type, std::ios::seekdir, std::ios::openmode) override { return pos_type(-1); }
+
+    pos_type seekpos(pos_type, std::ios::openmode) override { return pos_type(-1); }
+};
+
+std::string withCount(std::string data, std::uint64_t count)
+{
+    std::memcpy(&data[offsetof(BinaryHeader, count)], &count, sizeof(count));
+    return data;
+}
+} // namespace
+
+TEST(BINARY_IO_TEST, corrupt_count)
+{
+    // more than one chunk when the stream length is unknown
+    std::vector<Matrix<float, 4, 4>> transforms(20000);
+    for (std::size_t i{0}; i < transforms.size(); ++i)
+    {
+        transforms[i](3, 1) = static_cast<float>(i);
+    }
+    std::stringstream stream;
+    ASSERT_TRUE(writeBinary(stream, transforms.data(), transforms.size()));
+    const std::string data{ stream.str() };
+
+    UnseekableBuffer buffer{ data };
+    std::istream unseekable{ &buffer };
+    std::vector<Matrix<float, 4, 4>> loaded;
+    ASSERT_TRUE(readBinary(unseekable, loaded));
+    EXPECT_EQ(loaded, transforms);
+
+    for (const std::uint64_t count : { std::uint64_t{ 20001 },
+                                       std::uint64_t{ 1 } << 40,
+                                       std::numeric_limits<std::uint64_t>::max() / 64 + 1,
+                                       std::numeric_limits<std::uint64_t>::max() })
+    {
+        std::istringstream seekable{ withCount(data, count) };
+        EXPECT_FALSE(readBinary(seekable, loaded)) << count;
+        EXPECT_TRUE(loaded.empty());
+
+        UnseekableBuffer truncated{ withCount(data, count) };
+        std::istream truncatedStream{ &truncated };
+        EXPECT_FALSE(readBinary(truncatedStream, loaded)) << count;
+        EXPECT_TRUE(loaded.empty());
+    }
+}
+
+#if defined(MATHLIB_HAS_MMAP)
+TEST(BINARY_IO_TEST, streamed_and_mapped)
+{
+    const std::string path{ ::testing::TempDir() + "mathlib_binary_io_test.bin" };
+    {
+        std::ofstream file{ path, std::ios::binary };
+        BinaryArrayWriter<Quaternion<float>> writer{ file };
+        for (int i{0}; i < 1000; ++i)
+        {
+            EXPECT_TRUE(writer.write(Quaternion<float>{ i, 2 * i, 3 * i, 0.5 }));
+        }
+        EXPECT_TRUE(writer.finish());
+        EXPECT_EQ(writer.count(), 1000u);
+    }
+
+    MappedArray<Quaternion<float>> quaternions;
+    ASSERT_TRUE(quaternions.open(path.c_str()));
+    EXPECT_EQ(quaternions.size(), 1000u);
+    EXPECT_EQ(quaternions[10](1), 20);
+    EXPECT_EQ(quaternions.at(999)(3), 0.5);
+
+    float sum{ 0 };
+    for (const Quaternion<float> &quaternion : quaternions)
+    {
+        sum += quaternion(0);
+    }
+    EXPECT_EQ(sum, 499500);
+
+    const MappedArray<Quaternion<float>> moved{ std::move(quaternions) };
+    EXPECT_FALSE(quaternions.isOpen());
+    EXPECT_EQ(moved[1](2), 3);
+
+    MappedArray<Point<float, 4>> wrongKind;
+    EXPECT_FALSE(wrongKind.open(path.c_str()));
+    EXPECT_FALSE(wrongKind.open((path + ".missing").c_str()));
+
+    std::remove(path.c_str());
+}
+#endif
@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <util/fastMath.h>
+
+using namespace MathLib;
+
+TEST(FAST_MATH_TEST, scalar_error_bounds)
+{
+    double maxSinError{0};
+    double maxAcosError{0};
+    for (int i = 0; i <= 10000; ++i)
+    {
+        const double x = -1.0 + 2.0 * i / 10000;
+        maxAcosError = std::max(maxAcosError, std::abs(Fast::acos(x) - std::acos(x)));
+        maxSinError = std::max(maxSinError, std::abs(Fast::sin(x * M_PI_2) - std::sin(x * M_PI_2)));
+    }
+
+    EXPECT_LT(maxAcosError, 2.2e-8);
+    EXPECT_LT(maxSinError, 3.4e-9);
+}
+
+TEST(FAST_MATH_TEST, packet_matches_scalar)
+{
+    float values[4]{ -1.0f, -0.25f, 0.5f, 1.0f };
+    Packet<float, 4> x{ Packet<float, 4>::load(values) };
+    Packet<float, 4> acos{ Fast::acos(x) };
+    Packet<float, 4> sin{ Fast::sin(x) };
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_FLOAT_EQ(acos[i], Fast::acos(values[i]));
+        EXPECT_FLOAT_EQ(sin[i], Fast::sin(values[i]));
+        EXPECT_NEAR(acos[i], std::acos(values[i]), 1e-6);
+    }
+}
+
+TEST(FAST_MATH_TEST, rsqrt_sincos_exp_error_bounds)
+{
+    double maxRsqrtError{0};
+    double maxSinCosError{0};
+    double maxExpError{0};
+    for (int i = 0; i <= 10000; ++i)
+    {
+        const double t = static_cast<double>(i) / 10000;
+
+        const double x = std::ldexp(1.0 + t, i % 200 - 100);
+        maxRsqrtError = std::max(maxRsqrtError, std::abs(Fast::rsqrt(x) * std::sqrt(x) - 1));
+
+        const double angle = -1e4 + 2e4 * t;
+        double sin;
+        double cos;
+        Fast::sincos(angle, sin, cos);
+        maxSinCosError = std::max({ maxSinCosError, std::abs(sin - std::sin(angle)), std::abs(cos - std::cos(angle)) });
+
+        const double e = -700.0 + 1400.0 * t;
+        maxExpError = std::max(maxExpError, std::abs(Fast::exp(e) / std::exp(e) - 1));
+    }
+
+    EXPECT_LT(maxRsqrtError, 3.3e-11);
+    EXPECT_LT(maxSinCosError, 2.7e-9);
+    EXPECT_LT(maxExpError, 1.1e-9);
+}
+
+TEST(FAST_MATH_TEST, float_error_bounds)
+{
+    float maxRsqrtError{0};
+    float maxSinCosError{0};
+    float maxExpError{0};
+    for (int i = 0; i <= 10000; ++i)
+    {
+        const float t = static_cast<float>(i) / 10000;
+
+        const float x = std::ldexp(1.0f + t, i % 100 - 50);
+        const double rsqrtError{ std::abs(Fast::rsqrt(x) * std::sqrt(double{ x }) - 1) };
+        maxRsqrtError = std::max(maxRsqrtError, static_cast<float>(rsqrtError));
+
+        const float angle = -100.0f + 200.0f * t;
+        float sin;
+        float cos;
+        Fast::sincos(angle, sin, cos);
+        maxSinCosError = std::max({ maxSinCosError,
+                                    static_cast<float>(std::abs(sin - std::sin(double{ angle }))),
+                                    static_cast<float>(std::abs(cos - std::cos(double{ angle }))) });
+
+        const float e = -87.0f + 175.0f * t;
+        maxExpError = std::max(maxExpError, static_cast<float>(std::abs(Fast::exp(e) / std::exp(double{ e }) - 1)));
+    }
+
+    EXPECT_LT(maxRsqrtError, 4.8e-6);
+    EXPECT_LT(maxSinCosError, 9e-8);
+    EXPECT_LT(maxExpError, 1e-7);
+}
+
+TEST(FAST_MATH_TEST, sincos_exp_packet_matches_scalar)
+{
+    float values[8]{ -87.5f, -3.0f, -1.0f, 0.0f, 0.5f, 2.0f, 40.0f, 100.0f };
+    Packet<float, 8> x{ Packet<float, 8>::load(values) };
+    Packet<float, 8> sin;
+    Packet<float, 8> cos;
+    Fast::sincos(x, sin, cos);
+    Packet<float, 8> exp{ Fast::exp(x) };
+    Packet<float, 8> rsqrt{ Fast::rsqrt(x * x + Packet<float, 8>{ 1.0f }) };
+
+    for (int i = 0; i < 8; ++i)
+    {
+        float s;
+        float c;
+        Fast::sincos(values[i], s, c);
+        EXPECT_FLOAT_EQ(sin[i], s);
+        EXPECT_FLOAT_EQ(cos[i], c);
+        EXPECT_FLOAT_EQ(exp[i], Fast::exp(values[i]));
+        EXPECT_NEAR(rsqrt[i], 1 / std::sqrt(values[i] * values[i] + 1), 5e-6 * rsqrt[i]);
+    }
+}
+
+TEST(FAST_MATH_TEST, type_policy)
+{
+    // the approximations are too coarse for double, only float follows MATHLIB_FAST_MATH
+    EXPECT_EQ(Fast::type_policy<float>, Fast::policy);
+    EXPECT_EQ(Fast::type_policy<double>, Fast::Policy::exact);
+    EXPECT_FALSE(Fast::enabled<double>);
+    EXPECT_FALSE(Fast::enabled<int>);
+}
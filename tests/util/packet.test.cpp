@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <util/packet.h>
+
+using namespace MathLib;
+
+template <typename P>
+class PacketTest : public ::testing::Test
+{
+};
+
+using PacketTypes = ::testing::Types<Packet<float, 4>, Packet<float, 8>, Packet<double, 4>, Packet<int, 4>>;
+TYPED_TEST_SUITE(PacketTest, PacketTypes);
+
+TYPED_TEST(PacketTest, load_and_store)
+{
+    using T = typename TypeParam::value_type;
+    T values[TypeParam::size()];
+    for (int i = 0; i < TypeParam::size(); ++i)
+    {
+        values[i] = T(i + 1);
+    }
+
+    TypeParam p{ TypeParam::load(values) };
+    T stored[TypeParam::size()];
+    (p + TypeParam{ 1 }).store(stored);
+
+    for (int i = 0; i < TypeParam::size(); ++i)
+    {
+        EXPECT_EQ(p[i], T(i + 1));
+        EXPECT_EQ(stored[i], T(i + 2));
+    }
+}
+
+TYPED_TEST(PacketTest, arithmetic)
+{
+    using T = typename TypeParam::value_type;
+    TypeParam a{ T(6) };
+    TypeParam b{ T(2) };
+    a.set(0, T(-4));
+
+    EXPECT_EQ((a + b)[1], T(8));
+    EXPECT_EQ((a - b)[1], T(4));
+    EXPECT_EQ((a * b)[1], T(12));
+    EXPECT_EQ((a / b)[1], T(3));
+    EXPECT_EQ((-a)[0], T(4));
+    EXPECT_EQ(abs(a)[0], T(4));
+    EXPECT_EQ(min(a, b)[0], T(-4));
+    EXPECT_EQ(max(a, b)[0], T(2));
+}
+
+TYPED_TEST(PacketTest, masks)
+{
+    using T = typename TypeParam::value_type;
+    TypeParam a{ T(1) };
+    a.set(1, T(3));
+
+    auto mask = a > TypeParam{ T(2) };
+    EXPECT_TRUE(mask.any());
+    EXPECT_FALSE(mask.all());
+    EXPECT_EQ(mask.bits(), 2);
+    EXPECT_TRUE((!mask)[0]);
+    EXPECT_TRUE((mask | !mask).all());
+    EXPECT_TRUE((mask & !mask).none());
+
+    TypeParam selected{ select(mask, TypeParam{ T(10) }, a) };
+    EXPECT_EQ(selected[0], T(1));
+    EXPECT_EQ(selected[1], T(10));
+}
@@ -0,0 +1,132 @@
+#include <Core/Vector/point.h>
+#include <Core/Vector/vector.h>
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <thread>
+#include <util/random.h>
+
+using namespace MathLib;
+
+TEST(UTIL_RANDOM_TEST, pcg32_reference_output)
+{
+    // first outputs of the reference implementation (pcg32-demo) for seed 42 and stream 54
+    Util::Pcg32 engine{42u, 54u};
+    const std::uint32_t expected[6]{0xa15c02b7, 0x7b47f409, 0xba1d3330, 0x83d2f293, 0xbfa4784b, 0xcbed606e};
+
+    for (std::uint32_t value : expected)
+    {
+        EXPECT_EQ(engine(), value);
+    }
+}
+
+TEST(UTIL_RANDOM_TEST, seeding_is_reproducible)
+{
+    Util::Pcg32 a{1234};
+    Util::Pcg32 b{1234};
+    Util::Pcg32 otherStream{1234, 7};
+
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, otherStream);
+    for (int i{0}; i < 100; ++i)
+    {
+        EXPECT_EQ(Util::random_number<double>(a), Util::random_number<double>(b));
+    }
+
+    Util::seedRandom(99);
+    const float first = Util::random_number<float>();
+    Util::seedRandom(99);
+    EXPECT_EQ(Util::random_number<float>(), first);
+}
+
+TEST(UTIL_RANDOM_TEST, numbers_are_in_range)
+{
+    Util::Pcg32 engine{5};
+
+    for (int i{0}; i < 10000; ++i)
+    {
+        const float f = Util::random_number<float>(engine);
+        const double d = Util::random_number<double>(-2.0, 3.0, engine);
+        EXPECT_GE(f, 0.0f);
+        EXPECT_LT(f, 1.0f);
+        EXPECT_GE(d, -2.0);
+        EXPECT_LT(d, 3.0);
+    }
+
+    std::mt19937 standardEngine{};
+    const double d = Util::random_number<double>(standardEngine);
+    EXPECT_GE(d, 0.0);
+    EXPECT_LT(d, 1.0);
+}
+
+namespace
+{
+// always returns its largest value, so the numbers in [0, 1) drawn from it are as close to 1 as possible
+struct MaxEngine
+{
+    using result_type = std::uint32_t;
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() { return max(); }
+};
+} // namespace
+
+TEST(UTIL_RANDOM_TEST, range_excludes_max)
+{
+    // 1 + (1 - 2^-24) rounds to 2 in float
+    MaxEngine maxEngine;
+    EXPECT_LT(Util::random_number<float>(1.0f, 2.0f, maxEngine), 2.0f);
+    EXPECT_LT(Util::random_number<double>(1.0, 2.0, maxEngine), 2.0);
+    EXPECT_LT(Util::random_number<float>(-3.0f, 2.0f, maxEngine), 2.0f);
+
+    float values[4];
+    Util::fillRandom(values, 4, 1.0f, 2.0f, maxEngine);
+    for (float value : values)
+    {
+        EXPECT_EQ(value, std::nextafter(2.0f, 1.0f));
+    }
+}
+
+TEST(UTIL_RANDOM_TEST, threads_use_separate_engines)
+{
+    Util::Pcg32 *mainEngine = &Util::threadEngine();
+    Util::Pcg32 *otherEngine = nullptr;
+    Util::Pcg32 otherCopy;
+
+    std::thread thread{[&]() {
+        otherEngine = &Util::threadEngine();
+        otherCopy = *otherEngine;
+    }};
+    thread.join();
+
+    EXPECT_NE(mainEngine, otherEngine);
+    EXPECT_NE(*mainEngine, otherCopy);
+}
+
+TEST(UTIL_RANDOM_TEST, fill_random)
+{
+    float values[64];
+    Util::Pcg32 engine{3};
+    Util::fillRandom(values, 64, 1.0f, 2.0f, engine);
+
+    Util::Pcg32 reference{3};
+    for (float value : values)
+    {
+        EXPECT_EQ(value, Util::random_number<float>(1.0f, 2.0f, reference));
+    }
+}
+
+TEST(UTIL_RANDOM_TEST, vector_and_point_with_engine)
+{
+    Util::Pcg32 a{11};
+    Util::Pcg32 b{11};
+
+    Vector<double, 3> v = Vector<double, 3>::random(a);
+    Point<float, 3> p = Point<float, 3>::random(-1.0f, 1.0f, a);
+
+    EXPECT_EQ(v, (Vector<double, 3>::random(b)));
+    EXPECT_EQ(p, (Point<float, 3>::random(-1.0f, 1.0f, b)));
+}
@@ -0,0 +1,123 @@
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <util/threadPool.h>
+#include <vector>
+
+using namespace MathLib;
+
+#if !defined(MATHLIB_NO_THREADS)
+TEST(THREAD_POOL_TEST, covers_range_once)
+{
+    Util::ThreadPool pool{ 4 };
+    EXPECT_EQ(pool.threadCount(), 4u);
+
+    std::vector<int> visits(10010, 0);
+    std::atomic<int> blocks{ 0 };
+    pool.parallelFor(3, 10003, 7, [&](std::size_t begin, std::size_t end) {
+        EXPECT_LT(begin, end);
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            ++visits[i];
+        }
+        ++blocks;
+    });
+
+    for (std::size_t i = 0; i < visits.size(); ++i)
+    {
+        EXPECT_EQ(visits[i], i >= 3 && i < 10003 ? 1 : 0) << i;
+    }
+    // at most blocks_per_thread (4) blocks per thread
+    EXPECT_GT(blocks.load(), 1);
+    EXPECT_LE(blocks.load(), 16);
+}
+
+TEST(THREAD_POOL_TEST, nested_calls)
+{
+    Util::ThreadPool pool{ 3 };
+
+    std::atomic<long> sum{ 0 };
+    pool.parallelFor(0, 12, 1, [&](std::size_t outerBegin, std::size_t outerEnd) {
+        for (std::size_t outer = outerBegin; outer < outerEnd; ++outer)
+        {
+            pool.parallelFor(0, 1000, 10, [&](std::size_t begin, std::size_t end) {
+                long partial{ 0 };
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    partial += static_cast<long>(i);
+                }
+                sum += partial;
+            });
+        }
+    });
+
+    EXPECT_EQ(sum.load(), 12 * 999 * 1000 / 2);
+}
+
+TEST(THREAD_POOL_TEST, rethrows_exceptions)
+{
+    Util::ThreadPool pool{ 4 };
+
+    std::atomic<int> ran{ 0 };
+    EXPECT_THROW(pool.parallelFor(0, 96, 1,
+                                  [&](std::size_t begin, std::size_t) {
+                                      ++ran;
+                                      if (begin == 0)
+                                      {
+                                          throw std::runtime_error{ "failed" };
+                                      }
+                                  }),
+                 std::runtime_error);
+    // the other blocks still ran before the exception was rethrown
+    EXPECT_EQ(ran.load(), 16);
+
+    // the pool is still usable afterwards
+    std::atomic<int> count{ 0 };
+    pool.parallelFor(0, 100, 1, [&](std::size_t begin, std::size_t end) { count += static_cast<int>(end - begin); });
+    EXPECT_EQ(count.load(), 100);
+}
+
+TEST(THREAD_POOL_TEST, serial_fallback)
+{
+    Util::ThreadPool pool{ 1 };
+    const std::thread::id caller{ std::this_thread::get_id() };
+
+    int calls{ 0 };
+    pool.parallelFor(0, 100000, 1, [&](std::size_t begin, std::size_t end) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        EXPECT_EQ(begin, 0u);
+        EXPECT_EQ(end, 100000u);
+        ++calls;
+    });
+    EXPECT_EQ(calls, 1);
+}
+#endif
+
+TEST(THREAD_POOL_TEST, global_thread_count)
+{
+    const std::thread::id caller{ std::this_thread::get_id() };
+
+    Util::setThreadCount(1);
+    EXPECT_EQ(Util::threadCount(), 1u);
+
+    int calls{ 0 };
+    Util::parallelFor(0, 100000, 10, [&](std::size_t begin, std::size_t end) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        EXPECT_EQ(end - begin, 100000u);
+        ++calls;
+    });
+    EXPECT_EQ(calls, 1);
+
+#if !defined(MATHLIB_NO_THREADS)
+    Util::setThreadCount(3);
+    EXPECT_EQ(Util::threadCount(), 3u);
+
+    std::atomic<std::size_t> count{ 0 };
+    Util::parallelFor(0, 100000, 10, [&](std::size_t begin, std::size_t end) { count += end - begin; });
+    EXPECT_EQ(count.load(), 100000u);
+#endif
+
+    Util::setThreadCount(0);
+    EXPECT_GE(Util::threadCount(), 1u);
+}
@@ -86,3 +86,12 @@ TEST(UTIL_TEST, radToDeg_Matrix) {
     );
 }
 
+
+TEST(UTIL_TEST, degToRad_constexpr) {
+    static_assert(degToRad(180.0) == M_PI);
+    static_assert(radToDeg(M_PI) == 180.0);
+
+    constexpr MathLib::Vector<double, 2> rad{ degToRad(MathLib::Vector<double, 2>{ 0.0, 180.0 }) };
+    static_assert(rad == MathLib::Vector<double, 2>{ 0.0, M_PI });
+    EXPECT_DOUBLE_EQ(rad(1), M_PI);
+}